@@ -4,6 +4,9 @@
  * Note(s): possible defines select the used ADC interface:
  *            __ADC_IRQ   - ADC works in Interrupt mode
  *                        - ADC works in polling mode (default)
+ *          ADC_BurstStart switches to free running conversions instead:
+ *          every sample goes through the interrupt into a ring and the
+ *          filter, readers only load the published value.
  *----------------------------------------------------------------------------
  * This file is part of the uVision/ARM development tools.
  * This software may only be used under the terms of a valid, current,
@@ -17,10 +20,19 @@
 
 #include "LPC17xx.H"                         /* LPC17xx definitions           */
 #include "ADC.h"
+#include "filter.h"
+
+#define ADC_CLKDIV_BURST  255                /* 25MHz/256, about 1500 samples/s */
 
 uint16_t AD_last;                            /* Last converted value          */
 uint8_t  AD_done = 0;                        /* AD conversion done flag       */
 
+static uint8_t  adc_burst;                   /* ADC_BurstStart was called     */
+static filter_t adc_filter;
+static volatile uint16_t adc_value;          /* Published FILTER_Get value    */
+static volatile uint16_t adc_ring[ADC_RING]; /* Latest raw samples            */
+static volatile uint32_t adc_count;          /* Samples taken, ring head      */
+
 /*----------------------------------------------------------------------------
   Function that initializes ADC
  *----------------------------------------------------------------------------*/
@@ -45,6 +57,52 @@ void ADC_Init (void) {
 }
 
 
+/*----------------------------------------------------------------------------
+  Convert AD0.2 continuously in the background
+ *----------------------------------------------------------------------------*/
+void ADC_BurstStart (void) {
+
+  FILTER_Init(&adc_filter);
+  adc_count = 0;
+  adc_burst = 1;
+
+  LPC_ADC->ADCR        =  ( 1 <<  2) |       /* select AD0.2 pin              */
+                          (ADC_CLKDIV_BURST << 8) |
+                          ( 1 << 16) |       /* burst mode                    */
+                          ( 1 << 21);        /* enable ADC                    */
+  LPC_ADC->ADINTEN     =  ( 1 <<  2);        /* interrupt when AD0.2 is done  */
+
+  NVIC_EnableIRQ(ADC_IRQn);                  /* enable ADC Interrupt          */
+}
+
+
+/*----------------------------------------------------------------------------
+  Smoothed AD0.2 value, 0..ADC_FILTERED_MAX. Never blocks, 0 until the
+  first block of samples is in.
+ *----------------------------------------------------------------------------*/
+uint16_t ADC_Value (void) {
+
+  return(adc_value);
+}
+
+
+/*----------------------------------------------------------------------------
+  Copy the latest 'n' (at most ADC_RING) raw samples, oldest first
+  Returns the number of samples taken so far
+ *----------------------------------------------------------------------------*/
+uint32_t ADC_Record (uint16_t *samples, uint32_t n) {
+  uint32_t end = adc_count;
+  uint32_t i;
+
+  if (n > ADC_RING) n = ADC_RING;
+  if (n > end)      n = end;
+  for (i = 0; i < n; i++) {
+    samples[i] = adc_ring[(end - n + i) & (ADC_RING - 1)];
+  }
+  return(end);
+}
+
+
 /*----------------------------------------------------------------------------
   start AD Conversion
  *----------------------------------------------------------------------------*/
@@ -82,14 +140,24 @@ uint16_t ADC_GetCnv (void) {
 /*----------------------------------------------------------------------------
   A/D IRQ: Executed when A/D Conversion is done
  *----------------------------------------------------------------------------*/
-#ifdef __ADC_IRQ
 void ADC_IRQHandler(void) {
   volatile uint32_t adstat;
+  uint16_t sample;
+
+  if (adc_burst) {
+    sample = (LPC_ADC->ADDR2 >> 4) & ADC_VALUE_MAX; /* Read clears interrupt  */
+    adc_ring[adc_count & (ADC_RING - 1)] = sample;
+    adc_count++;
+    if (FILTER_Add(&adc_filter, sample))
+      adc_value = FILTER_Get(&adc_filter);
+    return;
+  }
 
+#ifdef __ADC_IRQ
   adstat = LPC_ADC->ADSTAT;		             /* Read ADC clears interrupt     */
 
   AD_last = (LPC_ADC->ADGDR >> 4) & ADC_VALUE_MAX; /* Store converted value   */
 
   AD_done = 1;
-}
 #endif
+}
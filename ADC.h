@@ -16,7 +16,11 @@
 #ifndef __ADC_H
 #define __ADC_H
 
+#include "filter.h"
+
 #define ADC_VALUE_MAX      (0xFFF)
+#define ADC_FILTERED_MAX   (FILTER_MAX)      /* Range of ADC_Value            */
+#define ADC_RING           64                /* Raw samples kept, power of 2  */
 
 extern uint16_t AD_last;
 extern uint8_t  AD_done;
@@ -25,5 +29,8 @@ extern void     ADC_Init    (void);
 extern void     ADC_StartCnv(void);
 extern void     ADC_StopCnv (void);
 extern uint16_t ADC_GetCnv  (void);
+extern void     ADC_BurstStart(void);
+extern uint16_t ADC_Value   (void);
+extern uint32_t ADC_Record  (uint16_t *samples, uint32_t n);
 
 #endif
@@ -20,18 +20,32 @@
 #include "ADC.h"
 #include "flags.h"
 #include "JOYSTICK.h"
-#include "JOYSTICK.h"
 #include "uart.h"
 #include <math.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include "INT0.h"
+#include "TIMER0.h"
+#include "load.h"
+#include "deadline.h"
+#include "memstat.h"
+#include "pool.h"
+#include "flowfield.h"
+#include "crowd.h"
+#include "wave.h"
+#include "compose.h"
+#include "tilemap.h"
+#include "camera.h"
+#include "screen.h"
+#include "score.h"
 
 /***************** MACROS ************************/
 #define __FI        1                       /* Font index 16x24               */
 
 #define HUMAN_WIDTH		10
 #define HUMAN_HEIGHT	10
+#define HUMAN_SPEED_MIN	4 // pixels per frame with the potentiometer at 0
+#define HUMAN_SPEED_MAX	16
 
 #define GUN_WIDTH 5
 #define GUN_HEIGHT 5
@@ -58,16 +72,85 @@
 
 #define MAX_ZOMBIES 15
 #define MAX_PICKUPS 10
+#define MAX_EFFECTS 8
+
+#define CROWD_RADIUS ZOMBIE_WIDTH // zombies whose centres are closer than this overlap and push each other apart
 
 #define BOMB_RANGE 50.0
 #define BOMB_D_HEIGHT 10
 #define BOMB_D_WIDTH 10
 #define BOMB_D_AREA 100
-
+#define BOMB_ROWS 9 // bomb_map is BOMB_ROWS x BOMB_ROWS
+#define BOMB_MAX_Y 231 // explosion cells starting at this row or lower are not drawn
+
+//Effect types and their lifetime in frames
+#define EFFECT_EXPLOSION 0
+#define EFFECT_SPARKLE 1
+#define EFFECT_KILL_FLASH 2
+#define LED_PERIOD 5 // ticks between bomb LED updates
+#define MENU_DONE_EVT 0x0001 // main_menu_task to base_task: the game has started
+#define FRAME_GO_EVT 0x0001 // base_task to a frame worker: run one frame
+#define DONE_HUMAN_EVT 0x0002 // frame worker to base_task: finished this frame
+#define DONE_PICKUP_EVT 0x0004
+#define DONE_EFFECT_EVT 0x0008
+#define DONE_HORDE_EVT 0x0010
+#define DONE_COLLISION_EVT 0x0020
+#define DONE_BOMB_EVT 0x0040 // button_task to base_task: the bomb went off
+#define FRAME_WORKERS_DONE (DONE_HUMAN_EVT | DONE_PICKUP_EVT | DONE_EFFECT_EVT | DONE_HORDE_EVT)
+#define SAVE_EVT 0x0001 // base_task to save_task: the high score table changed
+
+#define EXPLOSION_FRAMES 6 // 3 frames to draw the blast, 3 to clear it
+#define SPARKLE_FRAMES 3
+#define KILL_FLASH_FRAMES 2
+
+#define TASK_STK_SIZE 300 // bytes, matches OS_STKSIZE in RTX_Conf_CM.c
+#define BASE_STK_SIZE 512 // printf for reports
+
+//Task priorities: the job with the tighter deadline runs first and round
+//robin is off. base_task releases the frame jobs and serves the serial
+//reports. Once they all reported done, collision checks the frame.
+//Two levels are shared on purpose: button_task only runs between frames
+//while base_task waits for it, so it never competes with human_task, and
+//horde and pickups make up one job (job_sim) and run one after the other.
+#define PRIO_MENU 13 // one shot, holds the game until the button
+#define PRIO_BASE 12 // frame release, camera, compose, telemetry
+#define PRIO_INPUT 11 // human, bomb
+#define PRIO_SIM 10 // horde, pickups
+#define PRIO_RENDER 9 // effects
+#define PRIO_FRAME_END 8 // collision, then the next frame may start
+#define PRIO_LED 7
+#define PRIO_SAVE 2 // flash writes, only once nothing else wants the CPU
+
+#define TICK_US 10000 // OS_TICK in RTX_Conf_CM.c
+#define FRAME_BUDGET_US 100000 // frame jobs must finish within the frame period
+#define FRAME_TICKS (FRAME_BUDGET_US / TICK_US)
+#define SIM_BUDGET_US 60000 // horde and pickups
+#define INPUT_BUDGET_US 20000
+#define RENDER_BUDGET_US 40000 // camera strip and compose in base_task
+#define EFFECT_BUDGET_US 50000
 
 
 #undef PRINT_ENABLE
 #undef PRINT_ENABLE_LOOPS
+#undef USE_BACKBUFFER // compose the whole frame in base_task instead of drawing from every task
+#define JOY_SUBTICK // move for the part of the frame a direction was held, not a whole step
+
+#define PLAYFIELD_COLOR 0x8C71
+#define EXPLOSION_ALPHA 20 // of GLCD_ALPHA_MAX, the floor shows through the blast
+
+#ifdef USE_BACKBUFFER
+#define DRAW_BITMAP(x, y, w, h, map) // drawn by compose_scene()
+#define BLEND_BITMAP(x, y, w, h, map, alpha) // opaque in compose_scene()
+#define ERASE_RECT(x, y, w, h)
+#define DRAW_RING(x, y, r, color) // the compositor only takes bitmaps, the blast shows the radius alone
+#define CAMERA_STEP CMP_TILE // the compositor keeps whole tiles in GRAM
+#else
+#define DRAW_BITMAP(x, y, w, h, map) CAM_Bitmap(x, y, w, h, (const unsigned short *)(map)) // world coordinates
+#define BLEND_BITMAP(x, y, w, h, map, alpha) CAM_Blend(x, y, w, h, (const unsigned short *)(map), alpha)
+#define ERASE_RECT(x, y, w, h) TM_Restore(x, y, w, h) // put the background tiles back
+#define DRAW_RING(x, y, r, color) CAM_Circle(x, y, r, color) // world coordinates, one window per outline run
+#define CAMERA_STEP 1
+#endif
 
 
 
@@ -80,6 +163,7 @@ typedef struct {
 	int y_pos;
 	int bombs;
 	int speed;
+	uint8_t facing; // FF_* direction of the last move, FF_NONE when standing still
 } human_t;
 
 
@@ -87,6 +171,8 @@ typedef struct {
 	uint16_t x_pos;
 	uint16_t y_pos;
 	uint8_t arm_positions;
+	int8_t x_push; // separation step from crowd_separation()
+	int8_t y_push;
 	float speed;
 } zombie_t;
 
@@ -97,11 +183,30 @@ typedef struct {
 } pickup_t;
 
 
+//Transient effect, advanced one step per frame by effect_task
+typedef struct {
+	uint8_t type;
+	uint8_t frame;
+	int16_t x_pos;
+	int16_t y_pos;
+} effect_t;
+
+
+//Game state of one frame. The workers read the last finished frame and
+//each writes only its own part of the next one
+typedef struct {
+	human_t human; // human_task, except bombs: pickup_task
+	zombie_t zombies[MAX_ZOMBIES]; // horde_task
+	short num_zombies;
+	pickup_t collected[MAX_PICKUPS]; // pickup_task: taken this frame, to sparkle
+	short num_collected;
+} world_t;
+
+
 /****************** GLOBAL VARIABLES *******************/
 //BITMAPS
 unsigned short human_map[HUMAN_AREA];
 unsigned short gun_map[GUN_AREA];
-unsigned short clear_rect_map[CLEAR_AREA]; // change this to clear human/gun/zombie
 unsigned short z_arm_map[Z_ARM_AREA];
 unsigned short z_body_map[Z_BODY_AREA];
 unsigned short zombie_map[ZOMBIE_AREA];
@@ -116,137 +221,378 @@ unsigned short bomb_map[] = {0,0,1,1,1,1,1,0,0,
 														 0,1,1,2,2,2,1,1,0,
 														 0,0,1,1,1,1,1,0,0};
 
-unsigned short hand_map[] = {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1123,0x8E2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x881,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x861,0x19E4,0x00,0x2265,0x5E6E,0x44CB,0x00,0x00,0x3388,0x00,0x22A6,0x2265,0x00,0x2265,0x562E,0x4DAD,0x1163,0x00,0x19C4,0x2286,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19E4,0x450B,0x19C4,0x2B47,0x564E,0x4D8C,0x00,0x2265,0x562E,0x861,0x44AA,0x562E,0x00,0x3C29,0x5E6E,0x5E6E,0x2B47,0x00,0x4DAD,0x4D4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E2,0x44CB,0x3C29,0x4DAD,0x564E,0x450B,0x00,0x448A,0x562E,0x1123,0x450B,0x4D4C,0x8E2,0x4D4C,0x564E,0x564E,0x44CB,0x00,0x4DAD,0x4D4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x450B,0x564E,0x564E,0x562E,0x4D8C,0x8E2,0x4D8C,0x5E6E,0x3C29,0x4D4C,0x3368,0x2265,0x5E6E,0x562E,0x562E,0x562E,0x19C4,0x44CB,0x4D4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C29,0x5E6E,0x562E,0x562E,0x564E,0x3388,0x44CB,0x562E,0x5E6E,0x4D4C,0x1102,0x44CB,0x564E,0x562E,0x562E,0x564E,0x448A,0x3C29,0x55ED,0x881,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B27,0x564E,0x562E,0x562E,0x562E,0x564E,0x560D,0x564E,0x4D4C,0x33C9,0x450B,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x4D4C,0x4DAD,0x861,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19C4,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x560D,0x564E,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x450B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C2,0x55ED,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x448A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D4C,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x33C9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C29,0x5E6E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x2B27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B27,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x2265,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2265,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x19E4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2286,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x5E8F,0x1A05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2AC6,0x5E6E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x55ED,0x450B,0x3C29,0x2B47,0x3C6A,0x3368,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B27,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x4DAD,0x2AE7,0x19E4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44CB,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x55ED,0x1163,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2AE7,0x5E6E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x44CB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E2,0x55ED,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x5E8F,0x22A6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C6A,0x5E6E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x450B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2265,0x5E6E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x19E4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x861,0x4DAD,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x33C9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3BE9,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x4D4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1984,0x562E,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x1984,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C6A,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x5E6E,0x2B27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x450B,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x448A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A1,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x4DAD,0x861,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19E4,0x5E6E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x1984,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B27,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x2B27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C6A,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x3C6A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D4C,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x19E4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C2,0x560D,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x4DAD,0x1163,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A05,0x5E6E,0x562E,0x562E,0x562E,0x564E,0x564E,0x4D4C,0x560D,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x560D,0x2225,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B27,0x5E8F,0x562E,0x562E,0x55ED,0x450B,0x562E,0x2265,0x3C6A,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x5E6E,0x564E,0x2B47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C6A,0x5E6E,0x562E,0x55ED,0x448A,0x2225,0x19E4,0x881,0x1163,0x560D,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x55ED,0x44CB,0x3C6A,0x55ED,0x5E6E,0x448A,0x8A1,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D8C,0x562E,0x562E,0x562E,0x564E,0x564E,0x3BE9,0x00,0x00,0x3388,0x5E6E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x2AC6,0x450B,0x2B27,0x3388,0x3C29,0x44AA,0x564E,0x5E8F,0x3C29,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x861,0x55ED,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x1163,0x00,0x1A05,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x448A,0x8E2,0x3C29,0x5E8F,0x564E,0x562E,0x562E,0x564E,0x44CB,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B47,0x564E,0x562E,0x562E,0x562E,0x562E,0x564E,0x2265,0x00,0x19E4,0x5E8F,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x2AC6,0x450B,0x564E,0x562E,0x562E,0x562E,0x5E8F,0x3C6A,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D4C,0x564E,0x562E,0x562E,0x562E,0x5E6E,0x2B27,0x00,0x19E4,0x5E6E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x55ED,0x55ED,0x562E,0x562E,0x562E,0x564E,0x4D4C,0x2B27,0x5E6E,0x5E6E,0x564E,0x564E,0x3C6A,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A05,0x564E,0x562E,0x562E,0x562E,0x564E,0x19E4,0x00,0x2225,0x564E,0x562E,0x562E,0x562E,0x562E,0x562E,0x562E,0x564E,0x562E,0x562E,0x564E,0x44AA,0x448A,0x5E8F,0x560D,0x564E,0x564E,0x564E,0x2B27,0x19E4,0x3388,0x3C6A,0x1A05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C6A,0x5E6E,0x562E,0x564E,0x560D,0x8E2,0x00,0x2265,0x564E,0x562E,0x562E,0x562E,0x564E,0x4D4C,0x1163,0x33C9,0x562E,0x562E,0x562E,0x55ED,0x3368,0x3C29,0x2265,0x3388,0x4D4C,0x564E,0x4D4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E2,0x55ED,0x560D,0x4DAD,0x448A,0x00,0x00,0x2265,0x564E,0x564E,0x562E,0x562E,0x564E,0x2B47,0x00,0x00,0x44CB,0x564E,0x562E,0x55ED,0x2265,0x44AA,0x560D,0x4D4C,0x3C29,0x55ED,0x564E,0x1163,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E2,0x8E2,0x00,0x00,0x00,0x00,0x2265,0x564E,0x562E,0x564E,0x564E,0x564E,0x1984,0x00,0x00,0x19E4,0x562E,0x564E,0x44CB,0x44AA,0x5E6E,0x562E,0x564E,0x562E,0x562E,0x564E,0x2265,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2265,0x5E6E,0x55ED,0x3368,0x2B27,0x450B,0x8A1,0x00,0x00,0x00,0x448A,0x5E8F,0x3C6A,0x3C6A,0x564E,0x562E,0x562E,0x562E,0x562E,0x564E,0x1163,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2265,0x564E,0x55ED,0x4D4C,0x3C29,0x19C4,0x00,0x00,0x00,0x00,0x2B27,0x5E6E,0x55ED,0x3C6A,0x3C6A,0x55ED,0x564E,0x562E,0x5E6E,0x33C9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22A6,0x564E,0x562E,0x564E,0x5E8F,0x33C9,0x00,0x00,0x00,0x00,0x2225,0x5E8F,0x564E,0x5E6E,0x4D4C,0x3C29,0x44CB,0x560D,0x4D4C,0x8A1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2AE7,0x5E8F,0x562E,0x562E,0x564E,0x44CB,0x00,0x00,0x00,0x00,0x1123,0x44AA,0x3C6A,0x4D4C,0x562E,0x564E,0x3388,0x8A1,0x8E2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19E4,0x5E6E,0x562E,0x3C29,0x2265,0x1102,0x00,0x00,0x00,0x00,0x8C2,0x3C6A,0x4D8C,0x55ED,0x562E,0x564E,0x3BE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A1,0x55ED,0x55ED,0x4D4C,0x560D,0x44CB,0x8A1,0x00,0x00,0x00,0x2B47,0x5E8F,0x562E,0x562E,0x562E,0x564E,0x2AC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44AA,0x564E,0x564E,0x562E,0x5E6E,0x1A05,0x00,0x00,0x00,0x4D4C,0x562E,0x562E,0x562E,0x562E,0x564E,0x1984,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B27,0x5E8F,0x562E,0x562E,0x5E8F,0x2B27,0x00,0x00,0x8E2,0x560D,0x564E,0x562E,0x562E,0x564E,0x55ED,0x8A1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A1,0x4D8C,0x5E8F,0x5E8F,0x4D8C,0x1102,0x00,0x00,0x19E4,0x564E,0x564E,0x562E,0x564E,0x564E,0x2AC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1163,0x3388,0x2B47,0x1102,0x00,0x00,0x00,0x00,0x22A6,0x4D4C,0x4DAD,0x4DAD,0x2B47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-unsigned short skull_map[] = {0x0,0x0,0x8C51,0x9492,0x861,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xA514,0x8430,0x0,0x0,
-0x0,0x18E3,0x8C51,0x52AA,0x8430,0x1082,0x0,0x0,0x4A69,0x738E,0x738E,0x4A69,0x0,0x0,0x18E3,0x8C51,0x4A69,0x9492,0x1082,0x0,
-0x0,0x9CF3,0x4A69,0x861,0x52AA,0x9492,0x630C,0x9492,0x6B6D,0x39E7,0x31A6,0x6B6D,0x9492,0x630C,0x9492,0x4A69,0x1082,0x5ACB,0x8C51,0x0,
-0x0,0x630C,0x8C51,0x9492,0x7BCF,0x31A6,0xAD75,0x4228,0x2104,0x39E7,0x4228,0x2104,0x4228,0xAD75,0x31A6,0x8430,0x9492,0x8C51,0x5ACB,0x0,
-0x0,0x0,0x0,0x0,0x39E7,0x8C51,0xA514,0x738E,0xB596,0xAD75,0xB596,0xB596,0x6B6D,0xAD75,0x8430,0x2965,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x1082,0x6B6D,0xBDD7,0xA514,0xB596,0x9CF3,0x9CF3,0xAD75,0xA514,0xBDD7,0x738E,0x1082,0x0,0x0,0x0,0x0,
-0x0,0x1082,0x18E3,0x738E,0x9492,0x52AA,0xBDD7,0xBDD7,0x39E7,0x18E3,0x18E3,0x4228,0xB596,0xBDD7,0x52AA,0x9492,0x738E,0x18E3,0x1082,0x0,
-0x9492,0x8C51,0x8C51,0x4A69,0x31A6,0xA514,0xEF5D,0x6B6D,0x2104,0x9CF3,0x9CF3,0x18E3,0x7BCF,0xF7BE,0x9CF3,0x39E7,0x4A69,0x9492,0x8C51,0x9492,
-0x9492,0x2965,0x1082,0x8430,0xB596,0xB596,0x2104,0x0,0x31A6,0xDF1B,0xDF1B,0x2965,0x0,0x2104,0xBDD7,0xAD75,0x83EF,0x861,0x31A6,0x9492,
-0x2965,0x8430,0x8430,0x39E7,0x630C,0x31A6,0x4228,0x9492,0x18E3,0x9492,0x9492,0x18E3,0x9492,0x31A6,0x4228,0x52AA,0x4228,0x8430,0x8430,0x2965,
-0x800,0x9492,0x6B6D,0x0,0x630C,0x52AA,0xD6BA,0xFFFF,0xA514,0x0,0x0,0xB596,0xFFFF,0xD6BA,0x630C,0x5ACB,0x0,0x630C,0x8C51,0x0,
-0x0,0x0,0x0,0x0,0xB596,0x9492,0xFFFF,0xFFFF,0xFFFF,0x18E3,0x2965,0xFFFF,0xFFFF,0xF7BE,0x9CF3,0xAD75,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x4A69,0x9CF3,0x6B6D,0x4228,0x8430,0x8430,0x861,0x861,0x8430,0x8430,0x4228,0x738E,0x9CF3,0x39E7,0x0,0x0,0x0,
-0x0,0x0,0x0,0x738E,0x7BCF,0x4A69,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5ACB,0x8430,0x6B6D,0x0,0x0,0x0,
-0x0,0x0,0x0,0x7BCF,0x9492,0x2965,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31A6,0x8C51,0x7BCF,0x0,0x0,0x0,
-0x0,0x0,0x0,0x7BCF,0x630C,0x18E3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0x5ACB,0x7BCF,0x0,0x0,0x0,
-0x0,0x0,0x0,0x52AA,0x630C,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x630C,0x52AA,0x0,0x0,0x0,
-0x0,0x0,0x0,0x861,0x9492,0x2965,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2965,0x9CF3,0x861,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x2104,0x9CF3,0x630C,0x1082,0x0,0x0,0x0,0x0,0x18E3,0x5ACB,0x9CF3,0x2104,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x861,0x630C,0x9492,0x8C51,0x83EF,0x8430,0x9492,0x9492,0x630C,0x1061,0x0,0x0,0x800,0x800,0x2800
-};
-
-unsigned short bomb_w_map[BOMB_D_AREA];
 unsigned short bomb_r_map[BOMB_D_AREA];
 unsigned short bomb_o_map[BOMB_D_AREA]; 
 unsigned short bomb_y_map[BOMB_D_AREA]; 
 
 //VARIABLES
 
-volatile zombie_t zombies_array[MAX_ZOMBIES];
-OS_TID zombie_tasks[MAX_ZOMBIES]; //Task IDs for each zombie_task
-volatile human_t human;
-volatile short num_zombies = 0;
-volatile pickup_t pickups_array[MAX_PICKUPS]; 
-short num_pickups = 0;
+world_t worlds[2];
+world_t *world = &worlds[0]; // last finished frame, only base_task writes it between frames
+world_t *world_next = &worlds[1]; // frame the workers are building
+pickup_t pickup_items[MAX_PICKUPS];
+pool_t pickups_pool;
+effect_t effect_items[MAX_EFFECTS];
+pool_t effects_pool;
+const uint8_t effect_frames[] = {EXPLOSION_FRAMES, SPARKLE_FRAMES, KILL_FLASH_FRAMES};
 volatile bool can_bomb = false;
 volatile bool game_playing = true;
 volatile short zombies_killed = 0;
 														 
-float max_zombie_speed = 3.0;				
-float min_zombie_speed = 2.0;		
+U16 wave_frame = 0; //Frames since the current wave started
+U32 frames_played = 0;
 
 //MUTEXES AND SEMAPHORES
 
-	//Variable Mutexes
-	OS_MUT human_mut; // 'human'
-	OS_MUT zombies_mut; // 'zombies_array'
-	OS_MUT num_zombies_mut; // 'num_zombies'
-	OS_MUT pickups_mut;
+	//The game state needs no mutex: world/world_next split it by frame, the
+	//pickup and effect pools belong to their task while a frame runs and to
+	//base_task between frames
 	
 	//Peripheral Mutexes
 	OS_MUT LED_mut; 
-	OS_MUT joystick_mut;
 	OS_MUT GLCD_mut;
 	
-	//Semaphores to block tasks
-	OS_SEM human_task_sem; // ' human_task'
-	OS_SEM zombie_task_sem[MAX_ZOMBIES]; // 'zombie_task'
+	//Semaphores to block tasks, the frame workers wait on FRAME_GO_EVT
 	OS_SEM button_sem;
-	OS_SEM pickup_task_sem;
-	OS_SEM collision_detect_sem;
-	OS_SEM iteration_sem;
 	
 
 //TASKS
 
-OS_TID pickup_tsk, human_tsk, button_tsk, led_tsk, collision_tsk;
+OS_TID base_tsk, pickup_tsk, human_tsk, button_tsk, led_tsk, collision_tsk, effect_tsk, horde_tsk, save_tsk;
+
+//Task stacks, painted at creation so their high-water marks can be reported
+MEM_STACK(base_stk, BASE_STK_SIZE);
+MEM_STACK(menu_stk, TASK_STK_SIZE);
+MEM_STACK(human_stk, TASK_STK_SIZE);
+MEM_STACK(button_stk, TASK_STK_SIZE);
+MEM_STACK(pickup_stk, TASK_STK_SIZE);
+MEM_STACK(led_stk, TASK_STK_SIZE);
+MEM_STACK(collision_stk, TASK_STK_SIZE);
+MEM_STACK(effect_stk, TASK_STK_SIZE);
+MEM_STACK(horde_stk, TASK_STK_SIZE);
+MEM_STACK(save_stk, TASK_STK_SIZE);
 	
 //Score related
-char killed[3];
+char killed[21]; // one line of the 16x24 font
+
+//Deadline accounting, reported on 'd'
+dl_job_t job_frame = DL_JOB("frame", FRAME_BUDGET_US);
+dl_job_t job_input = DL_JOB("input", INPUT_BUDGET_US);
+dl_job_t job_sim = DL_JOB("sim", SIM_BUDGET_US);
+dl_job_t job_render = DL_JOB("render", RENDER_BUDGET_US);
+dl_job_t job_effect = DL_JOB("effect", EFFECT_BUDGET_US);
+dl_job_t job_led = DL_JOB("led", LED_PERIOD * TICK_US);
+dl_job_t *const jobs[] = { &job_frame, &job_input, &job_sim, &job_render, &job_effect, &job_led };
 
 /******************* FUNCTIONS *********************/
 
-//returns quadrant that the human is in
-// (320, 0)         (320,230)
+extern int checkkey(void); // Retarget.c
+
+//Paints a task stack and creates the task on it
+OS_TID task_create(void (*task)(void *), U8 priority, const char *name, U64 *stk, U16 size, void *argv){
+	MEM_StackPaint(name, stk, size);
+	return os_tsk_create_user_ex(task, priority, stk, size, argv);
+}
+
+//Prints the LCD bus traffic per frame
+void lcd_report(void){
+	const GLCD_STATS *stats = GLCD_Stats();
+	U32 frames = frames_played ? frames_played : 1;
+	
+	printf("--- LCD bus (%u frames) ---\n", frames_played);
+	printf("bytes/frame   %u\n", stats->bytes / frames);
+	printf("windows/frame %u\n", stats->windows / frames);
+	printf("reg writes    %u sent, %u skipped by the shadow\n", stats->reg_writes, stats->reg_skipped);
+	printf("glyph cache   %u hits, %u misses\n", stats->glyph_hits, stats->glyph_misses);
+}
+
+//Prints how long joystick edges wait before the human task sees them,
+//and what the button debounce let through
+void joy_report(void){
+	const joy_stats_t *stats = JOYSTICK_Stats();
+	const int0_stats_t *button = INT0_Stats();
+	
+	printf("--- Joystick ---\n");
+	printf("events        %u, %u dropped\n", stats->events, stats->dropped);
+	printf("latency us    %u avg, %u max\n", stats->events ? stats->latency_sum / stats->events : 0, stats->latency_max);
+	printf("ticks missed  %u\n", TIMER0_Missed());
+	printf("button        %u presses, %u bounces, %u dropped\n", button->presses, button->bounces, button->dropped);
+}
+
+//Prints the latest raw potentiometer samples, a stream to replay through
+//the filter, and the smoothed value the human speed comes from
+void adc_report(void){
+	static uint16_t samples[ADC_RING]; // not on the 512 byte base stack
+	uint32_t taken = ADC_Record(samples, ADC_RING);
+	uint32_t i, n = taken < ADC_RING ? taken : ADC_RING;
+	
+	printf("--- ADC (%u samples) ---\n", taken);
+	for(i = 0; i < n; i++){
+		printf("%u%c", samples[i], (i % 16 == 15 || i == n - 1) ? '\n' : ' ');
+	}
+	printf("filtered      %u of %u\n", ADC_Value(), ADC_FILTERED_MAX);
+}
+
+//Handles single character report requests from the serial port
+void serial_commands(void){
+	switch(checkkey()){
+		case 'm':
+			MEM_Report();
+			break;
+		case 'w':
+			WAVE_Report(WAVE_Stats()->wave, WAVE_Stats()->wave + 4);
+			break;
+		case 't':
+			TM_Report(frames_played);
+			break;
+		case 'l':
+			lcd_report();
+			break;
+		case 'j':
+			joy_report();
+			break;
+		case 'a':
+			adc_report();
+			break;
+		case 'd':
+			DL_Report(jobs, sizeof(jobs) / sizeof(jobs[0]));
+			break;
+		case 'c':
+			printf("cpu load      %u/%u\n", LOAD_Get(), LOAD_FULL);
+			break;
+		case 's':
+			SCORE_Report();
+			break;
+#ifdef USE_BACKBUFFER
+		case 'b':
+			CMP_Report();
+			break;
+#endif
+	}
+}
+
+//Starts a new effect at the given position
+//Returns false if all effect slots are in use
+bool effect_spawn(uint8_t type, int x, int y){
+	effect_t *effect;
+	
+	//Only called between frames, effect_task is idle
+	effect = POOL_Alloc(&effects_pool);
+	if(effect != NULL){
+		effect->type = type;
+		effect->frame = 0;
+		effect->x_pos = x;
+		effect->y_pos = y;
+	}
+	
+	return effect != NULL;
+}
+
+//Draws (or clears) rows [first, last) of the explosion pattern around the human position (x, y)
+void draw_explosion_rows(int x, int y, int first, int last, bool clear){
+	int i;
+	int x_pos, y_pos;
+	unsigned short *map;
+	
+	for (i = first * BOMB_ROWS; i < last * BOMB_ROWS ; i++){
+		x_pos = x - (int)BOMB_RANGE + BOMB_D_WIDTH*(i%BOMB_ROWS+1);
+		y_pos = y - (int)BOMB_RANGE + BOMB_D_HEIGHT*(i/BOMB_ROWS+1);
+		if(y_pos >= BOMB_MAX_Y)
+			continue;
+		
+		if (clear || bomb_map[i] == 0){
+			ERASE_RECT(x_pos, y_pos, BOMB_D_WIDTH, BOMB_D_HEIGHT);
+			continue;
+		}
+		if (bomb_map[i] == 1)
+			map = bomb_r_map;
+		else if (bomb_map[i] == 2)
+			map = bomb_o_map;
+		else
+			map = bomb_y_map;
+		BLEND_BITMAP(x_pos, y_pos, BOMB_D_WIDTH, BOMB_D_HEIGHT, map, EXPLOSION_ALPHA);
+	}
+}
+
+//Draws (or clears) the outline of the bomb's kill radius, the circle button_task searches
+void draw_bomb_ring(int x, int y, bool clear){
+	int cx = x + HUMAN_WIDTH/2, cy = y + HUMAN_HEIGHT/2, r = (int)BOMB_RANGE;
+	int x0 = x - (int)BOMB_RANGE + BOMB_D_WIDTH, x1 = x0 + BOMB_ROWS * BOMB_D_WIDTH;
+	int y0 = y - (int)BOMB_RANGE + BOMB_D_HEIGHT, y1 = y0 + BOMB_ROWS * BOMB_D_HEIGHT;
+	
+	if(!clear){
+		DRAW_RING(cx, cy, r, Yellow);
+		return;
+	}
+	
+	//Clearing the blast rows put the floor back inside [x0, x1) x [y0, y1), only the rim sticks out of it.
+	//The cells left out below BOMB_MAX_Y count as rim
+	if(y1 > BOMB_MAX_Y)
+		y1 = BOMB_MAX_Y;
+	ERASE_RECT(cx - r, cy - r, 2*r + 1, y0 - (cy - r));
+	ERASE_RECT(cx - r, y1, 2*r + 1, cy + r + 1 - y1);
+	ERASE_RECT(cx - r, y0, x0 - (cx - r), y1 - y0);
+	ERASE_RECT(x1, y0, cx + r + 1 - x1, y1 - y0);
+}
+
+//Draws the current frame of an effect
+//Returns true once the effect has finished
+bool effect_render(effect_t *effect){
+	int third = BOMB_ROWS / 3;
+	
+	switch(effect->type){
+		case EFFECT_EXPLOSION:
+			if(effect->frame < 3)
+				draw_explosion_rows(effect->x_pos, effect->y_pos, effect->frame * third, (effect->frame + 1) * third, false);
+			else
+				draw_explosion_rows(effect->x_pos, effect->y_pos, (effect->frame - 3) * third, (effect->frame - 2) * third, true);
+			//The ring goes on top of the finished blast and comes off with its last rows
+			if(effect->frame == 2)
+				draw_bomb_ring(effect->x_pos, effect->y_pos, false);
+			else if(effect->frame == EXPLOSION_FRAMES - 1)
+				draw_bomb_ring(effect->x_pos, effect->y_pos, true);
+			break;
+		
+		case EFFECT_SPARKLE:
+			if(effect->frame == 0)
+				DRAW_BITMAP(effect->x_pos, effect->y_pos, PICKUP_WIDTH, PICKUP_HEIGHT, (unsigned char *)bomb_y_map);
+			else if(effect->frame == 1)
+				DRAW_BITMAP(effect->x_pos + 2, effect->y_pos + 2, PICKUP_WIDTH - 4, PICKUP_HEIGHT - 4, (unsigned char *)bomb_o_map);
+			else
+				ERASE_RECT(effect->x_pos, effect->y_pos, PICKUP_WIDTH, PICKUP_HEIGHT);
+			break;
+		
+		case EFFECT_KILL_FLASH:
+			if(effect->frame == 0)
+				BLEND_BITMAP(effect->x_pos, effect->y_pos, Z_BODY_WIDTH, Z_BODY_HEIGHT, bomb_r_map, GLCD_BLEND_ADD);
+			else
+				ERASE_RECT(effect->x_pos, effect->y_pos, Z_BODY_WIDTH, Z_BODY_HEIGHT);
+			break;
+	}
+	
+	effect->frame++;
+	return effect->frame >= effect_frames[effect->type];
+}
+
+#ifdef USE_BACKBUFFER
+//Arm offsets {x1, y1, x2, y2} inside the zombie box for each FF_* heading
+const uint8_t zombie_arm_offsets[9][4] = {
+	{0, 0, 0, Z_ARM_HEIGHT+Z_BODY_HEIGHT},                                                      // standing
+	{Z_ARM_WIDTH+Z_BODY_WIDTH, 0, Z_ARM_WIDTH+Z_BODY_WIDTH, Z_ARM_HEIGHT+Z_BODY_HEIGHT},          // E
+	{Z_ARM_WIDTH+Z_BODY_WIDTH, Z_ARM_HEIGHT+Z_BODY_HEIGHT/4, Z_ARM_WIDTH+Z_BODY_WIDTH/4, Z_ARM_HEIGHT+Z_BODY_HEIGHT}, // SE
+	{Z_ARM_WIDTH+Z_BODY_WIDTH, Z_ARM_HEIGHT+Z_BODY_HEIGHT, 0, Z_ARM_HEIGHT+Z_BODY_HEIGHT},       // S
+	{0, Z_ARM_HEIGHT+Z_BODY_HEIGHT/4, Z_ARM_WIDTH+Z_BODY_WIDTH/4, Z_ARM_HEIGHT+Z_BODY_HEIGHT},   // SW
+	{0, 0, 0, Z_ARM_HEIGHT+Z_BODY_HEIGHT},                                                      // W
+	{Z_ARM_WIDTH+Z_BODY_WIDTH/4, 0, 0, Z_ARM_HEIGHT+Z_BODY_HEIGHT/4},                           // NW
+	{Z_ARM_WIDTH+Z_BODY_WIDTH, 0, 0, 0},                                                        // N
+	{Z_ARM_WIDTH+Z_BODY_WIDTH/4, 0, Z_ARM_WIDTH+Z_BODY_WIDTH, Z_ARM_HEIGHT+Z_BODY_HEIGHT/4}      // NE
+};
+
+//Gun offset {x, y} from the human for each FF_* facing, none while standing
+const int8_t gun_offsets[9][2] = {
+	{0, 0},
+	{HUMAN_WIDTH, GUN_HEIGHT/2},      // E
+	{HUMAN_WIDTH, HUMAN_HEIGHT},      // SE
+	{GUN_WIDTH/2, HUMAN_HEIGHT},      // S
+	{-GUN_WIDTH, HUMAN_HEIGHT},       // SW
+	{-GUN_WIDTH, GUN_HEIGHT/2},       // W
+	{-GUN_WIDTH, -GUN_HEIGHT},        // NW
+	{GUN_WIDTH/2, -GUN_HEIGHT},       // N
+	{HUMAN_WIDTH, -GUN_HEIGHT}        // NE
+};
+
+//Adds the visible part of an effect to the frame
+void effect_compose(const effect_t *effect){
+	int third = BOMB_ROWS / 3;
+	int first, last, i;
+	unsigned short *map;
+	
+	switch(effect->type){
+		case EFFECT_EXPLOSION:
+			//Rows grow in over the first three frames and clear over the last three
+			first = (effect->frame >= 3) ? (effect->frame - 2) * third : 0;
+			last = (effect->frame < 2) ? (effect->frame + 1) * third : BOMB_ROWS;
+			for(i = first * BOMB_ROWS; i < last * BOMB_ROWS; i++){
+				if(bomb_map[i] == 0)
+					continue;
+				else if(bomb_map[i] == 1)
+					map = bomb_r_map;
+				else if(bomb_map[i] == 2)
+					map = bomb_o_map;
+				else
+					map = bomb_y_map;
+				CMP_Bitmap(effect->x_pos - (int)BOMB_RANGE + BOMB_D_WIDTH*(i%BOMB_ROWS+1),
+					effect->y_pos - (int)BOMB_RANGE + BOMB_D_HEIGHT*(i/BOMB_ROWS+1), BOMB_D_WIDTH, BOMB_D_HEIGHT, map);
+			}
+			break;
+		
+		case EFFECT_SPARKLE:
+			if(effect->frame == 0)
+				CMP_Bitmap(effect->x_pos, effect->y_pos, PICKUP_WIDTH, PICKUP_HEIGHT, bomb_y_map);
+			else if(effect->frame == 1)
+				CMP_Bitmap(effect->x_pos + 2, effect->y_pos + 2, PICKUP_WIDTH - 4, PICKUP_HEIGHT - 4, bomb_o_map);
+			break;
+		
+		case EFFECT_KILL_FLASH:
+			if(effect->frame == 0)
+				CMP_Bitmap(effect->x_pos, effect->y_pos, Z_BODY_WIDTH, Z_BODY_HEIGHT, bomb_r_map);
+			break;
+	}
+}
+
+//Builds the whole frame from the game state and uploads the tiles that changed
+void compose_scene(void){
+	int i;
+	zombie_t local_zombie;
+	human_t local_human;
+	pickup_t *pickup;
+	effect_t *effect;
+	const uint8_t *arms;
+	int col, row;
+	
+	//Tiles the level changed are uploaded whole
+	os_mut_wait(&GLCD_mut, 0xffff);
+	while(TM_NextDirty(&col, &row))
+		CMP_InvalidateTile(col, row);
+	os_mut_release(&GLCD_mut);
+	
+	CMP_Begin();
+	
+	for(i=0; i<MAX_PICKUPS; i++){
+		pickup = POOL_Item(&pickups_pool, i);
+		if(pickup != NULL)
+			CMP_Bitmap(pickup->x_pos, pickup->y_pos, PICKUP_WIDTH, PICKUP_HEIGHT, pickup_map);
+	}
+	
+	for(i=0; i<world->num_zombies; i++){
+		local_zombie = world->zombies[i];
+		
+		arms = zombie_arm_offsets[local_zombie.arm_positions];
+		CMP_Bitmap(local_zombie.x_pos + Z_ARM_WIDTH, local_zombie.y_pos + Z_ARM_HEIGHT, Z_BODY_WIDTH, Z_BODY_HEIGHT, z_body_map);
+		CMP_Bitmap(local_zombie.x_pos + arms[0], local_zombie.y_pos + arms[1], Z_ARM_WIDTH, Z_ARM_HEIGHT, z_arm_map);
+		CMP_Bitmap(local_zombie.x_pos + arms[2], local_zombie.y_pos + arms[3], Z_ARM_WIDTH, Z_ARM_HEIGHT, z_arm_map);
+	}
+	
+	local_human = world->human;
+	
+	CMP_Bitmap(local_human.x_pos, local_human.y_pos, HUMAN_WIDTH, HUMAN_HEIGHT, human_map);
+	if(local_human.facing != FF_NONE)
+		CMP_Bitmap(local_human.x_pos + gun_offsets[local_human.facing][0], local_human.y_pos + gun_offsets[local_human.facing][1], GUN_WIDTH, GUN_HEIGHT, gun_map);
+	
+	for(i=0; i<MAX_EFFECTS; i++){
+		effect = POOL_Item(&effects_pool, i);
+		if(effect != NULL)
+			effect_compose(effect);
+	}
+	
+	os_mut_wait(&GLCD_mut, 0xffff);
+	CMP_Flush();
+	os_mut_release(&GLCD_mut);
+}
+#endif
+
+//returns quadrant of the world that the human is in
+// (640, 0)         (640,240)
 // X----------------X
 // |				|				|
 // |				|				| 
@@ -261,52 +607,54 @@ char killed[3];
 // X----------------X
 // (0,0)            (0, 240)
 short get_human_quadrant(void){
-	human_t local_human;
+	human_t local_human = world->human;
 	
-	os_mut_wait(&human_mut, 0xffff);
-	local_human = human;
-	os_mut_release(&human_mut);
-	
-	if(local_human.x_pos <= 160)
-		if(local_human.y_pos <= 120)
+	if(local_human.x_pos <= CAM_WORLD_W/2)
+		if(local_human.y_pos <= CAM_WORLD_H/2)
 			return 1;
 		else
 			return 4;
 	else
-		if(local_human.y_pos <= 120)
+		if(local_human.y_pos <= CAM_WORLD_H/2)
 			return 2;
 		else
 			return 3;
 	
 }
 
-//Initializes a zombie
+//Initializes a zombie in the next free slot
+//corner is a WAVE_* spawn corner relative to the human's quadrant
 //Returns the index of the new zombie, or -1 if the maximum number of zombies are on screen
-signed int zombie_init(void){
+signed int zombie_init(float speed, uint8_t corner){
 		short local_num_zombies;
-		local_num_zombies = num_zombies;
-		if(num_zombies < MAX_ZOMBIES){
+		zombie_t *zombie;
+		local_num_zombies = world->num_zombies;
+		if(local_num_zombies < MAX_ZOMBIES){
 			short quadrant = get_human_quadrant();
+			bool far_x = (quadrant == 1 || quadrant == 4);
+			bool far_y = (quadrant == 1 || quadrant == 2);
+			
+			if(corner == WAVE_ADJACENT_X) far_y = !far_y;
+			if(corner == WAVE_ADJACENT_Y) far_x = !far_x;
 			
-			os_mut_wait(&zombies_mut, 0xffff);
+			zombie = &world->zombies[local_num_zombies];
 			//Spawn zombie in appropriate corner
-				if(quadrant == 1 || quadrant == 4)
-					zombies_array[num_zombies].x_pos = 290;
+				if(far_x)
+					zombie->x_pos = CAM_WORLD_W - 30;
 				else
-					zombies_array[num_zombies].x_pos = 20;
-				if(quadrant == 1 || quadrant == 2)
-					zombies_array[num_zombies].y_pos = 210;
+					zombie->x_pos = 20;
+				if(far_y)
+					zombie->y_pos = 210;
 				else
-					zombies_array[num_zombies].y_pos = 20;
+					zombie->y_pos = 20;
 				//Set zombie stats
-				zombies_array[num_zombies].speed = (float) ( ( (double)rand()/(double)(RAND_MAX)) * (max_zombie_speed - min_zombie_speed) + min_zombie_speed);
-				zombies_array[num_zombies].arm_positions = 0;
-			os_mut_release(&zombies_mut);
+				zombie->speed = speed;
+				zombie->arm_positions = 0;
+				zombie->x_push = 0;
+				zombie->y_push = 0;
 			
-				//Increment num_zombies
-			os_mut_wait(&num_zombies_mut, 0xffff);
-				num_zombies++;
-			os_mut_release(&num_zombies_mut);
+				//Increment num_zombies, the horde task moves it from the next frame on
+				world->num_zombies++;
 				
 		//Return the index of the zombie
 		return local_num_zombies;
@@ -317,90 +665,108 @@ signed int zombie_init(void){
 
 
 
-// Kills a specific zombie
-void kill_zombie(short z_index){
-		if(game_playing)
-	{
-		zombies_killed++;
-	}
-	if(z_index < num_zombies){ //Make sure it is a current zombie
-		zombie_t dead_zombie;
-		
-		os_mut_wait(&zombies_mut, 0xffff);
-			dead_zombie = zombies_array[z_index];
-		os_mut_release(&zombies_mut);
+// Kills the zombies at the given indexes together: the victims are marked,
+// one rectangle around all of them is cleared and the array is compacted once
+void kill_zombies(const U8 *victims, int n_victims){
+	bool dead[MAX_ZOMBIES] = {false};
+	zombie_t *zombie;
+	int i, n;
+	int x0 = CAM_WORLD_W, y0 = CAM_WORLD_H, x1 = 0, y1 = 0;
+	
+	for(i=0; i<n_victims; i++){
+		if(victims[i] >= world->num_zombies || dead[victims[i]]) //Make sure it is a current zombie
+			continue;
+		dead[victims[i]] = true;
+		zombie = &world->zombies[victims[i]];
 		
-		os_mut_wait(&GLCD_mut, 0xffff);
-		GLCD_Bitmap (dead_zombie.x_pos, dead_zombie.y_pos, ZOMBIE_WIDTH, ZOMBIE_HEIGHT, (unsigned char *)clear_rect_map);
-		os_mut_release(&GLCD_mut);
+		if(zombie->x_pos < x0) x0 = zombie->x_pos;
+		if(zombie->y_pos < y0) y0 = zombie->y_pos;
+		if(zombie->x_pos + ZOMBIE_WIDTH > x1) x1 = zombie->x_pos + ZOMBIE_WIDTH;
+		if(zombie->y_pos + ZOMBIE_HEIGHT > y1) y1 = zombie->y_pos + ZOMBIE_HEIGHT;
 		
-		//If the dead zombie is not the last one
-		if(z_index != num_zombies-1){
-			//Move the last zombie in the array to this index
-			os_mut_wait(&zombies_mut, 0xffff);
-				zombies_array[z_index] = zombies_array[num_zombies-1];
-			os_mut_release(&zombies_mut);
-			
-			//Decrement num_zombies
-			os_mut_wait(&num_zombies_mut, 0xffff);
-				num_zombies--;
-			os_mut_release(&num_zombies_mut);
-			
-			//Delete the last task
-			os_tsk_delete(zombie_tasks[num_zombies]);
-			return;
-		} else if (z_index != 0) { // If the zombie is the last to spawn, but not the only one
-			
-			//Decrement num_zombies
-			os_mut_wait(&num_zombies_mut, 0xffff);
-				num_zombies--;
-			os_mut_release(&num_zombies_mut);
-
-			//Delete the task
-			os_tsk_delete(zombie_tasks[num_zombies]);
-			return;
-		} else { //If there is only one zombie
-			short first_zombie_index;
-			os_mut_wait(&num_zombies_mut, 0xffff);
-				num_zombies--;
-			os_mut_release(&num_zombies_mut);
-			
-			os_mut_wait(&GLCD_mut, 0xffff);
-				GLCD_Bitmap (zombies_array[0].x_pos, zombies_array[0].y_pos, ZOMBIE_WIDTH, ZOMBIE_HEIGHT, (unsigned char *)clear_rect_map);
-			os_mut_release(&GLCD_mut);
-			
-			
-			//TODO replace this with a free to the zombie, deleting task, intializing new zombie, and restarting task?
-			os_mut_wait(&zombies_mut, 0xffff);
-				first_zombie_index = zombie_init();
-			os_mut_release(&zombies_mut);
-			
-			if(first_zombie_index != 0){
-				//ERROR!!
-			}
-			return;
-			
+		if(game_playing){
+			zombies_killed++;
+			effect_spawn(EFFECT_KILL_FLASH, zombie->x_pos + Z_ARM_WIDTH, zombie->y_pos + Z_ARM_HEIGHT);
 		}
-		
-	}	
+	}
+	if(x1 <= x0)
+		return; //Nobody died
+	
+	//The survivors inside the rectangle are drawn again next frame
+	os_mut_wait(&GLCD_mut, 0xffff);
+	ERASE_RECT(x0, y0, x1 - x0, y1 - y0);
+	os_mut_release(&GLCD_mut);
+	
+	//Close the gaps, the survivors keep their order
+	for(i=0, n=0; i<world->num_zombies; i++){
+		if(!dead[i])
+			world->zombies[n++] = world->zombies[i];
+	}
+	world->num_zombies = n;
+}
+
+//Spawns the zombies the wave director scheduled for this frame
+//and starts the next wave once the current one is over
+void wave_director(void){
+	wave_spawn_t spawn;
+	
+	while(WAVE_Peek(wave_frame, &spawn)){
+		if(zombie_init((float)spawn.speed / WAVE_SPEED_ONE, spawn.corner) == -1)
+			break; //All slots busy, retry next frame
+		WAVE_Pop();
+	}
+	wave_frame++;
+	
+	if(WAVE_Finished() && (world->num_zombies == 0 || wave_frame > WAVE_Stats()->duration + WAVE_OVERTIME)){
+		WAVE_Build(WAVE_Stats()->wave + 1);
+		wave_frame = 0;
+	}
+}
+
+//Buckets the zombie centres into the crowd grid for the neighbour queries
+void crowd_build(void){
+	S16 x[MAX_ZOMBIES], y[MAX_ZOMBIES];
+	short i;
+	
+	for(i=0; i<world->num_zombies; i++){
+		x[i] = world->zombies[i].x_pos + ZOMBIE_WIDTH/2;
+		y[i] = world->zombies[i].y_pos + ZOMBIE_HEIGHT/2;
+	}
+	CROWD_Build(x, y, world->num_zombies);
+}
+
+//Computes the separation push of every zombie in one batched pass over the horde.
+//A zombie may be pushed as far as it walks in a frame, or two closing in at
+//8 px a frame would still end up stacked
+void crowd_separation(void){
+	S8 push_x[MAX_ZOMBIES], push_y[MAX_ZOMBIES];
+	U8 limit[MAX_ZOMBIES];
+	short i, n;
+	
+	n = world->num_zombies;
+	for(i=0; i<n; i++){
+		limit[i] = (U8)(world->zombies[i].speed + 0.5);
+		if(limit[i] < CROWD_MIN_PUSH)
+			limit[i] = CROWD_MIN_PUSH;
+	}
+	crowd_build();
+	CROWD_Separate(CROWD_RADIUS, limit, push_x, push_y);
+	
+	for(i=0; i<n; i++){
+		world->zombies[i].x_push = push_x[i];
+		world->zombies[i].y_push = push_y[i];
+	}
 }
 
 //Detects if the human is touching one of the zombies
 void detect_collision( void ){
 	short i;
-	human_t local_human;
+	human_t local_human = world->human;
 	zombie_t local_zombie;
 	
-	os_mut_wait(&human_mut, 0xffff);
-	local_human = human;
-	os_mut_release(&human_mut);
-
-	
-	for(i=0; i<num_zombies; i++){
+	for(i=0; i<world->num_zombies; i++){
 		
-		os_mut_wait(&zombies_mut, 0xffff);
-		local_zombie = zombies_array[i];
-		os_mut_release(&zombies_mut);
+		local_zombie = world->zombies[i];
 
 		//Detects Collision
 		if( local_zombie.x_pos < local_human.x_pos + HUMAN_WIDTH && local_zombie.x_pos > local_human.x_pos - ZOMBIE_WIDTH 
@@ -417,12 +783,25 @@ void detect_collision( void ){
 
 //Initializes the human
 void human_init(void){
-		os_mut_wait(&human_mut, 0xffff);
-		human.x_pos = 10;
-		human.y_pos = 10;
-		human.speed = 10;
-		human.bombs = 0;
-		os_mut_release(&human_mut);
+		world->human.x_pos = 10;
+		world->human.y_pos = 10;
+		world->human.speed = 10;
+		world->human.bombs = 0;
+}
+
+//Frame barrier: the frame the workers just finished becomes the stable one
+void world_swap(void){
+	world_t *done = world_next;
+	
+	world_next = world;
+	world = done;
+}
+
+//Starts the next frame from the stable one, including what base_task
+//changed between frames, so a worker that writes nothing keeps its state
+void world_publish(void){
+	*world_next = *world;
+	world_next->num_collected = 0;
 }
 
 
@@ -433,92 +812,120 @@ void human_init(void){
 //Pickup Task
 __task void pickup_task( void* void_ptr ){
 	int pickup_counter = 201;  
-	int i, j;
+	int i;
 	human_t local_human;
 	pickup_t local_pickup;
+	pickup_t *pickup;
 	int pickup_spawn_freq = 200;
 	while(1){
-		os_sem_wait(&pickup_task_sem, 0xffff);
+		os_evt_wait_or(FRAME_GO_EVT, 0xffff);
 
 		pickup_counter++;
 		
 		if(pickup_counter < pickup_spawn_freq) pickup_counter++;
 		else {
 			pickup_counter = 0;
-			if(num_pickups < MAX_PICKUPS){
-				//Spawn a pickup
-				os_mut_wait(&pickups_mut, 0xffff);
-				pickups_array[num_pickups].x_pos = rand()%280 + 20;
-				pickups_array[num_pickups].y_pos = rand()%200 + 20;
-				num_pickups++;
-				os_mut_release(&pickups_mut);
-			}if(pickup_spawn_freq < 500){
+			//Spawn a pickup if there is a free slot
+			pickup = POOL_Alloc(&pickups_pool);
+			if(pickup != NULL){
+				pickup->x_pos = rand()%(CAM_WORLD_W - 40) + 20;
+				pickup->y_pos = rand()%200 + 20;
+			}
+			if(pickup_spawn_freq < 500){
 				pickup_spawn_freq += 2;
 			}
 		}
 		
-		os_mut_wait(&human_mut, 0xffff);
-		local_human = human;
-		os_mut_release(&human_mut);
+		local_human = world->human;
 		
-		if(local_human.bombs < 8){ //Make sure human has room for bombs
-			for(i=0; i< num_pickups; i++){
-				os_mut_wait(&pickups_mut, 0xffff);
-				local_pickup = pickups_array[i];
-				os_mut_release(&pickups_mut);
+		//Room for bombs is checked on the copy being counted into, several pickups can land in one frame
+		if(world_next->human.bombs < 8){
+			for(i=0; i< MAX_PICKUPS && world_next->human.bombs < 8; i++){
+				pickup = POOL_Item(&pickups_pool, i);
+				if(pickup == NULL)
+					continue;
+				local_pickup = *pickup;
 				
 				//Detect if human is touching a pickup
 				if( local_pickup.x_pos < local_human.x_pos + HUMAN_WIDTH + GUN_WIDTH && local_pickup.x_pos > local_human.x_pos - GUN_WIDTH - PICKUP_WIDTH 
 					&& local_pickup.y_pos > local_human.y_pos - GUN_WIDTH - PICKUP_HEIGHT && local_pickup.y_pos < local_human.y_pos + HUMAN_HEIGHT + GUN_WIDTH){	
 						
-						//clear the pickup
-						os_mut_wait(&GLCD_mut, 0xffff);
-						GLCD_Bitmap (local_pickup.x_pos, local_pickup.y_pos, PICKUP_WIDTH, PICKUP_HEIGHT, (unsigned char *)clear_rect_map);
-						os_mut_release(&GLCD_mut);
-						
 						//Increment the number of bombs the human has
-						os_mut_wait(&human_mut, 0xffff);
-						(human.bombs)++;
-						os_mut_release(&human_mut);
+						(world_next->human.bombs)++;
 						
-						//Shift the pickups array
-						os_mut_wait(&pickups_mut, 0xffff);
-						for(j=i; j < num_pickups-1; j++){
-							pickups_array[j] = pickups_array[j+1];
-						}
-						num_pickups--;
-						os_mut_release(&pickups_mut);
-				
-				
-				
+						//Release the pickup slot, base_task starts the sparkle that clears it from the screen
+						POOL_Free(&pickups_pool, pickup);
+						world_next->collected[world_next->num_collected++] = local_pickup;
 				}
 			
 			}
 		}
 		
 		//Draw all the pickups
-		for(i=0;i<num_pickups;i++){
+		for(i=0;i<MAX_PICKUPS;i++){
 				
-				os_mut_wait(&pickups_mut, 0xffff);
-				local_pickup = pickups_array[i];
-				os_mut_release(&pickups_mut);
+				pickup = POOL_Item(&pickups_pool, i);
+				if(pickup == NULL)
+					continue;
+				local_pickup = *pickup;
 
 				os_mut_wait(&GLCD_mut, 0xffff);
-				GLCD_Bitmap (local_pickup.x_pos, local_pickup.y_pos, PICKUP_WIDTH, PICKUP_HEIGHT, (unsigned char *)pickup_map);
+				DRAW_BITMAP(local_pickup.x_pos, local_pickup.y_pos, PICKUP_WIDTH, PICKUP_HEIGHT, (unsigned char *)pickup_map);
 				os_mut_release(&GLCD_mut);
 			
 		}
 		
-		
+		os_evt_set(DONE_PICKUP_EVT, base_tsk);
 	}
 	
 }
 
+//Effect task
+//Advances every live effect by one frame, releasing the ones that finished
+__task void effect_task( void* void_ptr ){
+	int i;
+	effect_t *effect;
+	effect_t local_effect;
+	bool done;
+	
+	while(1){
+		os_evt_wait_or(FRAME_GO_EVT, 0xffff);
+		
+		for(i=0; i<MAX_EFFECTS; i++){
+			effect = POOL_Item(&effects_pool, i);
+			if(effect == NULL)
+				continue;
+			local_effect = *effect;
+			
+			os_mut_wait(&GLCD_mut, 0xffff);
+			done = effect_render(&local_effect);
+			os_mut_release(&GLCD_mut);
+			
+			//Explosions leave a scorch mark on the floor
+			if(done && local_effect.type == EFFECT_EXPLOSION){
+				os_mut_wait(&GLCD_mut, 0xffff);
+				TM_SetTile((local_effect.x_pos + HUMAN_WIDTH/2) / TM_TILE, (local_effect.y_pos + HUMAN_HEIGHT/2) / TM_TILE, TM_SCORCH);
+				os_mut_release(&GLCD_mut);
+			}
+			
+			if(done)
+				POOL_Free(&effects_pool, effect);
+			else
+				effect->frame = local_effect.frame;
+		}
+		DL_Done(&job_effect);
+		os_evt_set(DONE_EFFECT_EVT, base_tsk);
+	}
+}
+
 //Human task
 __task void human_task( void* void_ptr ) {
-	unsigned int joy_status;
+	uint16_t share[JOY_DIRS];
+	int move_x = 0, move_y = 0; // 1/JOY_SHARE pixels not moved yet
+	int dx, dy;
 	human_t prev_human;
 	int x, y;
+	int speed;
 	
 	#ifdef PRINT_ENABLE
 		printf("Human Task\n");
@@ -530,39 +937,54 @@ __task void human_task( void* void_ptr ) {
 			printf("Human Task is WAITING!\n");
 		#endif
 		
-		os_sem_wait(&human_task_sem, 0xffff);
+		os_evt_wait_or(FRAME_GO_EVT, 0xffff);
 		
 		#ifdef PRINT_ENABLE_LOOPS
 			printf("Human Task!\n");
 		#endif
 
-		os_mut_wait(&human_mut, 0xffff);
-			prev_human = human;
-		os_mut_release(&human_mut);
+		prev_human = world->human;
 		
 		//Clear current human position
 		os_mut_wait(&GLCD_mut, 0xffff);
-			GLCD_Bitmap (prev_human.x_pos - GUN_WIDTH, prev_human.y_pos-  GUN_WIDTH, 20, 20, (unsigned char *)clear_rect_map); 
+			ERASE_RECT(prev_human.x_pos - GUN_WIDTH, prev_human.y_pos-  GUN_WIDTH, 20, 20); 
 		os_mut_release(&GLCD_mut);
 		
-		//Get the joystick status
-		os_mut_wait(&joystick_mut, 0xffff);
-			joy_status = JOYSTICK_Position_Read();
-		os_mut_release(&joystick_mut);
+		//Get how long each direction was held since the last frame
+		JOYSTICK_Collect(share);
+		#ifndef JOY_SUBTICK
+		for(x = 0; x < JOY_DIRS; x++){
+			if(share[x] > 0) share[x] = JOY_SHARE; // even a short tap is a whole step
+		}
+		#endif
+		
+		//Update position with in accordance with the joystick position,
+		//the potentiometer sets the speed
+		speed = HUMAN_SPEED_MIN + ADC_Value() * (HUMAN_SPEED_MAX - HUMAN_SPEED_MIN) / ADC_FILTERED_MAX;
+		move_x += speed * (share[UP_POS] - share[DOWN_POS]);
+		move_y += speed * (share[RIGHT_POS] - share[LEFT_POS]);
+		dx = move_x / JOY_SHARE;
+		dy = move_y / JOY_SHARE;
+		move_x -= dx * JOY_SHARE;
+		move_y -= dy * JOY_SHARE;
+		//Step first, then keep the human inside the playfield: a step is up
+		//to HUMAN_SPEED_MAX pixels, more than the margin
+		x = prev_human.x_pos + dx;
+		y = prev_human.y_pos + dy;
+		if(x < 10) x = 10;
+		if(x > CAM_WORLD_W - 20) x = CAM_WORLD_W - 20;
+		if(y < 10) y = 10;
+		if(y > 220) y = 220;
 		
-		//Update position with in accordance with the joystick position
-		os_mut_wait(&human_mut, 0xffff);
-		if( !((joy_status >> DOWN_POS) & 1) && prev_human.x_pos > 10) human.x_pos -= human.speed;
-		if( !((joy_status >> UP_POS) & 1) && prev_human.x_pos < 300) human.x_pos += human.speed;
-		if( !((joy_status >> LEFT_POS) & 1) && prev_human.y_pos > 10) human.y_pos -= human.speed;
-		if( !((joy_status >> RIGHT_POS) & 1) && prev_human.y_pos < 220) human.y_pos += human.speed;
-		x = human.x_pos;
-		y = human.y_pos;
-		os_mut_release(&human_mut);
+		//Only the fields this task owns, pickup_task counts the bombs
+		world_next->human.speed = speed;
+		world_next->human.x_pos = x;
+		world_next->human.y_pos = y;
+		world_next->human.facing = FF_DirTowards(x - prev_human.x_pos, y - prev_human.y_pos);
 		
 		//Draw the new human
 		os_mut_wait(&GLCD_mut, 0xffff);
-		GLCD_Bitmap (x, y, HUMAN_WIDTH, HUMAN_HEIGHT, (unsigned char *)human_map);
+		DRAW_BITMAP(x, y, HUMAN_WIDTH, HUMAN_HEIGHT, (unsigned char *)human_map);
 		os_mut_release(&GLCD_mut);
 		
 		
@@ -570,252 +992,221 @@ __task void human_task( void* void_ptr ) {
 		os_mut_wait(&GLCD_mut, 0xffff);
 		if (y > prev_human.y_pos){
 				if (x > prev_human.x_pos){
-					GLCD_Bitmap (x+HUMAN_WIDTH, y+HUMAN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map); 
+					DRAW_BITMAP(x+HUMAN_WIDTH, y+HUMAN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map); 
 				}
 				else if (x < prev_human.x_pos){
-					GLCD_Bitmap (x-GUN_WIDTH, y+HUMAN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map);
+					DRAW_BITMAP(x-GUN_WIDTH, y+HUMAN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map);
 				}
 				else {
-					GLCD_Bitmap (x + GUN_WIDTH/2, y+HUMAN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map);
+					DRAW_BITMAP(x + GUN_WIDTH/2, y+HUMAN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map);
 				}
 			}
 			else if (y < prev_human.y_pos){
 				if (x > prev_human.x_pos){
-					GLCD_Bitmap (x+HUMAN_WIDTH, y - GUN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map); 
+					DRAW_BITMAP(x+HUMAN_WIDTH, y - GUN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map); 
 				}
 				else if (x < prev_human.x_pos){
-					GLCD_Bitmap (x - GUN_WIDTH, y - GUN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map);
+					DRAW_BITMAP(x - GUN_WIDTH, y - GUN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map);
 				}
 				else {
-					GLCD_Bitmap (x + GUN_WIDTH/2, y - GUN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map);
+					DRAW_BITMAP(x + GUN_WIDTH/2, y - GUN_HEIGHT, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map);
 				}
 			}
 			else {
 				if (x > prev_human.x_pos){
-					GLCD_Bitmap (x+HUMAN_WIDTH, y+GUN_HEIGHT/2, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map); 
+					DRAW_BITMAP(x+HUMAN_WIDTH, y+GUN_HEIGHT/2, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map); 
 				}
 				else if (x < prev_human.x_pos){
-					GLCD_Bitmap (x-GUN_WIDTH, y + GUN_HEIGHT/2, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map);
+					DRAW_BITMAP(x-GUN_WIDTH, y + GUN_HEIGHT/2, GUN_WIDTH, GUN_HEIGHT, (unsigned char *)gun_map);
 				}
 			}
 			os_mut_release(&GLCD_mut);			
 			
+			DL_Done(&job_input);
+			os_evt_set(DONE_HUMAN_EVT, base_tsk);
 	}
 	
 }
 
 
-//Zombie Task
-__task void zombie_task( void* void_ptr ){
-	
+//Erases a zombie and moves it one step towards the human, its old position
+//goes to x_old/y_old for zombie_draw
+void zombie_move(int zombie_index, const human_t *current_human, int *x_old, int *y_old){
 	signed int x_dist;
 	signed int y_dist;
-	float xy_ratio;
 	int delta_y;
 	int delta_x;
-	int x_old, y_old;
+	int x_new, y_new;
 	int new_arm_position;
-	human_t current_human;
 	zombie_t prev_zombie;
 	zombie_t next_zombie;
-	signed int zombie_index = *((signed int *)void_ptr);
 	
-	#ifdef PRINT_ENABLE
-		printf("Zombie Init.\n");
-	#endif
-
-	while(1){
+	//Get previous Zombie
+	prev_zombie = world->zombies[zombie_index];
+	
+	next_zombie = prev_zombie;
+	
+	//Clear the arms of the previous zombie
+	os_mut_wait(&GLCD_mut, 0xffff);
+	if(prev_zombie.arm_positions == 3){
+		ERASE_RECT(prev_zombie.x_pos, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH);
+		ERASE_RECT(prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH);
+	}
+	else if(prev_zombie.arm_positions == 2){
+		ERASE_RECT(prev_zombie.x_pos + Z_ARM_WIDTH/2 + Z_BODY_WIDTH/2, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH);
+		ERASE_RECT(prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos + Z_ARM_WIDTH/2 + Z_BODY_HEIGHT/2, Z_ARM_WIDTH, Z_ARM_WIDTH);
 		
-		#ifdef PRINT_ENABLE_LOOPS
-			printf("Zombie Task is WAITING!\n");
-		#endif
+	}
+	else if(prev_zombie.arm_positions == 1){
+		ERASE_RECT(prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH);
+		ERASE_RECT(prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH);	
+	}
+	else if(prev_zombie.arm_positions == 8){
+		ERASE_RECT(prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos + Z_ARM_WIDTH/2 + Z_BODY_HEIGHT/2, Z_ARM_WIDTH, Z_ARM_WIDTH);
+		ERASE_RECT(prev_zombie.x_pos + Z_ARM_WIDTH/2 + Z_BODY_WIDTH/2, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH);
+	}
+	else if(prev_zombie.arm_positions == 7){
+		ERASE_RECT(prev_zombie.x_pos, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH);
+		ERASE_RECT(prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH);	
 		
-			os_sem_wait(&zombie_task_sem[zombie_index], 0xffff); 
-		#ifdef PRINT_ENABLE_LOOPS
-			printf("Zombie Task!\n");
-		#endif
-	
-			//Get previous Zombie
-			os_mut_wait(&zombies_mut, 0xffff);
-			prev_zombie = zombies_array[zombie_index];
-			os_mut_release(&zombies_mut);
-			
-			next_zombie = prev_zombie;
+	}
+	else if(prev_zombie.arm_positions == 6){
+		ERASE_RECT(prev_zombie.x_pos + Z_ARM_WIDTH/2 + Z_BODY_WIDTH/2, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH);
+		ERASE_RECT(prev_zombie.x_pos, prev_zombie.y_pos + Z_ARM_WIDTH/2 + Z_BODY_HEIGHT/2, Z_ARM_WIDTH, Z_ARM_WIDTH);	
 		
-			os_mut_wait(&human_mut, 0xffff);
-			current_human = human;
-			os_mut_release(&human_mut);
-			
-			//Clear the arms of the previous zombie
-			os_mut_wait(&GLCD_mut, 0xffff);
-			if(prev_zombie.arm_positions == 3){
-				GLCD_Bitmap (prev_zombie.x_pos, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-				GLCD_Bitmap (prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-			}
-			else if(prev_zombie.arm_positions == 2){
-				GLCD_Bitmap (prev_zombie.x_pos + Z_ARM_WIDTH/2 + Z_BODY_WIDTH/2, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-				GLCD_Bitmap (prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos + Z_ARM_WIDTH/2 + Z_BODY_HEIGHT/2, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-				
-			}
-			else if(prev_zombie.arm_positions == 1){
-				GLCD_Bitmap (prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-				GLCD_Bitmap (prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);	
-			}
-			else if(prev_zombie.arm_positions == 8){
-				GLCD_Bitmap (prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos + Z_ARM_WIDTH/2 + Z_BODY_HEIGHT/2, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-				GLCD_Bitmap (prev_zombie.x_pos + Z_ARM_WIDTH/2 + Z_BODY_WIDTH/2, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-			}
-			else if(prev_zombie.arm_positions == 7){
-				GLCD_Bitmap (prev_zombie.x_pos, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-				GLCD_Bitmap (prev_zombie.x_pos + Z_ARM_WIDTH + Z_BODY_WIDTH, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);	
-				
-			}
-			else if(prev_zombie.arm_positions == 6){
-				GLCD_Bitmap (prev_zombie.x_pos + Z_ARM_WIDTH/2 + Z_BODY_WIDTH/2, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-				GLCD_Bitmap (prev_zombie.x_pos, prev_zombie.y_pos + Z_ARM_WIDTH/2 + Z_BODY_HEIGHT/2, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);	
-				
-			}
-			else if(prev_zombie.arm_positions == 5){
-				GLCD_Bitmap (prev_zombie.x_pos, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-				GLCD_Bitmap (prev_zombie.x_pos, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-				
-			}
-			else if(prev_zombie.arm_positions == 4){
-				GLCD_Bitmap (prev_zombie.x_pos, prev_zombie.y_pos + Z_ARM_WIDTH/2 + Z_BODY_HEIGHT/2, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-				GLCD_Bitmap (prev_zombie.x_pos + Z_ARM_WIDTH/2 + Z_BODY_WIDTH/2, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH, (unsigned char *)clear_rect_map);
-			}
-			
-			os_mut_release(&GLCD_mut);
-			
-			//Get the distance to the human
-			x_dist = current_human.x_pos - prev_zombie.x_pos;
-			y_dist = current_human.y_pos - prev_zombie.y_pos;
-			
-			//Calculate the movement of the zombie in x and y directions
-			x_old = prev_zombie.x_pos;
-			y_old = prev_zombie.y_pos;
-			if(y_dist!=0){
-				xy_ratio = abs(x_dist/y_dist);
-				
-				delta_y = (int) ((int) prev_zombie.speed )/sqrt(1+xy_ratio*xy_ratio);
-				if(y_dist > 0) next_zombie.y_pos += delta_y;
-				else next_zombie.y_pos -= delta_y;
-				
-				if(delta_y) delta_x = (int) delta_y*xy_ratio;
-				else delta_x = ((int) prev_zombie.speed );
-				
-				if(x_dist > 0) next_zombie.x_pos += delta_x;
-				else next_zombie.x_pos -= delta_x;
-				
-				if(delta_x == 0){
-					if(y_dist > 0) new_arm_position = 3;
-					else new_arm_position = 7;
-				}
-				else if(delta_y == 0){
-					if(x_dist > 0) new_arm_position = 1;
-					else new_arm_position = 5;
-				}
-				else if(x_dist > 0){
-					if(y_dist > 0) new_arm_position = 2;
-					else new_arm_position = 8;
-				} else {
-					if(y_dist > 0) new_arm_position = 4;
-					else new_arm_position = 6;	
-				}
-				
-			}
-			else {
-				if(x_dist > 0){ 
-					next_zombie.x_pos += ((int) prev_zombie.speed );
-					new_arm_position = 1;
-				} else {
-					next_zombie.x_pos -= ((int) prev_zombie.speed );
-					new_arm_position = 5;
-				}
-			}
-			
+	}
+	else if(prev_zombie.arm_positions == 5){
+		ERASE_RECT(prev_zombie.x_pos, prev_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_WIDTH);
+		ERASE_RECT(prev_zombie.x_pos, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH);
+		
+	}
+	else if(prev_zombie.arm_positions == 4){
+		ERASE_RECT(prev_zombie.x_pos, prev_zombie.y_pos + Z_ARM_WIDTH/2 + Z_BODY_HEIGHT/2, Z_ARM_WIDTH, Z_ARM_WIDTH);
+		ERASE_RECT(prev_zombie.x_pos + Z_ARM_WIDTH/2 + Z_BODY_WIDTH/2, prev_zombie.y_pos + Z_ARM_WIDTH + Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_WIDTH);
+	}
 	
-			//Clear previous zombie
-			os_mut_wait(&GLCD_mut, 0xffff);
- 			GLCD_Bitmap (prev_zombie.x_pos + Z_ARM_WIDTH, prev_zombie.y_pos + Z_ARM_WIDTH, Z_BODY_WIDTH, Z_BODY_HEIGHT, (unsigned char *)clear_rect_map);
-			os_mut_release(&GLCD_mut);
-			
-			//Draw zombie
-			os_mut_wait(&GLCD_mut, 0xffff);
-			GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH, next_zombie.y_pos+Z_ARM_WIDTH, Z_BODY_WIDTH, Z_BODY_HEIGHT, (unsigned char *)z_body_map); 
-			os_mut_release(&GLCD_mut);
-			
-			os_dly_wait(1);
-
-			//Draw zombie again to avoid unintentional deletion
-			os_mut_wait(&GLCD_mut, 0xffff);
-			GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH, next_zombie.y_pos+Z_ARM_WIDTH, Z_BODY_WIDTH, Z_BODY_HEIGHT, (unsigned char *)z_body_map); 
-			os_mut_release(&GLCD_mut);
-			
-			//Draw the new zombie arms
-		os_mut_wait(&GLCD_mut, 0xffff);
-		 if (y_old < next_zombie.y_pos){
-				if (x_old > next_zombie.x_pos){
-					GLCD_Bitmap (next_zombie.x_pos , next_zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT/4, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-					GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH/4 , next_zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-				}
-				else if (x_old < next_zombie.x_pos){
-					GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , next_zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT/4, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-					GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH/4 , next_zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-				}
-				else {
-					GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , next_zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-					GLCD_Bitmap (next_zombie.x_pos , next_zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-				}
-			}
-			else if (y_old > next_zombie.y_pos){
-				if (x_old > next_zombie.x_pos){
-					GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH/4 , next_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-					GLCD_Bitmap (next_zombie.x_pos , next_zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT/4, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-				}
-				else if (x_old < next_zombie.x_pos){
-					GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH/4 , next_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-					GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , next_zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT/4, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-				}
-				else {
-					GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , next_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-					GLCD_Bitmap (next_zombie.x_pos , next_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-				}
-			}
-			else {
-				if (x_old > next_zombie.x_pos){
-					GLCD_Bitmap (next_zombie.x_pos , next_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-					GLCD_Bitmap (next_zombie.x_pos , next_zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-				}
-				else if (x_old < next_zombie.x_pos){
-					GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , next_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-					GLCD_Bitmap (next_zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , next_zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-				}
-				else {
-					GLCD_Bitmap (next_zombie.x_pos , next_zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-					GLCD_Bitmap (next_zombie.x_pos , next_zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
-				}
-			}
-			os_mut_release(&GLCD_mut);
-			
-			//Update position of the Zombie
-			os_mut_wait(&zombies_mut, 0xffff);
-				zombies_array[zombie_index].x_pos = next_zombie.x_pos;
-				zombies_array[zombie_index].y_pos = next_zombie.y_pos;
-				zombies_array[zombie_index].arm_positions = new_arm_position;
-				if(zombies_array[zombie_index].speed < 8.0)
-				zombies_array[zombie_index].speed += 0.02 ;
-			os_mut_release(&zombies_mut);
+	os_mut_release(&GLCD_mut);
+	
+	//Get the heading from the shared flow field, chase directly once in the human's cell
+	*x_old = prev_zombie.x_pos;
+	*y_old = prev_zombie.y_pos;
+	new_arm_position = FF_Direction(prev_zombie.x_pos + ZOMBIE_WIDTH/2, prev_zombie.y_pos + ZOMBIE_HEIGHT/2);
+	if(new_arm_position == FF_NONE){
+		x_dist = (current_human->x_pos + HUMAN_WIDTH/2) - (prev_zombie.x_pos + ZOMBIE_WIDTH/2);
+		y_dist = (current_human->y_pos + HUMAN_HEIGHT/2) - (prev_zombie.y_pos + ZOMBIE_HEIGHT/2);
+		new_arm_position = FF_DirTowards(x_dist, y_dist);
+	}
+	
+	//Move along the heading, plus the push away from neighbours
+	delta_x = (int) (prev_zombie.speed * FF_DX[new_arm_position]) / 256 + prev_zombie.x_push;
+	delta_y = (int) (prev_zombie.speed * FF_DY[new_arm_position]) / 256 + prev_zombie.y_push;
+	x_new = prev_zombie.x_pos + delta_x;
+	y_new = prev_zombie.y_pos + delta_y;
+	if(x_new < 0) x_new = 0;
+	if(x_new > CAM_WORLD_W - ZOMBIE_WIDTH) x_new = CAM_WORLD_W - ZOMBIE_WIDTH;
+	if(y_new < 0) y_new = 0;
+	if(y_new > CAM_WORLD_H - ZOMBIE_HEIGHT) y_new = CAM_WORLD_H - ZOMBIE_HEIGHT;
+	next_zombie.x_pos = x_new;
+	next_zombie.y_pos = y_new;
+	if(new_arm_position == FF_NONE)
+		new_arm_position = prev_zombie.arm_positions;
+	
+	//Clear previous zombie
+	os_mut_wait(&GLCD_mut, 0xffff);
+	ERASE_RECT(prev_zombie.x_pos + Z_ARM_WIDTH, prev_zombie.y_pos + Z_ARM_WIDTH, Z_BODY_WIDTH, Z_BODY_HEIGHT);
+	os_mut_release(&GLCD_mut);
+	
+	//Update position of the Zombie
+	next_zombie.arm_positions = new_arm_position;
+	if(next_zombie.speed < 8.0)
+		next_zombie.speed += 0.02 ;
+	world_next->zombies[zombie_index] = next_zombie;
+}
 
+//Draws a zombie where zombie_move put it, the arms trail the move
+void zombie_draw(int zombie_index, int x_old, int y_old){
+	zombie_t zombie = world_next->zombies[zombie_index];
+	
+	//Draw zombie
+	os_mut_wait(&GLCD_mut, 0xffff);
+	DRAW_BITMAP(zombie.x_pos+Z_ARM_WIDTH, zombie.y_pos+Z_ARM_WIDTH, Z_BODY_WIDTH, Z_BODY_HEIGHT, (unsigned char *)z_body_map); 
+	os_mut_release(&GLCD_mut);
+	
+	//Draw the new zombie arms
+	os_mut_wait(&GLCD_mut, 0xffff);
+	 if (y_old < zombie.y_pos){
+		if (x_old > zombie.x_pos){
+			DRAW_BITMAP(zombie.x_pos , zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT/4, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+			DRAW_BITMAP(zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH/4 , zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+		}
+		else if (x_old < zombie.x_pos){
+			DRAW_BITMAP(zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT/4, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+			DRAW_BITMAP(zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH/4 , zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+		}
+		else {
+			DRAW_BITMAP(zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+			DRAW_BITMAP(zombie.x_pos , zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+		}
+	}
+	else if (y_old > zombie.y_pos){
+		if (x_old > zombie.x_pos){
+			DRAW_BITMAP(zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH/4 , zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+			DRAW_BITMAP(zombie.x_pos , zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT/4, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+		}
+		else if (x_old < zombie.x_pos){
+			DRAW_BITMAP(zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH/4 , zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+			DRAW_BITMAP(zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT/4, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+		}
+		else {
+			DRAW_BITMAP(zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+			DRAW_BITMAP(zombie.x_pos , zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+		}
 	}
+	else {
+		if (x_old > zombie.x_pos){
+			DRAW_BITMAP(zombie.x_pos , zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+			DRAW_BITMAP(zombie.x_pos , zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+		}
+		else if (x_old < zombie.x_pos){
+			DRAW_BITMAP(zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+			DRAW_BITMAP(zombie.x_pos+Z_ARM_WIDTH+Z_BODY_WIDTH , zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+		}
+		else {
+			DRAW_BITMAP(zombie.x_pos , zombie.y_pos, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+			DRAW_BITMAP(zombie.x_pos , zombie.y_pos+Z_ARM_HEIGHT+Z_BODY_HEIGHT, Z_ARM_WIDTH, Z_ARM_HEIGHT, (unsigned char *)z_arm_map);
+		}
+	}
+	os_mut_release(&GLCD_mut);
+}
+
+//Horde task
+//Moves every zombie before drawing any, so no zombie erases a neighbour
+//that was already drawn this frame
+__task void horde_task( void* void_ptr ){
+	static int x_old[MAX_ZOMBIES], y_old[MAX_ZOMBIES]; // not on the task stack
+	int i;
+	
+	while(1){
+		os_evt_wait_or(FRAME_GO_EVT, 0xffff);
+		
+		//Zombies only spawn and die between frames
+		for(i = 0; i < world->num_zombies; i++){
+			zombie_move(i, &world->human, &x_old[i], &y_old[i]);
+		}
+		for(i = 0; i < world->num_zombies; i++){
+			zombie_draw(i, x_old[i], y_old[i]);
+		}
 		
+		os_evt_set(DONE_HORDE_EVT, base_tsk);
+	}
 }
 
 //Controls Button action
 __task void button_task( void *void_ptr){
 	human_t local_human;
+	U8 victims[MAX_ZOMBIES];
+	int n_victims;
 	int i;
-	float total_dist;
 	int x_dist;
 	int y_dist;
 	#ifdef PRINT_ENABLE
@@ -834,65 +1225,32 @@ __task void button_task( void *void_ptr){
 			printf("Bomb detonated!\n");
 		#endif
 		
+		//Runs between frames while base_task waits, so it edits the stable world
 		//Decrement the number of bombs the human has
-		os_mut_wait(&human_mut, 0xffff);
-		local_human = human;
-		(human.bombs)--;
-		os_mut_release(&human_mut);
+		local_human = world->human;
+		(world->human.bombs)--;
 		
-		//Animate explosion
-		os_mut_wait(&GLCD_mut, 0xffff);
-		for (i = 0; i < 81 ; i++){
-			
-			if(local_human.y_pos-BOMB_RANGE+BOMB_D_HEIGHT*(floor(i/9)+1) < 231){
-				if (bomb_map[i] == 0){
-					GLCD_Bitmap(local_human.x_pos-BOMB_RANGE+ BOMB_D_WIDTH*(i%9+1) , local_human.y_pos-BOMB_RANGE+BOMB_D_HEIGHT*(floor(i/9)+1) , BOMB_D_WIDTH, BOMB_D_HEIGHT, (unsigned char *)bomb_w_map);
-				}
-				else if (bomb_map[i] == 1){
-					GLCD_Bitmap (local_human.x_pos-BOMB_RANGE+ BOMB_D_WIDTH*(i%9+1) , local_human.y_pos-BOMB_RANGE+BOMB_D_HEIGHT*(floor(i/9)+1) , BOMB_D_WIDTH, BOMB_D_HEIGHT, (unsigned char *)bomb_r_map);
-				}
-				else if (bomb_map[i] == 2){
-					GLCD_Bitmap (local_human.x_pos-BOMB_RANGE+ BOMB_D_WIDTH*(i%9+1) , local_human.y_pos-BOMB_RANGE+BOMB_D_HEIGHT*(floor(i/9)+1) , BOMB_D_WIDTH, BOMB_D_HEIGHT, (unsigned char *)bomb_o_map);				 
-				}
-				else if (bomb_map[i] == 3){
-					GLCD_Bitmap (local_human.x_pos-BOMB_RANGE+ BOMB_D_WIDTH*(i%9+1) , local_human.y_pos-BOMB_RANGE+BOMB_D_HEIGHT*(floor(i/9)+1) , BOMB_D_WIDTH, BOMB_D_HEIGHT, (unsigned char *)bomb_y_map);
-				}
-		}
-		}
-		os_mut_release(&GLCD_mut);
+		//Start the explosion, effect_task draws and clears it over the next frames
+		effect_spawn(EFFECT_EXPLOSION, local_human.x_pos, local_human.y_pos);
 
-				
-				
 		#ifdef PRINT_ENABLE
 			printf("Got human\n");
 		#endif	
 		
-		//Detect the zombies that the bomb killed
-		for( i = num_zombies-1 ; i >= 0 ; i-- ){
-			#ifdef PRINT_ENABLE
-				printf("Calculating Distance\n");
-			#endif	
-			
-			x_dist = (local_human.x_pos + HUMAN_WIDTH/2) - (zombies_array[i].x_pos + ZOMBIE_WIDTH/2);
-			y_dist = (local_human.y_pos + HUMAN_HEIGHT/2) - (zombies_array[i].y_pos + ZOMBIE_HEIGHT/2);
-			total_dist = sqrt( x_dist*x_dist + y_dist*y_dist );
-			
-			if( total_dist < BOMB_RANGE){
-					os_dly_wait(1);
-					#ifdef PRINT_ENABLE
-							printf("Killing In-Range Zombie\n");
-					#endif	
-					kill_zombie(i);
-			}
-			
+		//Detect the zombies that the bomb killed. A plain scan of the squared
+		//distances: for a horde of MAX_ZOMBIES it beats building the crowd grid
+		for( i = 0, n_victims = 0 ; i < world->num_zombies ; i++ ){
+			x_dist = (local_human.x_pos + HUMAN_WIDTH/2) - (world->zombies[i].x_pos + ZOMBIE_WIDTH/2);
+			y_dist = (local_human.y_pos + HUMAN_HEIGHT/2) - (world->zombies[i].y_pos + ZOMBIE_HEIGHT/2);
+			if( x_dist*x_dist + y_dist*y_dist < (int)BOMB_RANGE*(int)BOMB_RANGE )
+				victims[n_victims++] = i;
 		}
-			os_dly_wait(8);
-		//Clear the bomb
-			for (i = 0; i < 81 ; i++){
-					GLCD_Bitmap (local_human.x_pos-BOMB_RANGE+ BOMB_D_WIDTH*(i%9+1) , local_human.y_pos-BOMB_RANGE+BOMB_D_HEIGHT*(floor(i/9)+1) , BOMB_D_WIDTH, BOMB_D_HEIGHT, (unsigned char *)bomb_w_map);				 
-			}
+		#ifdef PRINT_ENABLE
+			printf("Killing %d In-Range Zombies\n", n_victims);
+		#endif	
+		kill_zombies(victims, n_victims);
 		
-
+		os_evt_set(DONE_BOMB_EVT, base_tsk);
 	}
 	
 	
@@ -901,37 +1259,59 @@ __task void button_task( void *void_ptr){
 
 __task void LED_task (void *void_ptr){
 	human_t local_human;
+	int shown = -1;
 
+	os_itv_set(LED_PERIOD);
 	while(1){
 		//Output correct number of bombs to LEDs
-		local_human = human;
-		LED_Out(local_human.bombs);
+		os_itv_wait();
+		DL_Next(&job_led, LED_PERIOD * TICK_US);
+		local_human = world->human;
+		if(local_human.bombs != shown){
+			shown = local_human.bombs;
+			LED_Out(shown);
+		}
+		DL_Done(&job_led);
+	}
+}
+
+//Save task
+//Writes the high score table to flash without holding up the other tasks
+__task void save_task( void* void_ptr ){
+	while(1){
+		os_evt_wait_or(SAVE_EVT, 0xffff);
+		if(!SCORE_Save()){
+			#ifdef PRINT_ENABLE
+				printf("High score not saved, retrying\n");
+			#endif
+			SCORE_Save();
+		}
 	}
 }
 
 __task void collision_detect_task(void *void_ptr){
 	while(1){
-		os_sem_wait(&collision_detect_sem, 0xffff);
+		os_evt_wait_or(FRAME_GO_EVT, 0xffff);
 
 		detect_collision();
+		DL_Done(&job_frame);
 		
 		//Let base thread know the current iteration is done.
-		os_sem_send(&iteration_sem);
+		os_evt_set(DONE_COLLISION_EVT, base_tsk);
 	}
 }
 
 __task void main_menu_task (void *void_ptr){
-		bool wait_game = true;
-	while(wait_game){ ///////////////////////////////////////////
-		if (button_pressed){
-			button_pressed = 0;
-			wait_game = false;
-		}
-	}
-	  GLCD_Clear(0x8C71);                         /* Clear graphical LCD display   */
-  GLCD_SetBackColor(0x8C71);
+	uint32_t pressed_us;
+	
+	//Sleep until the button starts the game
+	INT0_Wait(0xffff, &pressed_us);
+	CAM_Init(CAMERA_STEP);                      /* Start at the left of the world */
+	TM_DrawAll();                               /* Draw the level background     */
+  GLCD_SetBackColor(PLAYFIELD_COLOR);
   GLCD_SetTextColor(Red);
 	can_bomb = true; 
+	os_evt_set(MENU_DONE_EVT, base_tsk);
 	os_tsk_delete_self();
 	
 }
@@ -939,52 +1319,60 @@ __task void main_menu_task (void *void_ptr){
 //Base task
 __task void base_task( void ) {
 		int i;
-		signed int zombie_index;
-		unsigned int zombie_counter = 0;
-		unsigned int z_speed_counter = 0;
-	
-	
-		int zombie_spawn_freq = 75;
+		int strip_x, strip_w;
+		uint32_t pressed_us;
+		U8 victims[MAX_ZOMBIES];
+		int rank;
+		U32 frame_start = 0;
+		U32 frame_ticks;
+		bool frame_running = false;
 		//initialize all variables
 
-		os_tsk_prio_self( 12 );
+		base_tsk = os_tsk_self();
+		os_tsk_prio_self( PRIO_BASE );
 	
 		#ifdef PRINT_ENABLE
 			printf("Initializing...\n");
 		#endif
 	
 		//Initialize semaphores/mutexes
-	  os_sem_init(&human_task_sem, 0);
-		os_sem_init(&pickup_task_sem, 0);
-		os_mut_init(&human_mut);
+		POOL_Init(&pickups_pool, pickup_items, sizeof(pickup_t), MAX_PICKUPS);
+		POOL_Init(&effects_pool, effect_items, sizeof(effect_t), MAX_EFFECTS);
 		os_mut_init(&GLCD_mut);
 		os_mut_init(&LED_mut);
-		os_mut_init(&joystick_mut);
 		os_sem_init(&button_sem, 0);
-		os_sem_init(&collision_detect_sem,0);
-		os_sem_init(&iteration_sem,1);
-	
-		for(i=0; i< MAX_ZOMBIES; i++){
-			os_sem_init(&zombie_task_sem[i], 0);
-		}
+		INT0_Start();
 	
 
-	  //Initialize First Zombie
-		zombie_index = zombie_init(); //this will be zero
+		//The menu draws the level background when the game starts
+		TM_Init();
+	#ifdef USE_BACKBUFFER
+		CMP_Init(PLAYFIELD_COLOR);
+		CMP_Background(TM_Row);
+	#endif
+	
+	  //Precompute the first wave, its first zombie spawns on the first frame
+		WAVE_Build(0);
 		
 		// Go to start screen
-		os_tsk_create_ex(main_menu_task, 13, NULL);
+		task_create(main_menu_task, PRIO_MENU, "menu", menu_stk, sizeof(menu_stk), NULL);
+		os_evt_wait_or(MENU_DONE_EVT, 0xffff);
 		
 		//Initialize human
 		human_init();
 		
 		//Initialize other tasks
-		human_tsk = os_tsk_create_ex( human_task, 11,NULL );
-		zombie_tasks[zombie_index] = os_tsk_create_ex( zombie_task, 11, (void *) &zombie_index );
-		button_tsk = os_tsk_create_ex( button_task, 11, NULL );
-		pickup_tsk = os_tsk_create_ex( pickup_task, 11, NULL );
-		led_tsk = os_tsk_create_ex( LED_task, 8, NULL );
-		collision_tsk = os_tsk_create_ex( collision_detect_task, 9, NULL );
+		human_tsk = task_create( human_task, PRIO_INPUT, "human", human_stk, sizeof(human_stk), NULL );
+		button_tsk = task_create( button_task, PRIO_INPUT, "button", button_stk, sizeof(button_stk), NULL );
+		pickup_tsk = task_create( pickup_task, PRIO_SIM, "pickup", pickup_stk, sizeof(pickup_stk), NULL );
+		led_tsk = task_create( LED_task, PRIO_LED, "led", led_stk, sizeof(led_stk), NULL );
+		collision_tsk = task_create( collision_detect_task, PRIO_FRAME_END, "collision", collision_stk, sizeof(collision_stk), NULL );
+		effect_tsk = task_create( effect_task, PRIO_RENDER, "effect", effect_stk, sizeof(effect_stk), NULL );
+		horde_tsk = task_create( horde_task, PRIO_SIM, "horde", horde_stk, sizeof(horde_stk), NULL );
+		
+		//No done flag of the last game may open the first barrier
+		os_evt_clr(FRAME_WORKERS_DONE | DONE_COLLISION_EVT | DONE_BOMB_EVT, base_tsk);
+		frame_running = false;
 		
 		while(game_playing){
 			
@@ -993,64 +1381,100 @@ __task void base_task( void ) {
 			printf("----\n");
 		#endif
 			
-			os_dly_wait(10);
-			os_sem_wait(&iteration_sem, 0xffff);
-
-			//Spawn a new zombie after a certain number of iterations
-			if(zombie_counter < zombie_spawn_freq) zombie_counter++;
-			else {
-				zombie_counter = 0;
-				if(num_zombies < MAX_ZOMBIES){
-					
-					zombie_index = zombie_init(); //num_zombies is incremented in the function
-					
-					if(zombie_index != -1){
-						zombie_tasks[zombie_index] = os_tsk_create_ex( zombie_task, 11, (void *) &zombie_index );
-					}
-					
-				}
-				if(zombie_spawn_freq > 25) zombie_spawn_freq -= 10;
+			//Frame barrier: every worker finished the last frame, then the
+			//collision check sees the final positions. base_task outranks the
+			//workers, so it wakes as soon as the last one is done
+			if(frame_running){
+				os_evt_wait_and(DONE_HORDE_EVT | DONE_PICKUP_EVT, 0xffff);
+				DL_Done(&job_sim);
+				os_evt_wait_and(FRAME_WORKERS_DONE & ~(DONE_HORDE_EVT | DONE_PICKUP_EVT), 0xffff);
+				world_swap();
+				os_evt_set(FRAME_GO_EVT, collision_tsk);
+				os_evt_wait_and(DONE_COLLISION_EVT, 0xffff);
+				frame_running = false;
 			}
 			
-			//Increase the speed of zombies after a certain number of iterations
-			if(z_speed_counter < 150) z_speed_counter++;
-			else {
-				z_speed_counter = 0;
-				if(max_zombie_speed < 6) max_zombie_speed += 0.3;
-				if(min_zombie_speed < 3) min_zombie_speed += 0.1;
+			//The collision check ended the game: no job is open and every
+			//worker waits for FRAME_GO, so none is deleted mid frame
+			if(!game_playing)
+				break;
+			
+			//Sleep what is left of the frame period, the frame jobs are not
+			//charged for it
+			frame_ticks = os_time_get() - frame_start;
+			if(frame_ticks < FRAME_TICKS)
+				os_dly_wait(FRAME_TICKS - frame_ticks);
+			DL_Release(&job_render);
+
+			//Follow the human, only the strip that scrolled into view is drawn
+			//(the compositor uploads newly exposed tiles itself)
+			os_mut_wait(&GLCD_mut, 0xffff);
+			if(CAM_Move(CAM_Target(world->human.x_pos + HUMAN_WIDTH/2), &strip_x, &strip_w) != 0){
+			#ifndef USE_BACKBUFFER
+				TM_Restore(strip_x, 0, strip_w, CAM_VIEW_H);
+			#endif
 			}
+			os_mut_release(&GLCD_mut);
 
-			//Start all other tasks
-			os_sem_send(&pickup_task_sem);
-			os_sem_send(&human_task_sem);
-			for(i=0;i< num_zombies; i++){
-				#ifdef PRINT_ENABLE_LOOPS
-					printf("Sending Zombie Semaphore!\n");
-				#endif
-				os_sem_send(&zombie_task_sem[i]);
-			}
+		#ifdef USE_BACKBUFFER
+			//The tasks have all finished the last frame, show it
+			compose_scene();
+		#else
+			//Redraw the background tiles the level changed
+			os_mut_wait(&GLCD_mut, 0xffff);
+			TM_Flush();
+			os_mut_release(&GLCD_mut);
+		#endif
+			DL_Done(&job_render);
+			frames_played++;
 			
-			//detect collision between human and zombies
-			os_sem_send(&collision_detect_sem);
+			serial_commands();
+
+			//Sparkle the pickups taken last frame
+			for(i=0; i<world->num_collected; i++){
+				effect_spawn(EFFECT_SPARKLE, world->collected[i].x_pos, world->collected[i].y_pos);
+			}
+
+			//Spawn the zombies scheduled for this frame
+			wave_director();
 			
-			//If the button was pressed, wake up the tast to explose the bomb
-			if(button_pressed && can_bomb){
+			//Take one queued press per frame, the bomb goes off before the workers start
+			if(can_bomb && INT0_Wait(0, &pressed_us) == OS_R_OK){
 				#ifdef PRINT_ENABLE_LOOPS
 					printf("Sending Bomb Semaphore!\n");
 				#endif
-				button_pressed = 0;
-				if(human.bombs > 0){
+				if(world->human.bombs > 0){
 					os_sem_send(&button_sem);
+					os_evt_wait_or(DONE_BOMB_EVT, 0xffff);
 				}
 			}
+
+			//Point the horde's flow field at the human
+			FF_Update(world->human.x_pos + HUMAN_WIDTH/2, world->human.y_pos + HUMAN_HEIGHT/2);
+			
+			crowd_separation();
+			world_publish();
+			
+			//Start all other tasks
+			frame_start = os_time_get();
+			DL_Release(&job_frame);
+			DL_Release(&job_input);
+			DL_Release(&job_sim);
+			DL_Release(&job_effect);
+			//One event per worker however many zombies there are
+			os_evt_set(FRAME_GO_EVT, pickup_tsk);
+			os_evt_set(FRAME_GO_EVT, human_tsk);
+			os_evt_set(FRAME_GO_EVT, effect_tsk);
+			os_evt_set(FRAME_GO_EVT, horde_tsk);
+			frame_running = true;
 		}
 		//GAME OVER
 		
 		//Kill all zombies
-		for( i= num_zombies-1 ; i >= 0; i--){
-				os_dly_wait(1);
-				kill_zombie(i);
+		for( i= 0 ; i < world->num_zombies; i++){
+				victims[i] = i;
 		}
+		kill_zombies(victims, world->num_zombies);
 		
 		//Delete all takss
 		os_tsk_delete(pickup_tsk);
@@ -1058,13 +1482,19 @@ __task void base_task( void ) {
 		os_tsk_delete(button_tsk);
 		os_tsk_delete(led_tsk);
 		os_tsk_delete(collision_tsk);
+		os_tsk_delete(effect_tsk);
+		os_tsk_delete(horde_tsk);
+		
+		//Keep the score, the flash is written once base_task is waiting
+		rank = SCORE_Add(zombies_killed);
+		save_tsk = task_create( save_task, PRIO_SAVE, "save", save_stk, sizeof(save_stk), NULL );
+		os_evt_set(SAVE_EVT, save_tsk);
 
-		GLCD_Clear(Black);                         /* Clear graphical LCD display   */
+		GLCD_ScrollTo(0);                          /* Game over screen is not scrolled */
+		SCR_Draw(&SCR_GameOver, 0, 0);             /* Skulls, "U DED" and "You have killed" */
 		GLCD_SetBackColor(Black);
 		GLCD_SetTextColor(Red);
 		////////////////////////////////01234567890123456789
-		GLCD_DisplayString(1, 0, __FI, "       U  DED       ");
-		GLCD_DisplayString(4, 0, __FI, "You have killed     ");
  		if (zombies_killed == 1){
  			GLCD_DisplayString(5, 0, __FI, "       zombie       ");
  		}
@@ -1073,12 +1503,18 @@ __task void base_task( void ) {
  		}
 		sprintf(killed, "%d", zombies_killed);    
 		GLCD_DisplayString(4,17,__FI,(unsigned char *)killed);
-
-		GLCD_Bitmap (20,22 , 20, 20, (unsigned char *)skull_map);
-		GLCD_Bitmap (280,22 , 20, 20, (unsigned char *)skull_map);
-		for (i = 20; i<=280 ;i += 20){
-			GLCD_Bitmap (i,44 , 20, 20, (unsigned char *)skull_map);
-			GLCD_Bitmap (i,0 , 20, 20, (unsigned char *)skull_map);
+		if(rank == 0){
+			GLCD_DisplayString(7, 0, __FI, "  New high score!   ");
+		}
+		else {
+			sprintf(killed, "     Best: %-5u    ", SCORE_Table()->kills[0]);
+			GLCD_DisplayString(7, 0, __FI, (unsigned char *)killed);
+		}
+		
+		MEM_Report();
+		while(1){
+			os_dly_wait(10);
+			serial_commands();
 		}
 }
 
@@ -1087,44 +1523,29 @@ __task void base_task( void ) {
  *----------------------------------------------------------------------------*/
 int main (void) {
 	int i,j;
+	U32 boot_lcd, boot_setup, boot_ready, boot_frame;
 	printf("The peripherals only work if this statement is here.\n");
 
 	
 	SystemInit();
 	SystemCoreClockUpdate();
 	
-	//Initialize
+	//Initialize, the rest of the setup runs while the LCD waits for its
+	//power up steps
+	TIMER0_Init();
+	GLCD_InitStart();
+	boot_lcd = TIMER0_Us();
 	LED_Init();                  
+	JOYSTICK_Init();
+	INT0_HwInit();                            /* NVIC writes need privilege    */
   SER_Init();                               
   ADC_Init();
-	INT0_Init();
-	GLCD_Init(); /* Initialize graphical LCD      */
-			
-  GLCD_Clear(Black);                         /* Clear graphical LCD display   */
-  GLCD_SetBackColor(Black);
-  GLCD_SetTextColor(Red);
-	
-	//Start Screen
-	//                              01234567890123456789
-  GLCD_DisplayString(0, 0, __FI, " ZOMBIE APOCALYPSE! ");
-	GLCD_DisplayString(2, 0, __FI, "The zombies are here");
-	GLCD_DisplayString(3, 0, __FI, "  How many can you  ");
-	GLCD_DisplayString(4, 0, __FI, " take down with you?");
-
-	GLCD_Bitmap (5,180 , 47, 55, (unsigned char *)hand_map);
-	GLCD_Bitmap (55,135 , 47, 55, (unsigned char *)hand_map);
-	GLCD_Bitmap (70,193 , 47, 55, (unsigned char *)hand_map);
-	GLCD_Bitmap (120,160 , 47, 55, (unsigned char *)hand_map);
-	GLCD_Bitmap (180,122 , 47, 55, (unsigned char *)hand_map);
-	GLCD_Bitmap (190,190 , 47, 55, (unsigned char *)hand_map);
-	GLCD_Bitmap (250,175 , 47, 55, (unsigned char *)hand_map);
-
+	ADC_BurstStart();
 	
 	//Initialize Bitmaps
 	for (i = 0; i < 100; i++){
 		gun_map[i] = Black;
 		human_map[i] = Green;
-		bomb_w_map[i] = 0x8C71;
 		bomb_r_map[i] = Red;
 		bomb_o_map[i] = 0xFC60;
 		bomb_y_map[i] = Yellow;
@@ -1156,19 +1577,49 @@ int main (void) {
 				human_map[i*j] = DarkGreen;
 		}
 	}
-	for (i = 0; i < 400; i++){
-		clear_rect_map[i] = 0x8C71;//0xF5A0
-	}
-	
 	for (i = 0; i < PICKUP_AREA; i++){
 		pickup_map[i] = Blue;
 	}
 
+	//Register the static RAM users for the memory report
+	MEM_AddStatic("sprite_maps", sizeof(human_map) + sizeof(gun_map) + sizeof(z_arm_map) + sizeof(z_body_map) + sizeof(zombie_map) + sizeof(pickup_map));
+	MEM_AddStatic("bomb_maps", sizeof(bomb_map) + sizeof(bomb_r_map) + sizeof(bomb_o_map) + sizeof(bomb_y_map));
+	MEM_AddStatic("entities", sizeof(worlds) + sizeof(pickup_items) + sizeof(effect_items));
+	MEM_AddStatic("glcd", GLCD_RamSize());
+	MEM_AddStatic("flowfield", FF_RamSize());
+	MEM_AddStatic("tilemap", TM_RamSize());
+	MEM_AddStatic("iap", SCORE_IAP_RAM);
+	#ifdef USE_BACKBUFFER
+	MEM_AddStatic("compose", CMP_RamSize());
+	#endif
+	
+	//Find the newest high score table in the flash log
+	SCORE_Init();
+	boot_setup = TIMER0_Us();
+	
+	while (GLCD_InitStep());
+	boot_ready = TIMER0_Us();
+	
+  GLCD_SetBackColor(Black);
+  GLCD_SetTextColor(Red);
+	
+	//Start Screen, text and hands come from tools/screens/title.png
+	SCR_Draw(&SCR_Title, 0, 0);
+	boot_frame = TIMER0_Us();
+	
+	printf("--- Boot (us since TIMER0 start) ---\n");
+	printf("lcd id read   %u\n", boot_lcd);
+	printf("setup done    %u\n", boot_setup);
+	printf("lcd ready     %u\n", boot_ready);
+	printf("first frame   %u\n", boot_frame);
+	printf("best score    %u\n", SCORE_Table()->kills[0]);
+	
 	#ifdef PRINT_ENABLE
 	printf("test");
 	#endif
-	os_sys_init( base_task );
+	MEM_StackPaint("base", base_stk, sizeof(base_stk));
+	os_sys_init_user( base_task, 1, base_stk, sizeof(base_stk) );
 
-	while ( 1 ) {}
+	while ( 1 ) {} // not reached, os_sys_init_user does not return
 		
 }
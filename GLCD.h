@@ -39,7 +39,21 @@
 #define Yellow          0xFFE0      /* 255, 255, 0   */
 #define White           0xFFFF      /* 255, 255, 255 */
 
+typedef struct {
+  unsigned int bytes;                   /* SPI bytes sent, start bytes included */
+  unsigned int windows;                 /* GLCD_SetWindow calls               */
+  unsigned int reg_writes;              /* Register writes sent               */
+  unsigned int reg_skipped;             /* Writes the register shadow saved   */
+  unsigned int glyph_hits;              /* 16x24 characters sent from cache   */
+  unsigned int glyph_misses;            /* 16x24 characters expanded          */
+} GLCD_STATS;
+
+#define GLCD_ALPHA_MAX  32              /* GLCD_Blend alpha of an opaque bitmap */
+#define GLCD_BLEND_ADD  0x100           /* GLCD_Blend alpha: add the colors     */
+
 extern void GLCD_Init           (void);
+extern void GLCD_InitStart      (void);
+extern int  GLCD_InitStep       (void);
 extern void GLCD_WindowMax      (void);
 extern void GLCD_PutPixel       (unsigned int x, unsigned int y);
 extern void GLCD_SetTextColor   (unsigned short color);
@@ -50,10 +64,21 @@ extern void GLCD_DisplayChar    (unsigned int ln, unsigned int col, unsigned cha
 extern void GLCD_DisplayString  (unsigned int ln, unsigned int col, unsigned char fi, unsigned char *s);
 extern void GLCD_ClearLn        (unsigned int ln, unsigned char fi);
 extern void GLCD_Bargraph       (unsigned int x,  unsigned int y, unsigned int w, unsigned int h, unsigned int val);
-extern void GLCD_Bitmap         (unsigned int x,  unsigned int y, unsigned int w, unsigned int h, unsigned char *bitmap);
+extern void GLCD_Bitmap         (int x,           int y,          unsigned int w, unsigned int h, unsigned char *bitmap);
+extern void GLCD_SetClip        (int x,           int y,          int w,          int h);
+extern void GLCD_Fill           (int x,           int y,          int w,          int h, unsigned short color);
+extern void GLCD_Blend          (int x,           int y,          unsigned int w, unsigned int h, unsigned char *bitmap, unsigned int alpha);
+extern void GLCD_Read           (unsigned int x,  unsigned int y, unsigned int w, unsigned int h, unsigned short *pix);
+extern void GLCD_ClipMax        (void);
 extern void GLCD_ScrollVertical (unsigned int dy);
+extern void GLCD_ScrollTo       (unsigned int line);
+extern void GLCD_WindowStart    (unsigned int x,  unsigned int y, unsigned int w, unsigned int h);
+extern void GLCD_WindowWrite    (const unsigned short *pix, unsigned int n);
+extern void GLCD_WindowStop     (void);
 
 extern void GLCD_WrCmd          (unsigned char cmd);
 extern void GLCD_WrReg          (unsigned char reg, unsigned short val); 
+extern const GLCD_STATS *GLCD_Stats (void);
+extern unsigned int GLCD_RamSize (void);
 
 #endif /* _GLCD_H */
@@ -10,8 +10,9 @@
 /******************************************************************************/
 
 
-#include <lpc17xx.h>
+#include "LPC17xx.H"
 #include "GLCD.h"
+#include "TIMER0.h"
 #include "Font_6x8_h.h"
 #include "Font_16x24_h.h"
 
@@ -19,6 +20,7 @@
 
 #define LANDSCAPE   1                   /* 1 for landscape, 0 for portrait    */
 #define ROTATE180   0                   /* 1 to rotate the screen for 180 deg */
+#define GLYPHS      8                   /* 16x24 glyphs kept expanded, 0 off  */
 
 /*********************** Hardware specific configuration **********************/
 
@@ -46,9 +48,7 @@
 
 /*------------------------- Speed dependant settings -------------------------*/
 
-/* If processor works on high frequency delay has to be increased, it can be 
-   increased by factor 2^N by this constant                                   */
-#define DELAY_2N    18
+#define BIT_US      1                   /* Half clock of the bit banged read  */
 
 /*---------------------- Graphic LCD size definitions ------------------------*/
 
@@ -82,26 +82,52 @@
 #define BG_COLOR  0                     /* Background color                   */
 #define TXT_COLOR 1                     /* Text color                         */
 
+/* tests/lcd_model.c stands in for SSP1 and the controller behind it          */
+#ifdef GLCD_SSP
+extern unsigned char GLCD_SSP (unsigned char byte);
+#endif
+
  
 /*---------------------------- Global variables ------------------------------*/
 
 /******************************************************************************/
 static volatile unsigned short Color[2] = {White, Black};
-static unsigned char Himax;
-
-/************************ Local auxiliary functions ***************************/
-
-/*******************************************************************************
-* Delay in while loop cycles                                                   *
-*   Parameter:    cnt:    number of while cycles to delay                      *
-*   Return:                                                                    *
-*******************************************************************************/
+static int Clip[4] = {0, 0, WIDTH, HEIGHT};  /* x0, y0, x1, y1 (exclusive)      */
+static GLCD_STATS Stats;
+static unsigned short Blend_buf[WIDTH]; /* GLCD_Blend read back, one row+     */
+
+#if (GLYPHS > 0)
+/* Font_16x24_h glyphs expanded to the current text and back color, LRU       */
+typedef struct {
+  unsigned short pix[16*24];
+  unsigned int   used;                  /* Last use, 0 if the slot is empty   */
+  unsigned char  c;                     /* Font index of the glyph            */
+} GLYPH;
+
+static GLYPH        Glyph[GLYPHS];
+static unsigned int Glyph_clock;
+#endif
 
-static void delay (int cnt) {
-  cnt <<= DELAY_2N;
-  while (cnt--);
-}
+/* Shadow of the window and cursor registers, see wr_reg_cached               */
+static unsigned short Shadow[8];
+static unsigned char  Shadow_ok;        /* Bit n set: Shadow[n] is valid      */
+
+/* Controller specific register access, selected once by GLCD_Init. Pixel    */
+/* data streams the same way on every controller, so fills and blits share   */
+/* one path.                                                                  */
+typedef struct {
+  void (*window)(unsigned int x, unsigned int y, unsigned int w, unsigned int h);
+  void (*cursor)(unsigned int x, unsigned int y);   /* Single pixel window   */
+  void (*span)  (unsigned int x, unsigned int y);   /* Row from x rightwards */
+  void (*scroll)(unsigned int line);
+  void (*read)  (unsigned short *pix, unsigned int n);  /* After wr_gram   */
+  unsigned char pos_slots;              /* Shadow slots moved by GRAM access  */
+} GLCD_OPS;
+
+static const GLCD_OPS *Ops;
+static unsigned char   Shadow_pos;      /* Ops->pos_slots                     */
 
+/************************ Local auxiliary functions ***************************/
 
 /*******************************************************************************
 * Transfer 1 byte over the serial communication                                *
@@ -118,7 +144,7 @@ static unsigned char spi_tran_man (unsigned char byte, unsigned int mode) {
 
   for (i = 7; i >= 0; i--) {
     LCD_CLK(0);
-    delay(1);
+    TIMER0_Wait(BIT_US);
     if (mode == OUT) {
       LCD_DAT((byte & (1 << i)) != 0);
     }
@@ -126,7 +152,7 @@ static unsigned char spi_tran_man (unsigned char byte, unsigned int mode) {
       val |= (BUS_VAL() << i);
     }
     LCD_CLK(1);
-    delay(1);
+    TIMER0_Wait(BIT_US);
   }
   return (val);
 }
@@ -140,9 +166,13 @@ static unsigned char spi_tran_man (unsigned char byte, unsigned int mode) {
 
 static __inline unsigned char spi_tran (unsigned char byte) {
 
+#ifdef GLCD_SSP
+  return (GLCD_SSP(byte));
+#else
   LPC_SSP1->DR = byte;
   while (!(LPC_SSP1->SR & RNE));        /* Wait for send to finish            */
   return (LPC_SSP1->DR);
+#endif
 }
 
 
@@ -153,6 +183,7 @@ static __inline unsigned char spi_tran (unsigned char byte) {
 *******************************************************************************/
 
 static __inline void wr_cmd (unsigned char cmd) {
+  Stats.bytes += 3;
   LCD_CS(0);
   spi_tran(SPI_START | SPI_WR | SPI_INDEX);   /* Write : RS = 0, RW = 0       */
   spi_tran(0);
@@ -168,6 +199,7 @@ static __inline void wr_cmd (unsigned char cmd) {
 *******************************************************************************/
 
 static __inline void wr_dat (unsigned short dat) {
+  Stats.bytes += 3;
   LCD_CS(0);
   spi_tran(SPI_START | SPI_WR | SPI_DATA);    /* Write : RS = 1, RW = 0       */
   spi_tran((dat >>   8));                     /* Write D8..D15                */
@@ -183,6 +215,7 @@ static __inline void wr_dat (unsigned short dat) {
 *******************************************************************************/
 
 static __inline void wr_dat_start (void) {
+  Stats.bytes += 1;
   LCD_CS(0);
   spi_tran(SPI_START | SPI_WR | SPI_DATA);    /* Write : RS = 1, RW = 0       */
 }
@@ -202,6 +235,7 @@ static __inline void wr_dat_stop (void) {
 
 /*******************************************************************************
 * Data writing to the LCD controller                                           *
+* (not counted here, pixel loops add 2 bytes per pixel to Stats.bytes)         *
 *   Parameter:    dat:    data to be written                                   *
 *   Return:                                                                    *
 *******************************************************************************/
@@ -222,6 +256,7 @@ static __inline void wr_dat_only (unsigned short dat) {
 static __inline unsigned short rd_dat (void) {
   unsigned short val = 0;
 
+  Stats.bytes += 4;
   LCD_CS(0);
   spi_tran(SPI_START | SPI_RD | SPI_DATA);    /* Read: RS = 1, RW = 1         */
   spi_tran(0);                                /* Dummy read 1                 */  
@@ -233,6 +268,65 @@ static __inline unsigned short rd_dat (void) {
 }
 
 
+/*******************************************************************************
+* Read 16 bit pixels from GRAM, after the index was set to 0x22 (ILI932x)      *
+* (the first word after the address is set is a dummy read on these           *
+*  controllers, so it is skipped before the pixels)                            *
+*   Parameter:    pix:    buffer for the pixels                                *
+*                 n:      number of pixels                                     *
+*   Return:                                                                    *
+*******************************************************************************/
+
+static void rd_gram16 (unsigned short *pix, unsigned int n) {
+  unsigned int i;
+  unsigned short val;
+
+  LCD_CS(0);
+  spi_tran(SPI_START | SPI_RD | SPI_DATA);    /* Read: RS = 1, RW = 1         */
+  spi_tran(0);                                /* Dummy read 1                 */
+  spi_tran(0);                                /* Dummy GRAM word              */
+  spi_tran(0);
+  for (i = 0; i < n; i++) {
+    val   = spi_tran(0);                      /* Read D8..D15                 */
+    val <<= 8;
+    val  |= spi_tran(0);                      /* Read D0..D7                  */
+    pix[i] = val;
+  }
+  LCD_CS(1);
+  Stats.bytes += 4 + 2*n;
+}
+
+
+/*******************************************************************************
+* Read 18 bit pixels from GRAM, after the index was set to 0x22 (HX8347)       *
+* (GRAM reads return R, G and B as 6 bits each, left aligned in one byte per  *
+*  color, also when writes are 16 bit; the first pixel is a dummy read)       *
+*   Parameter:    pix:    buffer for the pixels                                *
+*                 n:      number of pixels                                     *
+*   Return:                                                                    *
+*******************************************************************************/
+
+static void rd_gram18 (unsigned short *pix, unsigned int n) {
+  unsigned int i;
+  unsigned short val;
+
+  LCD_CS(0);
+  spi_tran(SPI_START | SPI_RD | SPI_DATA);    /* Read: RS = 1, RW = 1         */
+  spi_tran(0);                                /* Dummy read 1                 */
+  spi_tran(0);                                /* Dummy GRAM pixel             */
+  spi_tran(0);
+  spi_tran(0);
+  for (i = 0; i < n; i++) {
+    val    = (spi_tran(0) & 0xF8) << 8;       /* R5..R0, keep 5 bits          */
+    val   |= (spi_tran(0) & 0xFC) << 3;       /* G5..G0                       */
+    val   |=  spi_tran(0)         >> 3;       /* B5..B0, keep 5 bits          */
+    pix[i] = val;
+  }
+  LCD_CS(1);
+  Stats.bytes += 5 + 3*n;
+}
+
+
 /*******************************************************************************
 * Write a value to the to LCD register                                         *
 *   Parameter:    reg:    register to be written                               *
@@ -241,11 +335,46 @@ static __inline unsigned short rd_dat (void) {
 
 static __inline void wr_reg (unsigned char reg, unsigned short val) {
 
+  Stats.reg_writes++;
   wr_cmd(reg);
   wr_dat(val);
 }
 
 
+/*******************************************************************************
+* Write a window or cursor register only if it differs from the shadow copy    *
+* (every register write is an index and a data transfer, each with its own     *
+*  start byte and chip select cycle, so skipping them is the only saving)      *
+*   Parameter:    slot:   shadow slot of the register                          *
+*                 reg:    register to be written                               *
+*                 val:    value to write to the register                       *
+*******************************************************************************/
+
+static __inline void wr_reg_cached (unsigned int slot, unsigned char reg, unsigned short val) {
+
+  if ((Shadow_ok & (1 << slot)) && Shadow[slot] == val) {
+    Stats.reg_skipped++;
+    return;
+  }
+  wr_reg(reg, val);
+  Shadow[slot] = val;
+  Shadow_ok   |= 1 << slot;
+}
+
+
+/*******************************************************************************
+* Select GRAM for reading or writing                                           *
+* (the address counter moves with every pixel, so the shadow copies of the    *
+*  registers that hold the start position are no longer valid)                *
+*******************************************************************************/
+
+static __inline void wr_gram (void) {
+
+  Shadow_ok &= ~Shadow_pos;
+  wr_cmd(0x22);
+}
+
+
 /*******************************************************************************
 * Read from the LCD register                                                   *
 *   Parameter:    reg:    register to be read                                  *
@@ -294,17 +423,432 @@ static unsigned short rd_id_man (void) {
 }
 
 
+/*******************************************************************************
+* Himax HX8347 backend: 8 bit column and row registers, scroll by VSP          *
+*******************************************************************************/
+
+static void himax_window (unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
+  unsigned int xe = x+w-1;
+  unsigned int ye = y+h-1;
+
+  wr_reg_cached(0, 0x02, x  >>    8);   /* Column address start MSB           */
+  wr_reg_cached(1, 0x03, x  &  0xFF);   /* Column address start LSB           */
+  wr_reg_cached(2, 0x04, xe >>    8);   /* Column address end MSB             */
+  wr_reg_cached(3, 0x05, xe &  0xFF);   /* Column address end LSB             */
+
+  wr_reg_cached(4, 0x06, y  >>    8);   /* Row address start MSB              */
+  wr_reg_cached(5, 0x07, y  &  0xFF);   /* Row address start LSB              */
+  wr_reg_cached(6, 0x08, ye >>    8);   /* Row address end MSB                */
+  wr_reg_cached(7, 0x09, ye &  0xFF);   /* Row address end LSB                */
+}
+
+static void himax_cursor (unsigned int x, unsigned int y) {
+
+  himax_window(x, y, 1, 1);
+}
+
+static void himax_span (unsigned int x, unsigned int y) {
+
+  /* Fixed end column and row, only the start registers change               */
+  himax_window(x, y, WIDTH-x, HEIGHT-y);
+}
+
+static void himax_scroll (unsigned int line) {
+
+  wr_reg(0x01, 0x08);                   /* Scroll mode on                     */
+  wr_reg(0x14, line>>8);                /* VSP MSB                            */
+  wr_reg(0x15, line&0xFF);              /* VSP LSB                            */
+}
+
+static const GLCD_OPS Ops_himax = {
+  himax_window, himax_cursor, himax_span, himax_scroll, rd_gram18,
+  0x33                                  /* Column and row start, 0x02..0x03 and 0x06..0x07 */
+};
+
+
+/*******************************************************************************
+* ILI932x backend: window registers plus a separate GRAM cursor                *
+*******************************************************************************/
+
+static void ili_cursor (unsigned int x, unsigned int y) {
+
+ #if (LANDSCAPE == 1)
+  wr_reg_cached(4, 0x20, y);
+  wr_reg_cached(5, 0x21, x);
+ #else
+  wr_reg_cached(4, 0x20, x);
+  wr_reg_cached(5, 0x21, y);
+ #endif
+}
+
+static void ili_bounds (unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
+
+ #if (LANDSCAPE == 1)
+  wr_reg_cached(0, 0x50, y);            /* Vertical   GRAM Start Address      */
+  wr_reg_cached(1, 0x51, y+h-1);        /* Vertical   GRAM End   Address (-1) */
+  wr_reg_cached(2, 0x52, x);            /* Horizontal GRAM Start Address      */
+  wr_reg_cached(3, 0x53, x+w-1);        /* Horizontal GRAM End   Address (-1) */
+ #else
+  wr_reg_cached(0, 0x50, x);            /* Horizontal GRAM Start Address      */
+  wr_reg_cached(1, 0x51, x+w-1);        /* Horizontal GRAM End   Address (-1) */
+  wr_reg_cached(2, 0x52, y);            /* Vertical   GRAM Start Address      */
+  wr_reg_cached(3, 0x53, y+h-1);        /* Vertical   GRAM End   Address (-1) */
+ #endif
+}
+
+static void ili_window (unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
+
+  ili_bounds(x, y, w, h);
+  ili_cursor(x, y);
+}
+
+static void ili_span (unsigned int x, unsigned int y) {
+
+  /* The whole screen window stays set, only the cursor moves                 */
+  ili_bounds(0, 0, WIDTH, HEIGHT);
+  ili_cursor(x, y);
+}
+
+static void ili_scroll (unsigned int line) {
+
+  wr_reg(0x6A, line);
+  wr_reg(0x61, 3);
+}
+
+static const GLCD_OPS Ops_ili = {
+  ili_window, ili_cursor, ili_span, ili_scroll, rd_gram16,
+  0x30                                  /* Cursor, 0x20..0x21                 */
+};
+
+
+#if (GLYPHS > 0)
+/*******************************************************************************
+* Drop all expanded glyphs (text or back color changed)                        *
+*   Parameter:                                                                 *
+*   Return:                                                                    *
+*******************************************************************************/
+
+static void glyph_flush (void) {
+  unsigned int i;
+
+  for (i = 0; i < GLYPHS; i++)
+    Glyph[i].used = 0;
+}
+
+
+/*******************************************************************************
+* Expanded Font_16x24_h glyph, the least recently used slot is refilled on a   *
+* miss                                                                         *
+*   Parameter:      c:        font index                                       *
+*   Return:                   16*24 pixels in the current colors               *
+*******************************************************************************/
+
+static const unsigned short *glyph_get (unsigned char c) {
+  GLYPH *g = &Glyph[0];
+  const unsigned short *bits;
+  unsigned int i, j, pixs;
+
+  for (i = 0; i < GLYPHS; i++) {
+    if (Glyph[i].used && Glyph[i].c == c) {
+      Glyph[i].used = ++Glyph_clock;
+      Stats.glyph_hits++;
+      return Glyph[i].pix;
+    }
+    if (Glyph[i].used < g->used)
+      g = &Glyph[i];
+  }
+
+  Stats.glyph_misses++;
+  bits = &Font_16x24_h[c * 24];
+  for (j = 0; j < 24; j++) {
+    pixs = bits[j];
+    for (i = 0; i < 16; i++)
+      g->pix[j*16 + i] = Color[(pixs >> i) & 1];
+  }
+  g->c    = c;
+  g->used = ++Glyph_clock;
+  return g->pix;
+}
+#endif
+
+
+/*******************************************************************************
+* Controller init sequences: register writes and the minimum time to wait      *
+* after each one. GLCD_InitStep sends them against TIMER0, so the waits are    *
+* free for other setup.                                                        *
+*******************************************************************************/
+
+typedef struct {
+  unsigned char  reg;
+  unsigned short val;
+  unsigned short wait;                  /* ms before the next write           */
+} GLCD_INIT;
+
+typedef struct {
+  const GLCD_INIT *tab;
+  unsigned int     n;
+} GLCD_INIT_PART;
+
+
+static const GLCD_INIT Init_himax[] = {
+  /* Driving ability settings ------------------------------------------------*/
+  { 0xEA, 0x00,  0 },                   /* Power control internal used (1)    */
+  { 0xEB, 0x20,  0 },                   /* Power control internal used (2)    */
+  { 0xEC, 0x0C,  0 },                   /* Source control internal used (1)   */
+  { 0xED, 0xC7,  0 },                   /* Source control internal used (2)   */
+  { 0xE8, 0x38,  0 },                   /* Source output period Normal mode   */
+  { 0xE9, 0x10,  0 },                   /* Source output period Idle mode     */
+  { 0xF1, 0x01,  0 },                   /* RGB 18-bit interface ;0x0110       */
+  { 0xF2, 0x10,  0 },
+
+  /* Adjust the Gamma Curve --------------------------------------------------*/
+  { 0x40, 0x01,  0 },
+  { 0x41, 0x00,  0 },
+  { 0x42, 0x00,  0 },
+  { 0x43, 0x10,  0 },
+  { 0x44, 0x0E,  0 },
+  { 0x45, 0x24,  0 },
+  { 0x46, 0x04,  0 },
+  { 0x47, 0x50,  0 },
+  { 0x48, 0x02,  0 },
+  { 0x49, 0x13,  0 },
+  { 0x4A, 0x19,  0 },
+  { 0x4B, 0x19,  0 },
+  { 0x4C, 0x16,  0 },
+
+  { 0x50, 0x1B,  0 },
+  { 0x51, 0x31,  0 },
+  { 0x52, 0x2F,  0 },
+  { 0x53, 0x3F,  0 },
+  { 0x54, 0x3F,  0 },
+  { 0x55, 0x3E,  0 },
+  { 0x56, 0x2F,  0 },
+  { 0x57, 0x7B,  0 },
+  { 0x58, 0x09,  0 },
+  { 0x59, 0x06,  0 },
+  { 0x5A, 0x06,  0 },
+  { 0x5B, 0x0C,  0 },
+  { 0x5C, 0x1D,  0 },
+  { 0x5D, 0xCC,  0 },
+
+  /* Power voltage setting ---------------------------------------------------*/
+  { 0x1B, 0x1B,  0 },
+  { 0x1A, 0x01,  0 },
+  { 0x24, 0x2F,  0 },
+  { 0x25, 0x57,  0 },
+  { 0x23, 0x88,  0 },
+
+  /* Power on setting --------------------------------------------------------*/
+  { 0x18, 0x36,  0 },                   /* Internal oscillator frequency adj  */
+  { 0x19, 0x01,  0 },                   /* Enable internal oscillator         */
+  { 0x01, 0x00,  0 },                   /* Normal mode, no scrool             */
+  { 0x1F, 0x88,200 },                   /* Power control 6 - DDVDH Off        */
+  { 0x1F, 0x82, 50 },                   /* Power control 6 - Step-up: 3 x VCI */
+  { 0x1F, 0x92, 50 },                   /* Power control 6 - Step-up: On      */
+  { 0x1F, 0xD2, 50 },                   /* Power control 6 - VCOML active     */
+
+  /* Color selection ---------------------------------------------------------*/
+  { 0x17, 0x55,  0 },                   /* RGB, System interface: 16 Bit/Pixel*/
+  { 0x00, 0x00,  0 },                   /* Scrolling off, no standby          */
+
+  /* Interface config --------------------------------------------------------*/
+  { 0x2F, 0x11,  0 },                   /* LCD Drive: 1-line inversion        */
+  { 0x31, 0x00,  0 },
+  { 0x32, 0x00,  0 },                   /* DPL=0, HSPL=0, VSPL=0, EPL=0       */
+
+  /* Display on setting ------------------------------------------------------*/
+  { 0x28, 0x38,200 },                   /* PT(0,0) active, VGL/VGL            */
+  { 0x28, 0x3C,  0 },                   /* Display active, VGL/VGL            */
+
+ #if (LANDSCAPE == 1)
+  #if (ROTATE180 == 0)
+  { 0x16, 0xA8,  0 },
+  #else
+  { 0x16, 0x68,  0 },
+  #endif
+ #else
+  #if (ROTATE180 == 0)
+  { 0x16, 0x08,  0 },
+  #else
+  { 0x16, 0xC8,  0 },
+  #endif
+ #endif
+
+  /* Display scrolling settings ----------------------------------------------*/
+  { 0x0E, 0x00,  0 },                   /* TFA MSB                            */
+  { 0x0F, 0x00,  0 },                   /* TFA LSB                            */
+  { 0x10, 320 >> 8,   0 },              /* VSA MSB                            */
+  { 0x11, 320 & 0xFF, 0 },              /* VSA LSB                            */
+  { 0x12, 0x00,  0 },                   /* BFA MSB                            */
+  { 0x13, 0x00,  0 },                   /* BFA LSB                            */
+};
+
+static const GLCD_INIT Init_ili_power[] = {
+  /* Start Initial Sequence --------------------------------------------------*/
+ #if (ROTATE180 == 1)
+  { 0x01, 0x0000,  0 },                 /* Clear SS bit                       */
+ #else
+  { 0x01, 0x0100,  0 },                 /* Set SS bit                         */
+ #endif
+  { 0x02, 0x0700,  0 },                 /* Set 1 line inversion               */
+  { 0x04, 0x0000,  0 },                 /* Resize register                    */
+  { 0x08, 0x0207,  0 },                 /* 2 lines front, 7 back porch        */
+  { 0x09, 0x0000,  0 },                 /* Set non-disp area refresh cyc ISC  */
+  { 0x0A, 0x0000,  0 },                 /* FMARK function                     */
+  { 0x0C, 0x0000,  0 },                 /* RGB interface setting              */
+  { 0x0D, 0x0000,  0 },                 /* Frame marker Position              */
+  { 0x0F, 0x0000,  0 },                 /* RGB interface polarity             */
+
+  /* Power On sequence -------------------------------------------------------*/
+  { 0x10, 0x0000,  0 },                 /* Reset Power Control 1              */
+  { 0x11, 0x0000,  0 },                 /* Reset Power Control 2              */
+  { 0x12, 0x0000,  0 },                 /* Reset Power Control 3              */
+  { 0x13, 0x0000,200 },                 /* Discharge cap power voltage        */
+  { 0x10, 0x12B0,  0 },                 /* SAP, BT[3:0], AP, DSTB, SLP, STB   */
+  { 0x11, 0x0007, 50 },                 /* DC1[2:0], DC0[2:0], VC[2:0]        */
+  { 0x12, 0x01BD, 50 },                 /* VREG1OUT voltage                   */
+  { 0x13, 0x1400,  0 },                 /* VDV[4:0] for VCOM amplitude        */
+  { 0x29, 0x000E, 50 },                 /* VCM[4:0] for VCOMH                 */
+  { 0x20, 0x0000,  0 },                 /* GRAM horizontal Address            */
+  { 0x21, 0x0000,  0 },                 /* GRAM Vertical Address              */
+};
+
+/* Adjust the Gamma Curve ----------------------------------------------------*/
+static const GLCD_INIT Init_gamma_5408[] = {  /* SPFD5408 LCD Controller      */
+  { 0x30, 0x0B0D,  0 },
+  { 0x31, 0x1923,  0 },
+  { 0x32, 0x1C26,  0 },
+  { 0x33, 0x261C,  0 },
+  { 0x34, 0x2419,  0 },
+  { 0x35, 0x0D0B,  0 },
+  { 0x36, 0x1006,  0 },
+  { 0x37, 0x0610,  0 },
+  { 0x38, 0x0706,  0 },
+  { 0x39, 0x0304,  0 },
+  { 0x3A, 0x0E05,  0 },
+  { 0x3B, 0x0E01,  0 },
+  { 0x3C, 0x010E,  0 },
+  { 0x3D, 0x050E,  0 },
+  { 0x3E, 0x0403,  0 },
+  { 0x3F, 0x0607,  0 },
+};
+
+static const GLCD_INIT Init_gamma_9325[] = {  /* RM68050 LCD Controller       */
+  { 0x30, 0x0000,  0 },
+  { 0x31, 0x0607,  0 },
+  { 0x32, 0x0305,  0 },
+  { 0x35, 0x0000,  0 },
+  { 0x36, 0x1604,  0 },
+  { 0x37, 0x0204,  0 },
+  { 0x38, 0x0001,  0 },
+  { 0x39, 0x0707,  0 },
+  { 0x3C, 0x0000,  0 },
+  { 0x3D, 0x000F,  0 },
+};
+
+static const GLCD_INIT Init_gamma_9320[] = {  /* ILI9320 and other controllers*/
+  { 0x30, 0x0006,  0 },
+  { 0x31, 0x0101,  0 },
+  { 0x32, 0x0003,  0 },
+  { 0x35, 0x0106,  0 },
+  { 0x36, 0x0B02,  0 },
+  { 0x37, 0x0302,  0 },
+  { 0x38, 0x0707,  0 },
+  { 0x39, 0x0007,  0 },
+  { 0x3C, 0x0600,  0 },
+  { 0x3D, 0x020B,  0 },
+};
+
+/* Set GRAM area -------------------------------------------------------------*/
+static const GLCD_INIT Init_ili_gram[] = {
+  { 0x50, 0x0000,  0 },                 /* Horizontal GRAM Start Address      */
+  { 0x51, (HEIGHT-1), 0 },              /* Horizontal GRAM End   Address      */
+  { 0x52, 0x0000,  0 },                 /* Vertical   GRAM Start Address      */
+  { 0x53, (WIDTH-1),  0 },              /* Vertical   GRAM End   Address      */
+};
+
+/* Set Gate Scan Line, the SPFD5408 and RM68050 scan the other way -----------*/
+static const GLCD_INIT Init_gate_a700[] = {
+  { 0x60, 0xA700,  0 },
+};
+
+static const GLCD_INIT Init_gate_2700[] = {
+  { 0x60, 0x2700,  0 },
+};
+
+static const GLCD_INIT Init_ili_panel[] = {
+  { 0x61, 0x0001,  0 },                 /* NDL,VLE, REV                       */
+  { 0x6A, 0x0000,  0 },                 /* Set scrolling line                 */
+
+  /* Partial Display Control -------------------------------------------------*/
+  { 0x80, 0x0000,  0 },
+  { 0x81, 0x0000,  0 },
+  { 0x82, 0x0000,  0 },
+  { 0x83, 0x0000,  0 },
+  { 0x84, 0x0000,  0 },
+  { 0x85, 0x0000,  0 },
+
+  /* Panel Control -----------------------------------------------------------*/
+  { 0x90, 0x0010,  0 },
+  { 0x92, 0x0000,  0 },
+  { 0x93, 0x0003,  0 },
+  { 0x95, 0x0110,  0 },
+  { 0x97, 0x0000,  0 },
+  { 0x98, 0x0000,  0 },
+
+  /* Set GRAM write direction
+     I/D=11 (Horizontal : increment, Vertical : increment)                    */
+ #if (LANDSCAPE == 1)
+  /* AM=1   (address is updated in vertical writing direction)                */
+  { 0x03, 0x1038,  0 },
+ #else
+  /* AM=0   (address is updated in horizontal writing direction)              */
+  { 0x03, 0x1030,  0 },
+ #endif
+
+  { 0x07, 0x0137,  0 },                 /* 262K color and display ON          */
+};
+
+static GLCD_INIT_PART Init_seq[5];     /* Sequence chosen by GLCD_InitStart  */
+static unsigned int   Init_parts;
+static unsigned int   Init_part;        /* Next write: Init_seq[part].tab[idx]*/
+static unsigned int   Init_idx;
+static uint32_t       Init_due;         /* TIMER0 time the next write is due  */
+static unsigned char  Init_done;
+
+
+/*******************************************************************************
+* Append a table to the init sequence                                          *
+*   Parameter:      tab:      register writes                                  *
+*                   n:        number of writes                                 *
+*   Return:                                                                    *
+*******************************************************************************/
+
+static void init_add (const GLCD_INIT *tab, unsigned int n) {
+
+  Init_seq[Init_parts].tab = tab;
+  Init_seq[Init_parts].n   = n;
+  Init_parts++;
+}
+
+#define INIT_ADD(tab)   init_add(tab, sizeof(tab) / sizeof(tab[0]))
+
+
 /************************ Exported functions **********************************/
 
 /*******************************************************************************
-* Initialize the Graphic LCD controller                                        *
+* Start initializing the Graphic LCD controller: set up the interface, read    *
+* the controller ID and send the first part of its init sequence. Call         *
+* GLCD_InitStep until it returns 0 before drawing.                             *
 *   Parameter:                                                                 *
 *   Return:                                                                    *
 *******************************************************************************/
 
-void GLCD_Init (void) {
+void GLCD_InitStart (void) {
   unsigned short driverCode;
 
+  TIMER0_Init();
+
   /* Enable clock for SSP1, clock = CCLK / 2                                  */
   LPC_SC->PCONP       |= 0x00000400;
   LPC_SC->PCLKSEL0    |= 0x00200000;
@@ -331,245 +875,100 @@ void GLCD_Init (void) {
     driverCode = rd_reg(0x00);
   }
 
+  Init_parts = 0;
   if (driverCode == 0x47) {             /* LCD with HX8347-D LCD Controller   */
-    Himax = 1;                          /* Set Himax LCD controller flag      */
-    /* Driving ability settings ----------------------------------------------*/
-    wr_reg(0xEA, 0x00);                 /* Power control internal used (1)    */
-    wr_reg(0xEB, 0x20);                 /* Power control internal used (2)    */
-    wr_reg(0xEC, 0x0C);                 /* Source control internal used (1)   */
-    wr_reg(0xED, 0xC7);                 /* Source control internal used (2)   */
-    wr_reg(0xE8, 0x38);                 /* Source output period Normal mode   */
-    wr_reg(0xE9, 0x10);                 /* Source output period Idle mode     */
-    wr_reg(0xF1, 0x01);                 /* RGB 18-bit interface ;0x0110       */
-    wr_reg(0xF2, 0x10);
-
-    /* Adjust the Gamma Curve ------------------------------------------------*/
-    wr_reg(0x40, 0x01);
-    wr_reg(0x41, 0x00);
-    wr_reg(0x42, 0x00);
-    wr_reg(0x43, 0x10);
-    wr_reg(0x44, 0x0E);
-    wr_reg(0x45, 0x24);
-    wr_reg(0x46, 0x04);
-    wr_reg(0x47, 0x50);
-    wr_reg(0x48, 0x02);
-    wr_reg(0x49, 0x13);
-    wr_reg(0x4A, 0x19);
-    wr_reg(0x4B, 0x19);
-    wr_reg(0x4C, 0x16);
-
-    wr_reg(0x50, 0x1B);
-    wr_reg(0x51, 0x31);
-    wr_reg(0x52, 0x2F);
-    wr_reg(0x53, 0x3F);
-    wr_reg(0x54, 0x3F);
-    wr_reg(0x55, 0x3E);
-    wr_reg(0x56, 0x2F);
-    wr_reg(0x57, 0x7B);
-    wr_reg(0x58, 0x09);
-    wr_reg(0x59, 0x06);
-    wr_reg(0x5A, 0x06);
-    wr_reg(0x5B, 0x0C);
-    wr_reg(0x5C, 0x1D);
-    wr_reg(0x5D, 0xCC);
-
-    /* Power voltage setting -------------------------------------------------*/
-    wr_reg(0x1B, 0x1B);
-    wr_reg(0x1A, 0x01);
-    wr_reg(0x24, 0x2F);
-    wr_reg(0x25, 0x57);
-    wr_reg(0x23, 0x88);
-
-    /* Power on setting ------------------------------------------------------*/
-    wr_reg(0x18, 0x36);                 /* Internal oscillator frequency adj  */
-    wr_reg(0x19, 0x01);                 /* Enable internal oscillator         */
-    wr_reg(0x01, 0x00);                 /* Normal mode, no scrool             */
-    wr_reg(0x1F, 0x88);                 /* Power control 6 - DDVDH Off        */
-    delay(20);
-    wr_reg(0x1F, 0x82);                 /* Power control 6 - Step-up: 3 x VCI */
-    delay(5);
-    wr_reg(0x1F, 0x92);                 /* Power control 6 - Step-up: On      */
-    delay(5);
-    wr_reg(0x1F, 0xD2);                 /* Power control 6 - VCOML active     */
-    delay(5);
-
-    /* Color selection -------------------------------------------------------*/
-    wr_reg(0x17, 0x55);                 /* RGB, System interface: 16 Bit/Pixel*/
-    wr_reg(0x00, 0x00);                 /* Scrolling off, no standby          */
-
-    /* Interface config ------------------------------------------------------*/
-    wr_reg(0x2F, 0x11);                 /* LCD Drive: 1-line inversion        */
-    wr_reg(0x31, 0x00);
-    wr_reg(0x32, 0x00);                 /* DPL=0, HSPL=0, VSPL=0, EPL=0       */
-
-    /* Display on setting ----------------------------------------------------*/
-    wr_reg(0x28, 0x38);                 /* PT(0,0) active, VGL/VGL            */
-    delay(20);
-    wr_reg(0x28, 0x3C);                 /* Display active, VGL/VGL            */
-
-   #if (LANDSCAPE == 1)
-    #if (ROTATE180 == 0)
-     wr_reg (0x16, 0xA8);
-    #else
-     wr_reg (0x16, 0x68);
-    #endif
-   #else
-    #if (ROTATE180 == 0)
-     wr_reg (0x16, 0x08);
-    #else
-     wr_reg (0x16, 0xC8);
-    #endif
-   #endif
-
-    /* Display scrolling settings --------------------------------------------*/
-    wr_reg(0x0E, 0x00);                 /* TFA MSB                            */
-    wr_reg(0x0F, 0x00);                 /* TFA LSB                            */
-    wr_reg(0x10, 320 >> 8);             /* VSA MSB                            */
-    wr_reg(0x11, 320 &  0xFF);          /* VSA LSB                            */
-    wr_reg(0x12, 0x00);                 /* BFA MSB                            */
-    wr_reg(0x13, 0x00);                 /* BFA LSB                            */
+    Ops = &Ops_himax;                   /* Select the Himax backend           */
+    INIT_ADD(Init_himax);
   }
   else {
-    Himax = 0;                          /* This is not Himax LCD controller   */
-    /* Start Initial Sequence ------------------------------------------------*/
-   #if (ROTATE180 == 1)
-    wr_reg(0x01, 0x0000);               /* Clear SS bit                       */
-   #else
-    wr_reg(0x01, 0x0100);               /* Set SS bit                         */
-   #endif
-    wr_reg(0x02, 0x0700);               /* Set 1 line inversion               */
-    wr_reg(0x04, 0x0000);               /* Resize register                    */
-    wr_reg(0x08, 0x0207);               /* 2 lines front, 7 back porch        */
-    wr_reg(0x09, 0x0000);               /* Set non-disp area refresh cyc ISC  */
-    wr_reg(0x0A, 0x0000);               /* FMARK function                     */
-    wr_reg(0x0C, 0x0000);               /* RGB interface setting              */
-    wr_reg(0x0D, 0x0000);               /* Frame marker Position              */
-    wr_reg(0x0F, 0x0000);               /* RGB interface polarity             */
-
-    /* Power On sequence -----------------------------------------------------*/
-    wr_reg(0x10, 0x0000);               /* Reset Power Control 1              */
-    wr_reg(0x11, 0x0000);               /* Reset Power Control 2              */
-    wr_reg(0x12, 0x0000);               /* Reset Power Control 3              */
-    wr_reg(0x13, 0x0000);               /* Reset Power Control 4              */
-    delay(20);                          /* Discharge cap power voltage (200ms)*/
-    wr_reg(0x10, 0x12B0);               /* SAP, BT[3:0], AP, DSTB, SLP, STB   */
-    wr_reg(0x11, 0x0007);               /* DC1[2:0], DC0[2:0], VC[2:0]        */
-    delay(5);                           /* Delay 50 ms                        */
-    wr_reg(0x12, 0x01BD);               /* VREG1OUT voltage                   */
-    delay(5);                           /* Delay 50 ms                        */
-    wr_reg(0x13, 0x1400);               /* VDV[4:0] for VCOM amplitude        */
-    wr_reg(0x29, 0x000E);               /* VCM[4:0] for VCOMH                 */
-    delay(5);                           /* Delay 50 ms                        */
-    wr_reg(0x20, 0x0000);               /* GRAM horizontal Address            */
-    wr_reg(0x21, 0x0000);               /* GRAM Vertical Address              */
-
-    /* Adjust the Gamma Curve ------------------------------------------------*/
+    Ops = &Ops_ili;                     /* This is not Himax LCD controller   */
+    INIT_ADD(Init_ili_power);
     switch (driverCode) {
       case 0x5408:                      /* LCD with SPFD5408 LCD Controller   */
-        wr_reg(0x30, 0x0B0D);
-        wr_reg(0x31, 0x1923);
-        wr_reg(0x32, 0x1C26);
-        wr_reg(0x33, 0x261C);
-        wr_reg(0x34, 0x2419);
-        wr_reg(0x35, 0x0D0B);
-        wr_reg(0x36, 0x1006);
-        wr_reg(0x37, 0x0610);
-        wr_reg(0x38, 0x0706);
-        wr_reg(0x39, 0x0304);
-        wr_reg(0x3A, 0x0E05);
-        wr_reg(0x3B, 0x0E01);
-        wr_reg(0x3C, 0x010E);
-        wr_reg(0x3D, 0x050E);
-        wr_reg(0x3E, 0x0403);
-        wr_reg(0x3F, 0x0607);
+        INIT_ADD(Init_gamma_5408);
         break;
-
       case 0x9325:                      /* LCD with RM68050 LCD Controller    */
-        wr_reg(0x0030,0x0000);
-        wr_reg(0x0031,0x0607);
-        wr_reg(0x0032,0x0305);
-        wr_reg(0x0035,0x0000);
-        wr_reg(0x0036,0x1604);
-        wr_reg(0x0037,0x0204);
-        wr_reg(0x0038,0x0001);
-        wr_reg(0x0039,0x0707);
-        wr_reg(0x003C,0x0000);
-        wr_reg(0x003D,0x000F);
+        INIT_ADD(Init_gamma_9325);
         break;
-
       case 0x9320:                      /* LCD with ILI9320 LCD Controller    */
       default:                          /* LCD with other LCD Controller      */
-        wr_reg(0x30, 0x0006);
-        wr_reg(0x31, 0x0101);
-        wr_reg(0x32, 0x0003);
-        wr_reg(0x35, 0x0106);
-        wr_reg(0x36, 0x0B02);
-        wr_reg(0x37, 0x0302);
-        wr_reg(0x38, 0x0707);
-        wr_reg(0x39, 0x0007);
-        wr_reg(0x3C, 0x0600);
-        wr_reg(0x3D, 0x020B);
+        INIT_ADD(Init_gamma_9320);
         break;
     }
-
-    /* Set GRAM area ---------------------------------------------------------*/
-    wr_reg(0x50, 0x0000);               /* Horizontal GRAM Start Address      */
-    wr_reg(0x51, (HEIGHT-1));           /* Horizontal GRAM End   Address      */
-    wr_reg(0x52, 0x0000);               /* Vertical   GRAM Start Address      */
-    wr_reg(0x53, (WIDTH-1));            /* Vertical   GRAM End   Address      */
-
-    /* Set Gate Scan Line ----------------------------------------------------*/
+    INIT_ADD(Init_ili_gram);
     switch (driverCode) {
       case 0x5408:                      /* LCD with SPFD5408 LCD Controller   */
       case 0x9325:                      /* LCD with RM68050 LCD Controller    */
        #if (LANDSCAPE ^ ROTATE180)
-        wr_reg(0x60, 0x2700);
+        INIT_ADD(Init_gate_2700);
        #else
-        wr_reg(0x60, 0xA700);
+        INIT_ADD(Init_gate_a700);
        #endif
         break;
 
       case 0x9320:                      /* LCD with ILI9320 LCD Controller    */
       default:                          /* LCD with other LCD Controller      */
        #if (LANDSCAPE ^ ROTATE180)
-        wr_reg(0x60, 0xA700);
+        INIT_ADD(Init_gate_a700);
        #else
-        wr_reg(0x60, 0x2700);
+        INIT_ADD(Init_gate_2700);
        #endif
         break;
     }
-    wr_reg(0x61, 0x0001);               /* NDL,VLE, REV                       */
-    wr_reg(0x6A, 0x0000);               /* Set scrolling line                 */
-
-    /* Partial Display Control -----------------------------------------------*/
-    wr_reg(0x80, 0x0000);
-    wr_reg(0x81, 0x0000);
-    wr_reg(0x82, 0x0000);
-    wr_reg(0x83, 0x0000);
-    wr_reg(0x84, 0x0000);
-    wr_reg(0x85, 0x0000);
-
-    /* Panel Control ---------------------------------------------------------*/
-    wr_reg(0x90, 0x0010);
-    wr_reg(0x92, 0x0000);
-    wr_reg(0x93, 0x0003);
-    wr_reg(0x95, 0x0110);
-    wr_reg(0x97, 0x0000);
-    wr_reg(0x98, 0x0000);
-
-    /* Set GRAM write direction
-       I/D=11 (Horizontal : increment, Vertical : increment)                  */
-  #if (LANDSCAPE == 1)
-    /* AM=1   (address is updated in vertical writing direction)              */
-    wr_reg(0x03, 0x1038);
-  #else
-    /* AM=0   (address is updated in horizontal writing direction)            */
-    wr_reg(0x03, 0x1030);
-  #endif
+    INIT_ADD(Init_ili_panel);
+  }
+
+  Init_part = 0;
+  Init_idx  = 0;
+  Init_due  = TIMER0_Us();
+  Init_done = 0;
+  GLCD_InitStep();
+}
+
+
+/*******************************************************************************
+* Send the init writes that are due                                            *
+*   Parameter:                                                                 *
+*   Return:               1 while the sequence is still running                *
+*******************************************************************************/
+
+int GLCD_InitStep (void) {
+  const GLCD_INIT *w;
+
+  while (!Init_done) {
+    if ((int)(TIMER0_Us() - Init_due) < 0)
+      return 1;
+
+    if (Init_part == Init_parts) {
+      Shadow_pos = Ops->pos_slots;
+      Shadow_ok  = 0;                   /* Init wrote the registers directly  */
+      LPC_GPIO4->FIOSET = 0x10000000;
+      Init_done  = 1;
+      break;
+    }
 
-    wr_reg(0x07, 0x0137);               /* 262K color and display ON          */
+    w = &Init_seq[Init_part].tab[Init_idx];
+    wr_reg(w->reg, w->val);
+    Init_due = TIMER0_Us() + w->wait * 1000;
+    if (++Init_idx == Init_seq[Init_part].n) {
+      Init_idx = 0;
+      Init_part++;
+    }
   }
-  LPC_GPIO4->FIOSET = 0x10000000;
+  return 0;
+}
+
+
+/*******************************************************************************
+* Initialize the Graphic LCD controller                                        *
+*   Parameter:                                                                 *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_Init (void) {
+
+  GLCD_InitStart();
+  while (GLCD_InitStep());
 }
 
 
@@ -583,39 +982,9 @@ void GLCD_Init (void) {
 *******************************************************************************/
 
 void GLCD_SetWindow (unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
-  unsigned int xe, ye;
-
-  if (Himax) {
-    xe = x+w-1;
-    ye = y+h-1;
 
-    wr_reg(0x02, x  >>    8);           /* Column address start MSB           */
-    wr_reg(0x03, x  &  0xFF);           /* Column address start LSB           */
-    wr_reg(0x04, xe >>    8);           /* Column address end MSB             */
-    wr_reg(0x05, xe &  0xFF);           /* Column address end LSB             */
-  
-    wr_reg(0x06, y  >>    8);           /* Row address start MSB              */
-    wr_reg(0x07, y  &  0xFF);           /* Row address start LSB              */
-    wr_reg(0x08, ye >>    8);           /* Row address end MSB                */
-    wr_reg(0x09, ye &  0xFF);           /* Row address end LSB                */
-  }
-  else {
-   #if (LANDSCAPE == 1)
-    wr_reg(0x50, y);                    /* Vertical   GRAM Start Address      */
-    wr_reg(0x51, y+h-1);                /* Vertical   GRAM End   Address (-1) */
-    wr_reg(0x52, x);                    /* Horizontal GRAM Start Address      */
-    wr_reg(0x53, x+w-1);                /* Horizontal GRAM End   Address (-1) */
-    wr_reg(0x20, y);
-    wr_reg(0x21, x);
-   #else
-    wr_reg(0x50, x);                    /* Horizontal GRAM Start Address      */
-    wr_reg(0x51, x+w-1);                /* Horizontal GRAM End   Address (-1) */
-    wr_reg(0x52, y);                    /* Vertical   GRAM Start Address      */
-    wr_reg(0x53, y+h-1);                /* Vertical   GRAM End   Address (-1) */
-    wr_reg(0x20, x);
-    wr_reg(0x21, y);
-   #endif
-  }
+  Stats.windows++;
+  Ops->window(x, y, w, h);
 }
 
 
@@ -639,28 +1008,9 @@ void GLCD_WindowMax (void) {
 
 void GLCD_PutPixel (unsigned int x, unsigned int y) {
 
-  if (Himax) {
-    wr_reg(0x02, x >>    8);            /* Column address start MSB           */
-    wr_reg(0x03, x &  0xFF);            /* Column address start LSB           */
-    wr_reg(0x04, x >>    8);            /* Column address end MSB             */
-    wr_reg(0x05, x &  0xFF);            /* Column address end LSB             */
-  
-    wr_reg(0x06, y >>    8);            /* Row address start MSB              */
-    wr_reg(0x07, y &  0xFF);            /* Row address start LSB              */
-    wr_reg(0x08, y >>    8);            /* Row address end MSB                */
-    wr_reg(0x09, y &  0xFF);            /* Row address end LSB                */
-  }
-  else {
-   #if (LANDSCAPE == 1)
-    wr_reg(0x20, y);
-    wr_reg(0x21, x);
-   #else
-    wr_reg(0x20, x);
-    wr_reg(0x21, y);
-   #endif
-  }
+  Ops->cursor(x, y);
 
-  wr_cmd(0x22);
+  wr_gram();
   wr_dat(Color[TXT_COLOR]);
 }
 
@@ -673,6 +1023,10 @@ void GLCD_PutPixel (unsigned int x, unsigned int y) {
 
 void GLCD_SetTextColor (unsigned short color) {
 
+#if (GLYPHS > 0)
+  if (Color[TXT_COLOR] != color)
+    glyph_flush();
+#endif
   Color[TXT_COLOR] = color;
 }
 
@@ -685,6 +1039,10 @@ void GLCD_SetTextColor (unsigned short color) {
 
 void GLCD_SetBackColor (unsigned short color) {
 
+#if (GLYPHS > 0)
+  if (Color[BG_COLOR] != color)
+    glyph_flush();
+#endif
   Color[BG_COLOR] = color;
 }
 
@@ -699,12 +1057,13 @@ void GLCD_Clear (unsigned short color) {
   unsigned int i;
 
   GLCD_WindowMax();
-  wr_cmd(0x22);
+  wr_gram();
   wr_dat_start();
 
   for(i = 0; i < (WIDTH*HEIGHT); i++)
     wr_dat_only(color);
   wr_dat_stop();
+  Stats.bytes += 2*WIDTH*HEIGHT;
 }
 
 
@@ -723,7 +1082,7 @@ void GLCD_DrawChar (unsigned int x, unsigned int y, unsigned int cw, unsigned in
 
   GLCD_SetWindow(x, y, cw, ch);
 
-  wr_cmd(0x22);
+  wr_gram();
   wr_dat_start();
 
   k  = (cw + 7)/8;
@@ -749,6 +1108,7 @@ void GLCD_DrawChar (unsigned int x, unsigned int y, unsigned int cw, unsigned in
     }
   }
   wr_dat_stop();
+  Stats.bytes += 2*cw*ch;
 }
 
 
@@ -769,7 +1129,15 @@ void GLCD_DisplayChar (unsigned int ln, unsigned int col, unsigned char fi, unsi
       GLCD_DrawChar(col *  6, ln *  8,  6,  8, (unsigned char *)&Font_6x8_h  [c * 8]);
       break;
     case 1:  /* Font 16 x 24 */
+#if (GLYPHS > 0)
+      GLCD_SetWindow(col * 16, ln * 24, 16, 24);
+      wr_gram();
+      wr_dat_start();
+      GLCD_WindowWrite(glyph_get(c), 16*24);
+      wr_dat_stop();
+#else
       GLCD_DrawChar(col * 16, ln * 24, 16, 24, (unsigned char *)&Font_16x24_h[c * 24]);
+#endif
       break;
   }
 }
@@ -834,7 +1202,7 @@ void GLCD_Bargraph (unsigned int x, unsigned int y, unsigned int w, unsigned int
 
   val = (val * w) >> 10;                /* Scale value                        */
   GLCD_SetWindow(x, y, w, h);
-  wr_cmd(0x22);
+  wr_gram();
   wr_dat_start();
   for (i = 0; i < h; i++) {
     for (j = 0; j <= w-1; j++) {
@@ -846,6 +1214,90 @@ void GLCD_Bargraph (unsigned int x, unsigned int y, unsigned int w, unsigned int
     }
   }
   wr_dat_stop();
+  Stats.bytes += 2*w*h;
+}
+
+
+/*******************************************************************************
+* Restrict GLCD_Bitmap to a rectangle of the screen                            *
+*   Parameter:      x:        horizontal position                              *
+*                   y:        vertical position                                *
+*                   w:        clip width in pixel                              *
+*                   h:        clip height in pixels                            *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_SetClip (int x, int y, int w, int h) {
+
+  Clip[0] = (x > 0) ? x : 0;
+  Clip[1] = (y > 0) ? y : 0;
+  Clip[2] = (x + w < WIDTH)  ? x + w : WIDTH;
+  Clip[3] = (y + h < HEIGHT) ? y + h : HEIGHT;
+}
+
+
+/*******************************************************************************
+* Reset the clip rectangle to the whole screen                                 *
+*   Parameter:                                                                 *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_ClipMax (void) {
+
+  GLCD_SetClip (0, 0, WIDTH, HEIGHT);
+}
+
+
+/*******************************************************************************
+* Trim a rectangle to the clip rectangle                                       *
+*   Parameter:      x, y:     position, may be negative                        *
+*                   w, h:     size in pixels                                   *
+*                   r:        x0, y0, x1, y1 (exclusive) of the visible part   *
+*   Return:                   0 if nothing is visible                          *
+*******************************************************************************/
+
+static int clip_rect (int x, int y, int w, int h, int *r) {
+
+  r[0] = (x > Clip[0]) ? x : Clip[0];
+  r[1] = (y > Clip[1]) ? y : Clip[1];
+  r[2] = (x + w < Clip[2]) ? x + w : Clip[2];
+  r[3] = (y + h < Clip[3]) ? y + h : Clip[3];
+  return (r[0] < r[2] && r[1] < r[3]);
+}
+
+
+/*******************************************************************************
+* Fill a rectangle with one color, clipped like GLCD_Bitmap                    *
+* (a single row only moves the start position, so row spans are cheap)        *
+*   Parameter:      x:        horizontal position, may be negative             *
+*                   y:        vertical position, may be negative               *
+*                   w:        rectangle width in pixel                         *
+*                   h:        rectangle height in pixels                       *
+*                   color:    fill color                                       *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_Fill (int x, int y, int w, int h, unsigned short color) {
+  int r[4], x0, y0, x1, y1, i, n;
+
+  if (!clip_rect(x, y, w, h, r))
+    return;
+  x0 = r[0];  y0 = r[1];  x1 = r[2];  y1 = r[3];
+
+  n = (x1-x0)*(y1-y0);
+  if (n == x1-x0) {
+    Stats.windows++;
+    Ops->span(x0, y0);                  /* One row, keep the window if we can */
+  }
+  else {
+    GLCD_SetWindow (x0, y0, x1-x0, y1-y0);
+  }
+  wr_gram();
+  wr_dat_start();
+  for (i = 0; i < n; i++)
+    wr_dat_only(color);
+  wr_dat_stop();
+  Stats.bytes += 2*n;
 }
 
 
@@ -853,56 +1305,213 @@ void GLCD_Bargraph (unsigned int x, unsigned int y, unsigned int w, unsigned int
 * Display graphical bitmap image at position x horizontally and y vertically   *
 * (This function is optimized for 16 bits per pixel format, it has to be       *
 *  adapted for any other bits per pixel format)                                *
+* The bitmap may lie partly or fully outside the clip rectangle, only the      *
+* visible part is sent to the controller                                       *
+*   Parameter:      x:        horizontal position, may be negative             *
+*                   y:        vertical position, may be negative               *
+*                   w:        width of bitmap                                  *
+*                   h:        height of bitmap                                 *
+*                   bitmap:   address at which the bitmap data resides         *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_Bitmap (int x, int y, unsigned int w, unsigned int h, unsigned char *bitmap) {
+  int r[4], x0, y0, x1, y1, row, j;
+  unsigned short *bitmap_ptr;
+
+  if (!clip_rect(x, y, (int)w, (int)h, r))
+    return;                             /* Nothing visible, no SPI traffic    */
+  x0 = r[0];  y0 = r[1];  x1 = r[2];  y1 = r[3];
+
+  GLCD_SetWindow (x0, y0, x1-x0, y1-y0);
+
+  wr_gram();
+  wr_dat_start();
+  for (row = y0; row < y1; row++) {
+    /* Rows are stored bottom up                                              */
+    bitmap_ptr = (unsigned short *)bitmap + (y+(int)h-1-row)*(int)w + (x0-x);
+    for (j = x0; j < x1; j++) {
+      wr_dat_only (*bitmap_ptr++);
+    }
+  }
+  wr_dat_stop();
+  Stats.bytes += 2*(x1-x0)*(y1-y0);
+}
+
+
+
+/*******************************************************************************
+* Read back a rectangle of GRAM, rows top to bottom                            *
 *   Parameter:      x:        horizontal position                              *
 *                   y:        vertical position                                *
+*                   w:        width in pixel                                   *
+*                   h:        height in pixels                                 *
+*                   pix:      buffer for w*h pixels                            *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_Read (unsigned int x, unsigned int y, unsigned int w, unsigned int h, unsigned short *pix) {
+
+  GLCD_SetWindow (x, y, w, h);
+  wr_gram();
+  Ops->read(pix, w*h);
+}
+
+
+/*******************************************************************************
+* Blend a bitmap with what is on screen: read back, mix in RAM, write back    *
+* (same layout and clipping as GLCD_Bitmap)                                    *
+*   Parameter:      x:        horizontal position, may be negative             *
+*                   y:        vertical position, may be negative               *
 *                   w:        width of bitmap                                  *
 *                   h:        height of bitmap                                 *
 *                   bitmap:   address at which the bitmap data resides         *
+*                   alpha:    bitmap weight 0..GLCD_ALPHA_MAX, or              *
+*                             GLCD_BLEND_ADD to add the colors (saturating);   *
+*                             other values above GLCD_ALPHA_MAX are opaque     *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_Blend (int x, int y, unsigned int w, unsigned int h, unsigned char *bitmap, unsigned int alpha) {
+  int rc[4], x0, y0, x1, y1, cw, row, rows, r, j;
+  unsigned short *src, *dst;
+  unsigned int s, d, c;
+
+  /* The mix below needs alpha <= GLCD_ALPHA_MAX, larger would wrap fields    */
+  if (alpha > GLCD_ALPHA_MAX && alpha != GLCD_BLEND_ADD)
+    alpha = GLCD_ALPHA_MAX;
+  if (alpha == GLCD_ALPHA_MAX) {
+    GLCD_Bitmap(x, y, w, h, bitmap);    /* Opaque, nothing to read            */
+    return;
+  }
+
+  if (!clip_rect(x, y, (int)w, (int)h, rc) || alpha == 0)
+    return;
+  x0 = rc[0];  y0 = rc[1];  x1 = rc[2];  y1 = rc[3];
+
+  /* As many rows at a time as fit in the buffer                              */
+  cw = x1-x0;
+  for (row = y0; row < y1; row += rows) {
+    rows = WIDTH / cw;
+    if (rows > y1-row) rows = y1-row;
+
+    GLCD_Read(x0, row, cw, rows, Blend_buf);
+
+    dst = Blend_buf;
+    for (r = row; r < row+rows; r++) {
+      /* Rows are stored bottom up                                            */
+      src = (unsigned short *)bitmap + (y+(int)h-1-r)*(int)w + (x0-x);
+      if (alpha == GLCD_BLEND_ADD) {
+        for (j = 0; j < cw; j++, src++, dst++) {
+          s = *src;
+          d = *dst;
+          c  = ((d & 0xF800) + (s & 0xF800) > 0xF800) ? 0xF800 : (d & 0xF800) + (s & 0xF800);
+          c |= ((d & 0x07E0) + (s & 0x07E0) > 0x07E0) ? 0x07E0 : (d & 0x07E0) + (s & 0x07E0);
+          c |= ((d & 0x001F) + (s & 0x001F) > 0x001F) ? 0x001F : (d & 0x001F) + (s & 0x001F);
+          *dst = c;
+        }
+      }
+      else {
+        /* Spread to G--R--B fields so one multiply scales all three          */
+        for (j = 0; j < cw; j++, src++, dst++) {
+          s = (*src | ((unsigned int)*src << 16)) & 0x07E0F81F;
+          d = (*dst | ((unsigned int)*dst << 16)) & 0x07E0F81F;
+          d = ((s*alpha + d*(GLCD_ALPHA_MAX-alpha)) >> 5) & 0x07E0F81F;
+          *dst = d | (d >> 16);
+        }
+      }
+    }
+
+    GLCD_SetWindow (x0, row, cw, rows);  /* Reading moved the start position  */
+    wr_gram();
+    wr_dat_start();
+    for (j = 0; j < cw*rows; j++)
+      wr_dat_only(Blend_buf[j]);
+    wr_dat_stop();
+    Stats.bytes += 2*cw*rows;
+  }
+}
+
+
+/*******************************************************************************
+* Open a window and start streaming pixels into it, rows top to bottom         *
+* (GLCD_WindowWrite sends the pixels, GLCD_WindowStop ends the transfer)       *
+*   Parameter:      x:        horizontal position                              *
+*                   y:        vertical position                                *
+*                   w:        window width in pixel                            *
+*                   h:        window height in pixels                          *
 *   Return:                                                                    *
 *******************************************************************************/
 
-void GLCD_Bitmap (unsigned int x, unsigned int y, unsigned int w, unsigned int h, unsigned char *bitmap) {
-  int i, j;
-  unsigned short *bitmap_ptr = (unsigned short *)bitmap;
+void GLCD_WindowStart (unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
 
   GLCD_SetWindow (x, y, w, h);
 
-  wr_cmd(0x22);
+  wr_gram();
   wr_dat_start();
-  for (i = (h-1)*w; i > -1; i -= w) {
-    for (j = 0; j < w; j++) {
-      wr_dat_only (bitmap_ptr[i+j]);
-    }
+}
+
+
+/*******************************************************************************
+* Stream pixels into the window opened by GLCD_WindowStart                     *
+*   Parameter:      pix:      pixels in 16 bit color                           *
+*                   n:        number of pixels                                 *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_WindowWrite (const unsigned short *pix, unsigned int n) {
+  unsigned int i;
+
+  for (i = 0; i < n; i++) {
+    wr_dat_only (pix[i]);
   }
+  Stats.bytes += 2*n;
+}
+
+
+/*******************************************************************************
+* End the pixel stream started by GLCD_WindowStart                             *
+*   Parameter:                                                                 *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_WindowStop (void) {
+
   wr_dat_stop();
 }
 
 
+/*******************************************************************************
+* Set the hardware scroll offset along the 320 line axis of the panel          *
+* (vertical in portrait, horizontal in landscape): screen line n then shows    *
+* GRAM line (n + line) modulo 320                                              *
+*   Parameter:      line:     first GRAM line shown                            *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_ScrollTo (unsigned int line) {
+
+  while (line >= 320)
+    line -= 320;
+
+  Ops->scroll(line);
+}
+
 
 /*******************************************************************************
-* Scroll content of the whole display for dy pixels vertically                 *
-*   Parameter:      dy:       number of pixels for vertical scroll             *
+* Scroll content of the whole display for dy pixels along the 320 line axis   *
+*   Parameter:      dy:       number of pixels to scroll                       *
 *   Return:                                                                    *
 *******************************************************************************/
 
 void GLCD_ScrollVertical (unsigned int dy) {
-#if (LANDSCAPE == 0)
   static unsigned int y = 0;
 
   y = y + dy;
-  while (y >= HEIGHT)
-    y -= HEIGHT;
+  while (y >= 320)
+    y -= 320;
 
-  if (Himax) {
-    wr_reg(0x01, 0x08);
-    wr_reg(0x14, y>>8);                 /* VSP MSB                            */
-    wr_reg(0x15, y&0xFF);               /* VSP LSB                            */
-  }
-  else {
-    wr_reg(0x6A, y);
-    wr_reg(0x61, 3);
-  }
-#endif
+  GLCD_ScrollTo(y);
 }
 
 
@@ -923,6 +1532,31 @@ void GLCD_WrCmd (unsigned char cmd) {
 *   Return:                                                                    *
 *******************************************************************************/
 void GLCD_WrReg (unsigned char reg, unsigned short val) {
+  Shadow_ok = 0;                        /* May be a shadowed register         */
   wr_reg (reg, val);
 }
+
+
+/*******************************************************************************
+* SPI traffic since GLCD_Init                                                  *
+*   Parameter:                                                                 *
+*   Return:               running totals                                       *
+*******************************************************************************/
+const GLCD_STATS *GLCD_Stats (void) {
+  return &Stats;
+}
+
+
+/*******************************************************************************
+* RAM the driver keeps for itself, for the memory report                       *
+*   Parameter:                                                                 *
+*   Return:               bytes of read back buffer and glyph cache            *
+*******************************************************************************/
+unsigned int GLCD_RamSize (void) {
+#if (GLYPHS > 0)
+  return sizeof(Blend_buf) + sizeof(Glyph);
+#else
+  return sizeof(Blend_buf);
+#endif
+}
 /******************************************************************************/
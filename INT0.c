@@ -1,52 +1,107 @@
 /*----------------------------------------------------------------------------
  * Name:    INT0.c
  * Purpose: button
- * Note(s):
+ * Note(s): Each debounced press is sent with its TIMER0 time to a mailbox,
+ *          so presses between reads queue up instead of collapsing. Both
+ *          edges interrupt: a falling edge only counts as a press when
+ *          the line was quiet for INT0_DEBOUNCE_US, which drops the bounce
+ *          of the press and of the release.
  *----------------------------------------------------------------------------
 
  *----------------------------------------------------------------------------*/
 
 #include "LPC17xx.H"                         /* LPC17xx definitions           */
 #include "INT0.h"
+#include "TIMER0.h"
 #include <RTL.h>  
 
+#define INT0_PIN (1 << 10)
+
+os_mbx_declare(INT0_mbx, INT0_QUEUE);
+
+static uint32_t last_edge_us;
+static volatile uint8_t int0_started;
+static int0_stats_t int0_stats;
+
 /*----------------------------------------------------------------------------
-  initialize LED Pins
+  initialize the button, call from main() before os_sys_init_user: the
+  tasks run unprivileged and may not write the NVIC
  *----------------------------------------------------------------------------*/
-volatile int button_pressed = 0;
+void INT0_HwInit (void) {
 
-void INT0_Init (void) {
+	TIMER0_Init();
+	last_edge_us = TIMER0_Us();
 
 	// P2.10 is related to the INT0 or the push button.
 	// P2.10 is selected for the GPIO 
 	LPC_PINCON->PINSEL4 &= ~(3<<20); 
 
 	// P2.10 is an input port
-	LPC_GPIO2->FIODIR   &= ~(1<<10); 
+	LPC_GPIO2->FIODIR   &= ~INT0_PIN; 
 
-	// P2.10 reads the falling edges to generate the IRQ
-	// - falling edge of P2.10
-	LPC_GPIOINT->IO2IntEnF |= (1 << 10);
+	// P2.10 reads both edges to generate the IRQ, the rising edge only
+	// restarts the debounce time
+	LPC_GPIOINT->IO2IntEnF |= INT0_PIN;
+	LPC_GPIOINT->IO2IntEnR |= INT0_PIN;
 
 	// IRQ is enabled in NVIC. The name is reserved and defined in `startup_LPC17xx.s'.
 	// The name is used to implemet the interrupt handler above,
 	NVIC_EnableIRQ( EINT3_IRQn );
-	
-	
+}
 
+/*----------------------------------------------------------------------------
+  Start queueing presses, call from a task (the mailbox is an RTX object).
+  Presses before this are counted as dropped.
+ *----------------------------------------------------------------------------*/
+void INT0_Start (void) {
+
+	os_mbx_init(INT0_mbx, sizeof(INT0_mbx));
+	int0_started = 1;
 }
+
+/*----------------------------------------------------------------------------
+  Wait up to 'timeout' ticks for a press, its TIMER0 time goes to *us
+  Returns OS_R_OK, or OS_R_TMO if there was none (timeout 0 just polls)
+ *----------------------------------------------------------------------------*/
+OS_RESULT INT0_Wait (U16 timeout, uint32_t *us) {
+	void *msg;
+	OS_RESULT result = os_mbx_wait(INT0_mbx, &msg, timeout);
+
+	if (result == OS_R_TMO)
+		return OS_R_TMO;
+	*us = (uint32_t)msg;
+	return OS_R_OK;
+}
+
+/*----------------------------------------------------------------------------
+  Press counters
+ *----------------------------------------------------------------------------*/
+const int0_stats_t *INT0_Stats (void) {
+	return &int0_stats;
+}
+
 // INT0 interrupt handler
 
 void EINT3_IRQHandler() {
+	uint32_t now = TIMER0_Us();
+	uint32_t falling = LPC_GPIOINT->IO2IntStatF & INT0_PIN;
+	uint32_t rising = LPC_GPIOINT->IO2IntStatR & INT0_PIN;
 
-	// Checks whether the interrupt is called on the falling edge
-	if ( LPC_GPIOINT->IO2IntStatF && (0x01 << 10) ) 
-	{
-		LPC_GPIOINT->IO2IntClr |= (1 << 10); // clear interrupt condition
-		
-		//set flag
+	if (!(falling | rising))
+		return;
+	LPC_GPIOINT->IO2IntClr = INT0_PIN; // clear interrupt condition
 
-		button_pressed = 1;
-		
+	if (falling) {
+		if (now - last_edge_us < INT0_DEBOUNCE_US) {
+			int0_stats.bounces++;
+		}
+		else if (!int0_started || isr_mbx_check(INT0_mbx) == 0) {
+			int0_stats.dropped++;
+		}
+		else {
+			isr_mbx_send(INT0_mbx, (void *)now);
+			int0_stats.presses++;
+		}
 	}
+	last_edge_us = now;
 }
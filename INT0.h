@@ -14,12 +14,19 @@
 #ifndef __INT0_H
 #define __INT0_H
 
-/* LED Definitions */
-extern uint16_t INT0_val;
-extern uint8_t INT0_done;
-extern void INT0_Init(void);
+#define INT0_QUEUE        8                  /* Presses waiting to be read    */
+#define INT0_DEBOUNCE_US  20000              /* Quiet time before a press     */
+
+typedef struct {
+	uint32_t presses;                          /* Sent to the mailbox           */
+	uint32_t bounces;                          /* Edges inside the debounce time*/
+	uint32_t dropped;                          /* Presses lost to a full mailbox*/
+} int0_stats_t;
+
+extern void INT0_HwInit(void);
+extern void INT0_Start(void);
+extern OS_RESULT INT0_Wait(U16 timeout, uint32_t *us);
+extern const int0_stats_t *INT0_Stats(void);
 extern void EINT3_IRQHandler(void);
 
-extern volatile int button_pressed;
-
 #endif
@@ -1,10 +1,34 @@
 //Joystick.c
+//The directions are on P1.23-P1.26, which have no GPIO interrupt on the
+//LPC17xx (only ports 0 and 2 do), so they are sampled every millisecond
+//from the TIMER0 tick instead of polled once per frame. Changes that are
+//stable for two samples go into a single producer, single consumer queue:
+//the tick writes joy_head, the human task writes joy_tail.
 #include "LPC17xx.H"  
 #include "JOYSTICK.h"
+#include "TIMER0.h"
+
+#define JOY_QUEUE 16              //Power of two
+
+static volatile joy_event_t joy_queue[JOY_QUEUE];
+static volatile uint8_t joy_head, joy_tail;
+
+static volatile uint8_t joy_stable = POSITION_MASK; //Debounced pins, active low
+static uint8_t joy_last = POSITION_MASK;      //Previous sample
+static uint32_t joy_last_us;
+
+//JOYSTICK_Collect state
+static uint8_t joy_held;                      //Directions down, bit per dir
+static uint32_t joy_since[JOY_DIRS];          //Start of the held time counted
+static uint32_t joy_tick_us;                  //End of the last collected tick
+static joy_stats_t joy_stats;
 
 void JOYSTICK_Init (void) {
 	LPC_PINCON->PINSEL3 &= ~((3<< 8)|(3<<14)|(3<<16)|(3<<18)|(3<<20)); 
 	LPC_GPIO1->FIODIR &= ~((1<<20)|(1<<23)|(1<<24)|(1<<25)|(1<<26));
+	
+	joy_tick_us = TIMER0_Us();
+	TIMER0_Tick(JOYSTICK_Sample);
 }
 
 uint8_t JOYSTICK_Status(void){
@@ -26,4 +50,109 @@ uint8_t JOYSTICK_Position_Read(void){
 		uint8_t kbd_val;
 	kbd_val = (LPC_GPIO1->FIOPIN >> 23) & POSITION_MASK;
 	return kbd_val;	
-}
\ No newline at end of file
+}
+
+//Called from the TIMER0 tick: queue the directions whose pins changed and
+//then held still for one more sample
+void JOYSTICK_Sample(uint32_t us){
+	uint8_t pins = JOYSTICK_Position_Read();
+	uint8_t changed, head;
+	int dir;
+	
+	if(pins != joy_last){
+		joy_last = pins;
+		joy_last_us = us;
+		return;
+	}
+	changed = pins ^ joy_stable;
+	if(!changed)
+		return;
+	joy_stable = pins;
+	
+	for(dir = 0; dir < JOY_DIRS; dir++){
+		if(!((changed >> dir) & 1))
+			continue;
+		head = joy_head;
+		if(((head + 1) & (JOY_QUEUE - 1)) == joy_tail){
+			joy_stats.dropped++;
+			continue;
+		}
+		joy_queue[head].us = joy_last_us;
+		joy_queue[head].dir = dir;
+		joy_queue[head].down = !((pins >> dir) & 1);
+		joy_head = (head + 1) & (JOY_QUEUE - 1);
+	}
+}
+
+//Pops the oldest event, returns 0 if there is none
+int JOYSTICK_Event(joy_event_t *event){
+	uint8_t tail = joy_tail;
+	
+	if(tail == joy_head)
+		return 0;
+	event->us = joy_queue[tail].us;
+	event->dir = joy_queue[tail].dir;
+	event->down = joy_queue[tail].down;
+	joy_tail = (tail + 1) & (JOY_QUEUE - 1);
+	return 1;
+}
+
+//Consumes the events since the last call, for each direction returns the
+//part of that time it was held in 1/JOY_SHARE. A tap shorter than a tick
+//still shows up as a small share.
+void JOYSTICK_Collect(uint16_t share[JOY_DIRS]){
+	uint32_t now = TIMER0_Us();
+	uint32_t tick = now - joy_tick_us;
+	uint32_t held[JOY_DIRS] = {0};
+	uint32_t t, latency;
+	joy_event_t event;
+	uint8_t down;
+	int dir;
+	
+	while(JOYSTICK_Event(&event)){
+		dir = event.dir;
+		//Edges from before the tick started count from its start
+		t = (event.us - joy_tick_us <= tick) ? event.us : joy_tick_us;
+		if(event.down && !((joy_held >> dir) & 1)){
+			joy_held |= 1 << dir;
+			joy_since[dir] = t;
+		}
+		else if(!event.down && ((joy_held >> dir) & 1)){
+			joy_held &= ~(1 << dir);
+			held[dir] += t - joy_since[dir];
+		}
+		latency = now - event.us;
+		joy_stats.events++;
+		joy_stats.latency_sum += latency;
+		if(latency > joy_stats.latency_max)
+			joy_stats.latency_max = latency;
+	}
+	
+	//Catch up with the pins if the queue overflowed
+	down = ~joy_stable & POSITION_MASK;
+	for(dir = 0; dir < JOY_DIRS; dir++){
+		if(((down ^ joy_held) >> dir) & 1){
+			joy_held ^= 1 << dir;
+			if((down >> dir) & 1)
+				joy_since[dir] = now;
+			else
+				held[dir] += now - joy_since[dir];
+		}
+	}
+	
+	for(dir = 0; dir < JOY_DIRS; dir++){
+		if((joy_held >> dir) & 1){
+			held[dir] += now - joy_since[dir];
+			joy_since[dir] = now;
+		}
+		if(tick == 0 || held[dir] >= tick)
+			share[dir] = held[dir] ? JOY_SHARE : 0;
+		else
+			share[dir] = (uint16_t)((uint64_t)held[dir] * JOY_SHARE / tick);
+	}
+	joy_tick_us = now;
+}
+
+const joy_stats_t *JOYSTICK_Stats(void){
+	return &joy_stats;
+}
@@ -1,4 +1,8 @@
 //Joystick.h
+#include <RTL.h>
+
+#ifndef __JOYSTICK_H
+#define __JOYSTICK_H
 
 #define KBD_MASK 0x79
 #define BUTTON_MASK 0x1
@@ -15,9 +19,32 @@
 #define RIGHT_BIT 1 << 2
 #define DOWN_BIT 	1 << 3
 
+#define JOY_DIRS 	4
+#define JOY_SHARE 256             //JOYSTICK_Collect share of a whole tick
+
+//A direction was pressed or released, 'us' is TIMER0 time of the edge
+typedef struct {
+	uint32_t us;
+	uint8_t dir;                    //LEFT_POS..DOWN_POS
+	uint8_t down;
+} joy_event_t;
+
+typedef struct {
+	uint32_t events;                //Events consumed
+	uint32_t dropped;               //Events lost to a full queue
+	uint32_t latency_sum;           //us from edge to JOYSTICK_Collect
+	uint32_t latency_max;
+} joy_stats_t;
+
 extern void JOYSTICK_Init(void);
 extern uint8_t JOYSTICK_Status(void);
 
 extern uint8_t JOYSTICK_Button_Read(void);
 extern uint8_t JOYSTICK_Position_Read(void);
 
+extern void JOYSTICK_Sample(uint32_t us);
+extern int JOYSTICK_Event(joy_event_t *event);
+extern void JOYSTICK_Collect(uint16_t share[JOY_DIRS]);
+extern const joy_stats_t *JOYSTICK_Stats(void);
+
+#endif
@@ -10,6 +10,7 @@
  *---------------------------------------------------------------------------*/
 
 #include <RTL.h>
+#include "load.h"
 
 /*----------------------------------------------------------------------------
  *      RTX User configuration part BEGIN
@@ -24,15 +25,16 @@
 //   <i> Define max. number of tasks that will run at the same time.
 //   <i> Default: 6
 #ifndef OS_TASKCNT
- #define OS_TASKCNT     31
+ #define OS_TASKCNT     9
 #endif
 
 //   <o>Number of tasks with user-provided stack <0-250>
 //   <i> Define the number of tasks that will use a bigger stack.
 //   <i> The memory space for the stack is provided by the user.
 //   <i> Default: 0
+//   <i> All game tasks run on painted stacks declared in Blinky.c.
 #ifndef OS_PRIVCNT
- #define OS_PRIVCNT     0
+ #define OS_PRIVCNT     9
 #endif
 
 //   <o>Task stack size [bytes] <20-4096:8><#/4>
@@ -82,8 +84,9 @@
 // <e>Round-Robin Task switching
 // =============================
 // <i> Enable Round-Robin Task switching.
+// <i> Off: the game gives each job class its own priority, see Blinky.c.
 #ifndef OS_ROBIN
- #define OS_ROBIN       1
+ #define OS_ROBIN       0
 #endif
 
 //   <o>Round-Robin Timeout [ticks] <1-1000>
@@ -143,7 +146,7 @@ __task void os_idle_demon (void) {
   /* to run. The 'os_xxx' function calls are not allowed from this task.  */
 
   for (;;) {
-  /* HERE: include optional user code to be executed when no task runs.*/
+    LOAD_Idle();                        /* Sleep, count the time for LOAD_Get */
   }
 }
 
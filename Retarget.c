@@ -116,6 +116,26 @@ int getkey( void ) {
 }
 
 
+/*----------------------------------------------------------------------------
+Read character from Serial Port   (non-blocking, -1 if none is waiting)
+*----------------------------------------------------------------------------*/
+int checkkey( void ) {
+
+	#ifdef __RTGT_UART
+	if ( uart_init_called == 0 ) {
+		uart_init_called = 1;
+		UARTInit(PORT_NUM, BAUD_RATE);
+	}
+	#endif
+	
+	#if defined( __RTGT_UART ) || defined( __DBG_ITM )
+		return UARTCheckChar( PORT_NUM );
+	#else
+		return -1;
+	#endif
+}
+
+
 struct __FILE { int handle; /* Add whatever you need here */ };
 FILE __stdout;
 FILE __stdin;
@@ -0,0 +1,30 @@
+;/*----------------------------------------------------------------------------
+; * Name:    SVC_Table.s
+; * Purpose: user SVC functions of the RTX kernel
+; * Note(s): The tasks run unprivileged (OS_RUNPRIV 0 in RTX_Conf_CM.c), so
+; *          whatever needs the interrupts masked goes through an SVC: a
+; *          function declared __svc(n) in C traps to the RTX SVC handler,
+; *          which calls __SVC_n below with the caller's r0-r3 and returns
+; *          its r0. SVC 0 is the kernel's own.
+; *----------------------------------------------------------------------------
+;
+; *----------------------------------------------------------------------------*/
+
+                AREA    SVC_TABLE, CODE, READONLY
+
+                EXPORT  SVC_Count
+
+SVC_Cnt         EQU    (SVC_End-SVC_Table)/4
+SVC_Count       DCD     SVC_Cnt
+
+                IMPORT  __SVC_1
+                IMPORT  __SVC_2
+
+                EXPORT  SVC_Table
+SVC_Table
+                DCD     __SVC_1                 ; load.c, idle sleep
+                DCD     __SVC_2                 ; score.c, IAP call
+
+SVC_End
+
+                END
@@ -0,0 +1,90 @@
+/*----------------------------------------------------------------------------
+ * Name:    TIMER0.c
+ * Purpose: free running microsecond clock
+ * Note(s): Safe to call TIMER0_Init more than once, only the first call
+ *          starts the counter.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include "LPC17xx.H"                         /* LPC17xx definitions           */
+#include <stddef.h>
+#include "TIMER0.h"
+
+#define TICK_US  1000
+
+static void (*tick_fn)(uint32_t us);
+static uint32_t missed;
+
+/*----------------------------------------------------------------------------
+  Start TIMER0 counting at 1 MHz
+ *----------------------------------------------------------------------------*/
+void TIMER0_Init (void) {
+	static const uint8_t pclk_div[4] = {4, 1, 2, 8};
+	uint32_t pclk;
+
+	if (LPC_TIM0->TCR & 1)
+		return;
+
+	LPC_SC->PCONP |= (1 << 1);                 /* Power up TIMER0               */
+	pclk = SystemCoreClock / pclk_div[(LPC_SC->PCLKSEL0 >> 2) & 3];
+
+	LPC_TIM0->TCR = 2;                         /* Reset and hold                */
+	LPC_TIM0->CTCR = 0;                        /* Timer mode                    */
+	LPC_TIM0->PR = pclk / 1000000 - 1;         /* TC ticks every microsecond    */
+	LPC_TIM0->MCR = 0;                         /* Free running                  */
+	LPC_TIM0->TCR = 1;
+}
+
+/*----------------------------------------------------------------------------
+  Microseconds since TIMER0_Init
+ *----------------------------------------------------------------------------*/
+uint32_t TIMER0_Us (void) {
+	return LPC_TIM0->TC;
+}
+
+/*----------------------------------------------------------------------------
+  Busy wait for at least 'us' microseconds
+ *----------------------------------------------------------------------------*/
+void TIMER0_Wait (uint32_t us) {
+	uint32_t start = LPC_TIM0->TC;
+
+	while (LPC_TIM0->TC - start <= us);
+}
+
+/*----------------------------------------------------------------------------
+  Call 'tick' every millisecond from the TIMER0 interrupt, NULL to stop
+ *----------------------------------------------------------------------------*/
+void TIMER0_Tick (void (*tick)(uint32_t us)) {
+	TIMER0_Init();
+	tick_fn = tick;
+	if (tick == NULL) {
+		LPC_TIM0->MCR &= ~1;
+		return;
+	}
+	LPC_TIM0->MR0 = LPC_TIM0->TC + TICK_US;
+	LPC_TIM0->IR = 1;
+	LPC_TIM0->MCR |= 1;                        /* Interrupt on MR0, keep running*/
+	NVIC_EnableIRQ(TIMER0_IRQn);
+}
+
+// TIMER0 interrupt handler
+void TIMER0_IRQHandler (void) {
+	LPC_TIM0->IR = 1;                          /* Clear the MR0 interrupt       */
+	LPC_TIM0->MR0 += TICK_US;
+	//Held off past the next match, MR0 would only match again after TC
+	//wraps; restart the tick from now and count the ticks lost
+	if ((int32_t)(LPC_TIM0->MR0 - LPC_TIM0->TC) <= 0) {
+		missed += (LPC_TIM0->TC - LPC_TIM0->MR0) / TICK_US + 1;
+		LPC_TIM0->MR0 = LPC_TIM0->TC + TICK_US;
+	}
+	if (tick_fn != NULL)
+		tick_fn(LPC_TIM0->TC);
+}
+
+/*----------------------------------------------------------------------------
+  Ticks lost to the interrupt being held off for more than a tick
+ *----------------------------------------------------------------------------*/
+uint32_t TIMER0_Missed (void) {
+	return missed;
+}
@@ -0,0 +1,24 @@
+/*----------------------------------------------------------------------------
+ * Name:    TIMER0.h
+ * Purpose: free running microsecond clock
+ * Note(s): RTX owns SysTick, TIMER0 counts microseconds from TIMER0_Init
+ *          and wraps after about 71 minutes. Compare times by difference.
+ *          Match register 0 gives an optional 1 ms tick on top of it, the
+ *          tick function runs in the interrupt and must not call RTX.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __TIMER0_H
+#define __TIMER0_H
+
+extern void     TIMER0_Init(void);
+extern uint32_t TIMER0_Us  (void);
+extern void     TIMER0_Wait(uint32_t us);
+extern void     TIMER0_Tick(void (*tick)(uint32_t us));
+extern void     TIMER0_IRQHandler(void);
+extern uint32_t TIMER0_Missed(void);
+
+#endif
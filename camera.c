@@ -0,0 +1,159 @@
+/*----------------------------------------------------------------------------
+ * Name:    camera.c
+ * Purpose: horizontally scrolling world on top of the panel scroll register
+ * Note(s): All positions passed in are world coordinates. The camera only
+ *          changes under the GLCD mutex, like every draw, so a blit always
+ *          sees a consistent camera and scroll offset.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include "GLCD.h"
+#include "draw.h"
+#include "camera.h"
+
+static int cam_x = 0;
+static int cam_step = 1;                /* Camera positions are multiples     */
+
+/*----------------------------------------------------------------------------
+  Reset the view to the left edge of the world.
+  'step' rounds camera positions, e.g. to whole tiles for the compositor.
+ *----------------------------------------------------------------------------*/
+void CAM_Init (int step) {
+	cam_x = 0;
+	cam_step = (step > 0) ? step : 1;
+	GLCD_ScrollTo(0);
+}
+
+/*----------------------------------------------------------------------------
+  World x of the left screen edge
+ *----------------------------------------------------------------------------*/
+int CAM_Get (void) {
+	return cam_x;
+}
+
+/*----------------------------------------------------------------------------
+  Next camera position when following world x, at most CAM_MAX_SPEED (or
+  one step) away
+ *----------------------------------------------------------------------------*/
+int CAM_Target (int x) {
+	int target = x - CAM_VIEW_W / 2;
+	int speed = (cam_step > CAM_MAX_SPEED) ? cam_step : CAM_MAX_SPEED;
+
+	if (target > cam_x + speed) target = cam_x + speed;
+	if (target < cam_x - speed) target = cam_x - speed;
+	if (target < 0) target = 0;
+	if (target > CAM_WORLD_W - CAM_VIEW_W) target = CAM_WORLD_W - CAM_VIEW_W;
+
+	//Only move by whole steps
+	if (target > cam_x)
+		return cam_x + (target - cam_x) / cam_step * cam_step;
+	return cam_x - (cam_x - target) / cam_step * cam_step;
+}
+
+/*----------------------------------------------------------------------------
+  Pan to 'new_x'. The world columns that came into view are returned in
+  strip_x/strip_w, the caller draws them.
+  Returns the number of pixels panned (negative to the left).
+ *----------------------------------------------------------------------------*/
+int CAM_Move (int new_x, int *strip_x, int *strip_w) {
+	int dx = new_x - cam_x;
+
+	*strip_w = 0;
+	if (dx == 0)
+		return 0;
+
+	if (dx >= CAM_VIEW_W || -dx >= CAM_VIEW_W) {
+		*strip_x = new_x;
+		*strip_w = CAM_VIEW_W;
+	} else if (dx > 0) {
+		*strip_x = cam_x + CAM_VIEW_W;
+		*strip_w = dx;
+	} else {
+		*strip_x = new_x;
+		*strip_w = -dx;
+	}
+
+	cam_x = new_x;
+	GLCD_ScrollTo(cam_x % CAM_VIEW_W);
+	return dx;
+}
+
+/*----------------------------------------------------------------------------
+  Clip the world span [x, x+w) to the view
+  Returns 0 if nothing of it is on screen
+ *----------------------------------------------------------------------------*/
+int CAM_Clip (int *x, int *w) {
+	if (*x < cam_x) {
+		*w -= cam_x - *x;
+		*x = cam_x;
+	}
+	if (*x + *w > cam_x + CAM_VIEW_W)
+		*w = cam_x + CAM_VIEW_W - *x;
+	return *w > 0;
+}
+
+/*----------------------------------------------------------------------------
+  GRAM column holding world column x
+ *----------------------------------------------------------------------------*/
+int CAM_Gram (int x) {
+	return x % CAM_VIEW_W;
+}
+
+/*----------------------------------------------------------------------------
+  Part 'part' (0 or 1) of the world span [x, x+w) on screen: the visible
+  span is split where it wraps around the end of GRAM. Sets the clip
+  rectangle to the part and *gx to the GRAM x world column x maps to there.
+  Returns 0 if the part is empty.
+ *----------------------------------------------------------------------------*/
+static int cam_part (int x, int w, int part, int *gx) {
+	int vis_x = x, vis_w = w;
+	int first;
+
+	if (!CAM_Clip(&vis_x, &vis_w))
+		return 0;
+
+	*gx = CAM_Gram(vis_x);
+	first = (*gx + vis_w > CAM_VIEW_W) ? CAM_VIEW_W - *gx : vis_w;
+	if (part == 0) {
+		GLCD_SetClip(*gx, 0, first, CAM_VIEW_H);
+		*gx -= vis_x - x;
+		return 1;
+	}
+	if (first == vis_w)
+		return 0;
+	GLCD_SetClip(0, 0, vis_w - first, CAM_VIEW_H);
+	*gx = x - vis_x - first;
+	return 1;
+}
+
+/*----------------------------------------------------------------------------
+  GLCD_Blend at world position (x, y), the driver trims the bitmap to
+  each GRAM part
+ *----------------------------------------------------------------------------*/
+void CAM_Blend (int x, int y, int w, int h, const unsigned short *bitmap, unsigned int alpha) {
+	int part, gx;
+
+	for (part = 0; part < 2 && cam_part(x, w, part, &gx); part++)
+		GLCD_Blend(gx, y, w, h, (unsigned char *)bitmap, alpha);
+	GLCD_ClipMax();
+}
+
+/*----------------------------------------------------------------------------
+  DRAW_Circle around world position (x, y)
+ *----------------------------------------------------------------------------*/
+void CAM_Circle (int x, int y, int r, U16 color) {
+	int part, gx;
+
+	for (part = 0; part < 2 && cam_part(x - r, 2 * r + 1, part, &gx); part++)
+		DRAW_Circle(gx + r, y, r, color);
+	GLCD_ClipMax();
+}
+
+/*----------------------------------------------------------------------------
+  GLCD_Bitmap at world position (x, y)
+ *----------------------------------------------------------------------------*/
+void CAM_Bitmap (int x, int y, int w, int h, const unsigned short *bitmap) {
+	CAM_Blend(x, y, w, h, bitmap, GLCD_ALPHA_MAX);
+}
@@ -0,0 +1,34 @@
+/*----------------------------------------------------------------------------
+ * Name:    camera.h
+ * Purpose: horizontally scrolling world on top of the panel scroll register
+ * Note(s): In landscape the panel's 320 line axis is the screen x axis, so
+ *          its scroll register pans the view sideways. GRAM is used as a
+ *          ring: world column x always lives in GRAM column x % 320, and
+ *          the scroll offset is the camera position % 320. Moving the
+ *          camera only leaves the newly exposed strip to be drawn.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __CAMERA_H
+#define __CAMERA_H
+
+#define CAM_VIEW_W      320             /* Screen size                        */
+#define CAM_VIEW_H      240
+#define CAM_WORLD_W     640             /* World size, multiple of 16         */
+#define CAM_WORLD_H     CAM_VIEW_H      /* Scrolling is horizontal only       */
+#define CAM_MAX_SPEED   8               /* Pixels the camera pans per frame   */
+
+extern void CAM_Init   (int step);
+extern int  CAM_Get    (void);
+extern int  CAM_Target (int x);
+extern int  CAM_Move   (int cam_x, int *strip_x, int *strip_w);
+extern int  CAM_Clip   (int *x, int *w);
+extern int  CAM_Gram   (int x);
+extern void CAM_Bitmap (int x, int y, int w, int h, const unsigned short *bitmap);
+extern void CAM_Blend  (int x, int y, int w, int h, const unsigned short *bitmap, unsigned int alpha);
+extern void CAM_Circle (int x, int y, int r, U16 color);
+
+#endif
@@ -0,0 +1,337 @@
+/*----------------------------------------------------------------------------
+ * Name:    compose.c
+ * Purpose: per-frame sprite compositor with tile diffing
+ * Note(s): Bitmaps use the GLCD_Bitmap layout (rows stored bottom up) and
+ *          are drawn opaque in submission order, so later entries cover
+ *          earlier ones. A tile signature only sees which bitmaps cover the
+ *          tile and where, so the bitmap contents must not change while they
+ *          are on screen. The previous frame's list is kept so a changed
+ *          tile only uploads the rows and columns its old and new entries
+ *          cover. Entries are in world coordinates and the camera must sit
+ *          on a tile boundary (CAM_Init(CMP_TILE)); a GRAM tile column that
+ *          scrolled to a new world column is uploaded whole. Not thread
+ *          safe, one task builds and flushes the list; the caller holds the
+ *          GLCD mutex around CMP_Flush.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include <stdio.h>
+#include "GLCD.h"
+#include "camera.h"
+#include "compose.h"
+
+#define CMP_SEED  2166136261UL          /* FNV-1a offset basis                */
+#define CMP_PRIME 16777619UL
+
+typedef struct {
+	const unsigned short *bitmap;
+	S16 x;
+	S16 y;
+	U16 w;
+	U16 h;
+} cmp_item_t;
+
+static cmp_item_t cmp_lists[2][CMP_MAX_ITEMS];
+static U8 cmp_counts[2] = {0, 0};
+static U8 cmp_cur = 0;                  /* List being built, the other one is on screen */
+static U8 cmp_band[CMP_MAX_ITEMS];      /* Entries crossing the current tile row */
+static U8 cmp_old_band[CMP_MAX_ITEMS];
+static U32 cmp_full[CMP_ROWS];          /* Bit GRAM tx set: upload the whole tile */
+static S16 cmp_owner[CMP_COLS];         /* World tile column in each GRAM one */
+
+static U32 cmp_sig[CMP_ROWS][CMP_COLS]; /* Signature of the uploaded tiles    */
+static unsigned short cmp_line[CMP_WIDTH];
+static U16 cmp_bg;
+static void (*cmp_background)(int x, int y, int n, unsigned short *pix) = NULL;
+static cmp_stats_t cmp_stats;
+
+static U32 cmp_mix (U32 sig, U32 val) {
+	return (sig ^ val) * CMP_PRIME;
+}
+
+static U32 cmp_empty_sig (void) {
+	return cmp_mix(CMP_SEED, cmp_bg);
+}
+
+/*----------------------------------------------------------------------------
+  Collect the entries of 'list' that cross tile row ty, in drawing order
+ *----------------------------------------------------------------------------*/
+static int cmp_collect (const cmp_item_t *list, int count, int ty, U8 *band) {
+	int n = 0;
+	int k;
+
+	for (k = 0; k < count; k++) {
+		if (list[k].y < (ty + 1) * CMP_TILE && list[k].y + list[k].h > ty * CMP_TILE)
+			band[n++] = k;
+	}
+	return n;
+}
+
+/*----------------------------------------------------------------------------
+  Grow the box (x0, y0, x1, y1) by the part of each entry inside world tile
+  tx, ty
+ *----------------------------------------------------------------------------*/
+static void cmp_extent (const cmp_item_t *list, const U8 *band, int n, int tx, int ty, S16 *box) {
+	const cmp_item_t *item;
+	int k;
+
+	for (k = 0; k < n; k++) {
+		item = &list[band[k]];
+		if (item->x >= (tx + 1) * CMP_TILE || item->x + item->w <= tx * CMP_TILE)
+			continue;
+		if (item->x < box[0]) box[0] = item->x;
+		if (item->y < box[1]) box[1] = item->y;
+		if (item->x + item->w > box[2]) box[2] = item->x + item->w;
+		if (item->y + item->h > box[3]) box[3] = item->y + item->h;
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Compose the world rectangle [x0, x1) x [y0, y1) and upload it as one
+  window at GRAM column gx
+ *----------------------------------------------------------------------------*/
+static void cmp_upload_span (int gx, int x0, int y0, int x1, int y1, int n_band) {
+	const cmp_item_t *cmp_items = cmp_lists[cmp_cur];
+	int y, i, k;
+	int ix0, ix1;
+	const cmp_item_t *item;
+	const unsigned short *src;
+	U32 start_bytes = GLCD_Stats()->bytes;
+
+	GLCD_WindowStart(gx, y0, x1 - x0, y1 - y0);
+	for (y = y0; y < y1; y++) {
+		if (cmp_background != NULL) {
+			cmp_background(x0, y, x1 - x0, cmp_line);
+		} else {
+			for (i = 0; i < x1 - x0; i++)
+				cmp_line[i] = cmp_bg;
+		}
+
+		for (k = 0; k < n_band; k++) {
+			item = &cmp_items[cmp_band[k]];
+			if (y < item->y || y >= item->y + item->h)
+				continue;
+			ix0 = (item->x > x0) ? item->x : x0;
+			ix1 = (item->x + item->w < x1) ? item->x + item->w : x1;
+			if (ix0 >= ix1)
+				continue;
+
+			//Screen row y shows bitmap row h-1-(y-item->y), as GLCD_Bitmap does
+			src = item->bitmap + (item->h - 1 - (y - item->y)) * item->w + (ix0 - item->x);
+			for (i = ix0; i < ix1; i++)
+				cmp_line[i - x0] = *src++;
+		}
+		GLCD_WindowWrite(cmp_line, x1 - x0);
+	}
+	GLCD_WindowStop();
+
+	cmp_stats.bytes += GLCD_Stats()->bytes - start_bytes;
+}
+
+/*----------------------------------------------------------------------------
+  Start with the screen cleared to 'bg' (as GLCD_Clear would leave it)
+ *----------------------------------------------------------------------------*/
+void CMP_Init (U16 bg) {
+	int tx, ty;
+
+	cmp_bg = bg;
+	for (ty = 0; ty < CMP_ROWS; ty++) {
+		for (tx = 0; tx < CMP_COLS; tx++) {
+			cmp_sig[ty][tx] = cmp_empty_sig();
+		}
+		cmp_full[ty] = 0;
+	}
+	for (tx = 0; tx < CMP_COLS; tx++) {
+		cmp_owner[tx] = tx;
+	}
+	cmp_counts[0] = 0;
+	cmp_counts[1] = 0;
+}
+
+/*----------------------------------------------------------------------------
+  Draw the background with 'fill' (pixels x..x+n-1 of row y) instead of the
+  flat color, NULL goes back to the color
+ *----------------------------------------------------------------------------*/
+void CMP_Background (void (*fill)(int x, int y, int n, unsigned short *pix)) {
+	cmp_background = fill;
+}
+
+/*----------------------------------------------------------------------------
+  Empty the display list for a new frame
+ *----------------------------------------------------------------------------*/
+void CMP_Begin (void) {
+	cmp_cur ^= 1;
+	cmp_counts[cmp_cur] = 0;
+}
+
+/*----------------------------------------------------------------------------
+  Add a bitmap at world position x, y to the frame, entries fully out of
+  view are ignored
+ *----------------------------------------------------------------------------*/
+void CMP_Bitmap (int x, int y, int w, int h, const unsigned short *bitmap) {
+	int cam = CAM_Get();
+	int vis_w, vis_h;
+	cmp_item_t *item;
+
+	if (w <= 0 || h <= 0 || x >= cam + CMP_WIDTH || y >= CMP_HEIGHT || x + w <= cam || y + h <= 0)
+		return;
+
+	cmp_stats.items++;
+	if (cmp_counts[cmp_cur] >= CMP_MAX_ITEMS) {
+		cmp_stats.dropped++;
+		return;
+	}
+
+	item = &cmp_lists[cmp_cur][cmp_counts[cmp_cur]++];
+	item->bitmap = bitmap;
+	item->x = x;
+	item->y = y;
+	item->w = w;
+	item->h = h;
+
+	vis_w = ((x + w < cam + CMP_WIDTH) ? x + w : cam + CMP_WIDTH) - ((x > cam) ? x : cam);
+	vis_h = ((y + h < CMP_HEIGHT) ? y + h : CMP_HEIGHT) - ((y > 0) ? y : 0);
+	cmp_stats.direct_bytes += CMP_WINDOW_BYTES + 2 * vis_w * vis_h;
+}
+
+/*----------------------------------------------------------------------------
+  Upload the tiles that changed since the last flush
+  Returns the number of SPI bytes sent
+ *----------------------------------------------------------------------------*/
+U32 CMP_Flush (void) {
+	const cmp_item_t *cmp_items = cmp_lists[cmp_cur];
+	const cmp_item_t *old_items = cmp_lists[cmp_cur ^ 1];
+	U32 start_bytes = cmp_stats.bytes;
+	U32 sig;
+	U8 dirty[CMP_COLS];                 /* Indexed by screen tile column      */
+	U8 full;
+	S16 box[CMP_COLS][4];               /* Changed world area of each dirty tile */
+	int cam_tx = CAM_Get() / CMP_TILE;
+	int n_band, n_old;
+	int sx, sx0, tx, gtx, ty, k;
+	int y0, y1;
+	const cmp_item_t *item;
+
+	for (ty = 0; ty < CMP_ROWS; ty++) {
+		n_band = cmp_collect(cmp_items, cmp_counts[cmp_cur], ty, cmp_band);
+		n_old = cmp_collect(old_items, cmp_counts[cmp_cur ^ 1], ty, cmp_old_band);
+
+		for (sx = 0; sx < CMP_COLS; sx++) {
+			tx = cam_tx + sx;
+			gtx = tx % CMP_COLS;
+			sig = cmp_empty_sig();
+			for (k = 0; k < n_band; k++) {
+				item = &cmp_items[cmp_band[k]];
+				if (item->x >= (tx + 1) * CMP_TILE || item->x + item->w <= tx * CMP_TILE)
+					continue;
+				sig = cmp_mix(sig, (U32)item->bitmap);
+				sig = cmp_mix(sig, ((U32)(U16)item->x << 16) | (U16)item->y);
+				sig = cmp_mix(sig, ((U32)item->w << 16) | item->h);
+			}
+			full = (cmp_full[ty] & (1UL << gtx)) || cmp_owner[gtx] != tx;
+			dirty[sx] = (sig != cmp_sig[ty][gtx]) || full;
+			cmp_sig[ty][gtx] = sig;
+			if (!dirty[sx])
+				continue;
+
+			//Only what the old and the new entries cover can differ
+			if (full) {
+				box[sx][0] = tx * CMP_TILE;
+				box[sx][1] = ty * CMP_TILE;
+				box[sx][2] = (tx + 1) * CMP_TILE;
+				box[sx][3] = (ty + 1) * CMP_TILE;
+			} else {
+				box[sx][0] = (tx + 1) * CMP_TILE;
+				box[sx][1] = (ty + 1) * CMP_TILE;
+				box[sx][2] = tx * CMP_TILE;
+				box[sx][3] = ty * CMP_TILE;
+				cmp_extent(cmp_items, cmp_band, n_band, tx, ty, box[sx]);
+				cmp_extent(old_items, cmp_old_band, n_old, tx, ty, box[sx]);
+				if (box[sx][0] < tx * CMP_TILE) box[sx][0] = tx * CMP_TILE;
+				if (box[sx][1] < ty * CMP_TILE) box[sx][1] = ty * CMP_TILE;
+				if (box[sx][2] > (tx + 1) * CMP_TILE) box[sx][2] = (tx + 1) * CMP_TILE;
+				if (box[sx][3] > (ty + 1) * CMP_TILE) box[sx][3] = (ty + 1) * CMP_TILE;
+			}
+			cmp_stats.tiles++;
+		}
+
+		//Upload each run of neighbouring dirty tiles as one window, a run
+		//ends where the view wraps around the end of GRAM
+		sx = 0;
+		while (sx < CMP_COLS) {
+			if (!dirty[sx]) {
+				sx++;
+				continue;
+			}
+			sx0 = sx;
+			y0 = box[sx][1];
+			y1 = box[sx][3];
+			do {
+				if (box[sx][1] < y0) y0 = box[sx][1];
+				if (box[sx][3] > y1) y1 = box[sx][3];
+				sx++;
+			} while (sx < CMP_COLS && dirty[sx] && (cam_tx + sx) % CMP_COLS != 0);
+			if (y0 < y1)
+				cmp_upload_span(box[sx0][0] % CMP_WIDTH, box[sx0][0], y0, box[sx - 1][2], y1, n_band);
+		}
+		cmp_full[ty] = 0;
+	}
+
+	for (sx = 0; sx < CMP_COLS; sx++) {
+		cmp_owner[(cam_tx + sx) % CMP_COLS] = cam_tx + sx;
+	}
+	cmp_stats.frames++;
+	return cmp_stats.bytes - start_bytes;
+}
+
+/*----------------------------------------------------------------------------
+  Forget what is on the panel, the next flush uploads every tile
+ *----------------------------------------------------------------------------*/
+void CMP_Invalidate (void) {
+	int ty;
+
+	for (ty = 0; ty < CMP_ROWS; ty++) {
+		cmp_full[ty] = (1UL << CMP_COLS) - 1;
+	}
+}
+
+/*----------------------------------------------------------------------------
+  The background under world tile tx, ty changed, upload it whole on the
+  next flush. Tiles out of view are uploaded whole when they scroll in.
+ *----------------------------------------------------------------------------*/
+void CMP_InvalidateTile (int tx, int ty) {
+	int cam_tx = CAM_Get() / CMP_TILE;
+
+	if (tx >= cam_tx && tx < cam_tx + CMP_COLS && ty >= 0 && ty < CMP_ROWS)
+		cmp_full[ty] |= 1UL << (tx % CMP_COLS);
+}
+
+/*----------------------------------------------------------------------------
+  Running totals since CMP_Init
+ *----------------------------------------------------------------------------*/
+const cmp_stats_t *CMP_Stats (void) {
+	return &cmp_stats;
+}
+
+/*----------------------------------------------------------------------------
+  Bytes of RAM the display lists, signatures and line buffer take
+ *----------------------------------------------------------------------------*/
+U32 CMP_RamSize (void) {
+	return sizeof(cmp_lists) + sizeof(cmp_band) + sizeof(cmp_old_band) + sizeof(cmp_full)
+		+ sizeof(cmp_owner) + sizeof(cmp_sig) + sizeof(cmp_line);
+}
+
+/*----------------------------------------------------------------------------
+  Print upload bytes per frame against drawing every entry straight to GRAM
+ *----------------------------------------------------------------------------*/
+void CMP_Report (void) {
+	U32 frames = cmp_stats.frames ? cmp_stats.frames : 1;
+
+	printf("--- Compositor (%u frames) ---\n", cmp_stats.frames);
+	printf("entries/frame %u (dropped %u)\n", cmp_stats.items / frames, cmp_stats.dropped);
+	printf("tiles/frame   %u of %u\n", cmp_stats.tiles / frames, CMP_COLS * CMP_ROWS);
+	printf("bytes/frame   %u tiled, %u direct draws without erases (%u full screen)\n", cmp_stats.bytes / frames,
+		cmp_stats.direct_bytes / frames, CMP_WINDOW_BYTES + 2 * CMP_WIDTH * CMP_HEIGHT);
+}
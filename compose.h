@@ -0,0 +1,49 @@
+/*----------------------------------------------------------------------------
+ * Name:    compose.h
+ * Purpose: per-frame sprite compositor with tile diffing
+ * Note(s): Instead of a 150 KB frame buffer the frame is kept as a display
+ *          list of bitmaps. Every CMP_TILE x CMP_TILE tile gets a signature
+ *          of the list entries that cover it; only tiles whose signature
+ *          changed since the last flush are composited, one row at a time
+ *          into a single line buffer, and uploaded as row spans.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __COMPOSE_H
+#define __COMPOSE_H
+
+#define CMP_WIDTH         320           /* Landscape panel, one GRAM of view  */
+#define CMP_HEIGHT        240
+#define CMP_TILE          16            /* Tile size in pixels                */
+#define CMP_COLS          (CMP_WIDTH  / CMP_TILE)
+#define CMP_ROWS          (CMP_HEIGHT / CMP_TILE)
+#define CMP_MAX_ITEMS     128           /* Display list entries per frame     */
+
+/* SPI bytes opening a window with no register shadow hits: 6 register
+   writes, GRAM index, start byte. Used to estimate direct drawing.           */
+#define CMP_WINDOW_BYTES  (6 * 6 + 3 + 1)
+
+typedef struct {
+	U32 frames;
+	U32 items;                            /* Display list entries submitted     */
+	U32 dropped;                          /* Entries lost to a full list        */
+	U32 tiles;                            /* Tiles recomposed and uploaded      */
+	U32 bytes;                            /* SPI bytes sent by the flushes      */
+	U32 direct_bytes;                     /* Bytes drawing every entry directly, no erases */
+} cmp_stats_t;
+
+extern void CMP_Init       (U16 bg);
+extern void CMP_Begin      (void);
+extern void CMP_Bitmap     (int x, int y, int w, int h, const unsigned short *bitmap);
+extern U32  CMP_Flush      (void);
+extern void CMP_Invalidate (void);
+extern void CMP_InvalidateTile (int tx, int ty);
+extern void CMP_Background (void (*fill)(int x, int y, int n, unsigned short *pix));
+extern const cmp_stats_t *CMP_Stats (void);
+extern U32  CMP_RamSize    (void);
+extern void CMP_Report     (void);
+
+#endif
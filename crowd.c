@@ -0,0 +1,157 @@
+/*----------------------------------------------------------------------------
+ * Name:    crowd.c
+ * Purpose: neighbour queries and separation steering for the horde
+ * Note(s):
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include "crowd.h"
+
+#define CROWD_CELLS  (CROWD_COLS * CROWD_ROWS)
+
+static crowd_id_t crowd_start[CROWD_CELLS + 1];  // first sorted slot of each cell
+static U8         crowd_cell[CROWD_MAX_AGENTS];   // cell of each agent
+static crowd_id_t crowd_agent[CROWD_MAX_AGENTS];  // agent index of each sorted slot
+static S16        crowd_x[CROWD_MAX_AGENTS];      // positions in sorted order
+static S16        crowd_y[CROWD_MAX_AGENTS];
+static int        crowd_n = 0;
+
+/*----------------------------------------------------------------------------
+  Grid cell of a pixel position, clamped to the playfield
+ *----------------------------------------------------------------------------*/
+static int crowd_cell_of (int x, int y) {
+	int col = x / CROWD_CELL;
+	int row = y / CROWD_CELL;
+
+	if (col < 0) col = 0;
+	if (col >= CROWD_COLS) col = CROWD_COLS - 1;
+	if (row < 0) row = 0;
+	if (row >= CROWD_ROWS) row = CROWD_ROWS - 1;
+	return row * CROWD_COLS + col;
+}
+
+/*----------------------------------------------------------------------------
+  Bucket n agents (centre positions) into the grid
+ *----------------------------------------------------------------------------*/
+void CROWD_Build (const S16 *x, const S16 *y, int n) {
+	int i, c;
+
+	if (n > CROWD_MAX_AGENTS)
+		n = CROWD_MAX_AGENTS;
+	crowd_n = n;
+
+	for (c = 0; c <= CROWD_CELLS; c++)
+		crowd_start[c] = 0;
+
+	//Count agents per cell
+	for (i = 0; i < n; i++) {
+		crowd_cell[i] = crowd_cell_of(x[i], y[i]);
+		crowd_start[crowd_cell[i] + 1]++;
+	}
+
+	//Prefix sum gives the first slot of each cell
+	for (c = 0; c < CROWD_CELLS; c++)
+		crowd_start[c + 1] += crowd_start[c];
+
+	//Scatter into cell order, crowd_start[c] temporarily counts up to the end of c
+	for (i = 0; i < n; i++) {
+		c = crowd_start[crowd_cell[i]]++;
+		crowd_agent[c] = i;
+		crowd_x[c] = x[i];
+		crowd_y[c] = y[i];
+	}
+
+	//Shift back so crowd_start[c] is the first slot of c again
+	for (c = CROWD_CELLS; c > 0; c--)
+		crowd_start[c] = crowd_start[c - 1];
+	crowd_start[0] = 0;
+}
+
+/*----------------------------------------------------------------------------
+  Separation step for every agent of the last build. Each neighbour closer
+  than 'radius' pushes the agent away, weighted by how deep it overlaps.
+  The step of agent i is clamped to limit[i] pixels, or CROWD_MIN_PUSH if
+  'limit' is NULL; a fast agent needs a larger step to stay apart.
+ *----------------------------------------------------------------------------*/
+void CROWD_Separate (int radius, const U8 *limit, S8 *push_x, S8 *push_y) {
+	int r2 = radius * radius;
+	int s, t, c, col, row, n_col, n_row, n_cell, max_push;
+	int dx, dy, d2;
+	S32 fx, fy;
+
+	for (s = 0; s < crowd_n; s++) {
+		fx = 0;
+		fy = 0;
+		c = crowd_cell[crowd_agent[s]];
+		col = c % CROWD_COLS;
+		row = c / CROWD_COLS;
+
+		for (n_row = row - 1; n_row <= row + 1; n_row++) {
+			if (n_row < 0 || n_row >= CROWD_ROWS)
+				continue;
+			for (n_col = col - 1; n_col <= col + 1; n_col++) {
+				if (n_col < 0 || n_col >= CROWD_COLS)
+					continue;
+				n_cell = n_row * CROWD_COLS + n_col;
+
+				for (t = crowd_start[n_cell]; t < crowd_start[n_cell + 1]; t++) {
+					if (t == s)
+						continue;
+					dx = crowd_x[s] - crowd_x[t];
+					dy = crowd_y[s] - crowd_y[t];
+					d2 = dx * dx + dy * dy;
+					if (d2 >= r2)
+						continue;
+					if (d2 == 0) {
+						//Exactly stacked, split them apart along x by slot order
+						dx = (s < t) ? -radius / 2 : radius / 2;
+					}
+					fx += dx * (r2 - d2);
+					fy += dy * (r2 - d2);
+				}
+			}
+		}
+
+		fx /= r2;
+		fy /= r2;
+		max_push = limit ? limit[crowd_agent[s]] : CROWD_MIN_PUSH;
+		if (max_push > 127) max_push = 127;
+		if (fx > max_push) fx = max_push;
+		if (fx < -max_push) fx = -max_push;
+		if (fy > max_push) fy = max_push;
+		if (fy < -max_push) fy = -max_push;
+		push_x[crowd_agent[s]] = (S8)fx;
+		push_y[crowd_agent[s]] = (S8)fy;
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Agents of the last build within 'radius' of (x, y).
+  Returns how many indices were written to 'found'.
+ *----------------------------------------------------------------------------*/
+int CROWD_Query (int x, int y, int radius, crowd_id_t *found, int max_found) {
+	int r2 = radius * radius;
+	int n_found = 0;
+	int col0 = (x - radius) / CROWD_CELL, col1 = (x + radius) / CROWD_CELL;
+	int row0 = (y - radius) / CROWD_CELL, row1 = (y + radius) / CROWD_CELL;
+	int col, row, t, dx, dy;
+
+	if (x - radius < 0) col0 = 0;
+	if (y - radius < 0) row0 = 0;
+	if (col1 >= CROWD_COLS) col1 = CROWD_COLS - 1;
+	if (row1 >= CROWD_ROWS) row1 = CROWD_ROWS - 1;
+
+	for (row = row0; row <= row1; row++) {
+		for (col = col0; col <= col1; col++) {
+			for (t = crowd_start[row * CROWD_COLS + col]; t < crowd_start[row * CROWD_COLS + col + 1]; t++) {
+				dx = crowd_x[t] - x;
+				dy = crowd_y[t] - y;
+				if (dx * dx + dy * dy < r2 && n_found < max_found)
+					found[n_found++] = crowd_agent[t];
+			}
+		}
+	}
+	return n_found;
+}
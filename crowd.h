@@ -0,0 +1,37 @@
+/*----------------------------------------------------------------------------
+ * Name:    crowd.h
+ * Purpose: neighbour queries and separation steering for the horde
+ * Note(s): Agents are bucketed into a uniform grid of CROWD_CELL pixels with
+ *          a counting sort, so building the grid and running the separation
+ *          pass are linear in the number of agents. Positions are copied
+ *          into cell order, keeping each 3x3 neighbourhood scan contiguous.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include "camera.h"
+
+#ifndef __CROWD_H
+#define __CROWD_H
+
+#ifndef CROWD_MAX_AGENTS
+#define CROWD_MAX_AGENTS  64            /* Host benchmarks build with more    */
+#endif
+#define CROWD_CELL        32            /* Must be >= the separation radius   */
+#define CROWD_COLS        ((CAM_WORLD_W + CROWD_CELL - 1) / CROWD_CELL)
+#define CROWD_ROWS        ((CAM_WORLD_H + CROWD_CELL - 1) / CROWD_CELL)
+#define CROWD_MIN_PUSH    3             /* Step limit of the slowest agents   */
+
+/* Agent index, as small as CROWD_MAX_AGENTS allows                           */
+#if CROWD_MAX_AGENTS > 255
+typedef U16 crowd_id_t;
+#else
+typedef U8  crowd_id_t;
+#endif
+
+extern void CROWD_Build    (const S16 *x, const S16 *y, int n);
+extern void CROWD_Separate (int radius, const U8 *limit, S8 *push_x, S8 *push_y);
+extern int  CROWD_Query    (int x, int y, int radius, crowd_id_t *found, int max_found);
+
+#endif
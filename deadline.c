@@ -0,0 +1,60 @@
+/*----------------------------------------------------------------------------
+ * Name:    deadline.c
+ * Purpose: response time and deadline miss accounting for periodic jobs
+ * Note(s):
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include <stdio.h>
+#include "TIMER0.h"
+#include "deadline.h"
+
+/*----------------------------------------------------------------------------
+  The job was started now
+ *----------------------------------------------------------------------------*/
+void DL_Release (dl_job_t *job) {
+	job->release_us = TIMER0_Us();
+}
+
+/*----------------------------------------------------------------------------
+  Strictly periodic job: the next release is one period after the last one,
+  however late the task woke up. The first call releases now.
+ *----------------------------------------------------------------------------*/
+void DL_Next (dl_job_t *job, U32 period_us) {
+	if (job->runs == 0 && job->misses == 0)
+		job->release_us = TIMER0_Us();
+	else
+		job->release_us += period_us;
+}
+
+/*----------------------------------------------------------------------------
+  The job finished, count a miss if it took longer than its budget
+ *----------------------------------------------------------------------------*/
+void DL_Done (dl_job_t *job) {
+	U32 now = TIMER0_Us();
+	U32 response = now - job->release_us;
+
+	job->runs++;
+	if (response > job->worst_us)
+		job->worst_us = response;
+	if (response > job->budget_us) {
+		job->misses++;
+		job->last_miss_us = now;
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Print one line per job
+ *----------------------------------------------------------------------------*/
+void DL_Report (dl_job_t *const *jobs, int count) {
+	int i;
+
+	printf("--- Deadlines (us) ---\n");
+	printf("job        budget  worst   runs    misses  last miss\n");
+	for (i = 0; i < count; i++) {
+		printf("%-10s %-7u %-7u %-7u %-7u %u\n", jobs[i]->name, jobs[i]->budget_us,
+		       jobs[i]->worst_us, jobs[i]->runs, jobs[i]->misses, jobs[i]->last_miss_us);
+	}
+}
@@ -0,0 +1,35 @@
+/*----------------------------------------------------------------------------
+ * Name:    deadline.h
+ * Purpose: response time and deadline miss accounting for periodic jobs
+ * Note(s): A job is released (by the task that starts it, or by its own
+ *          period) and later marked done by the task that ran it. A
+ *          response longer than the job's budget counts as a miss, with
+ *          the TIMER0 time it was detected. Release and done may come
+ *          from different tasks, each field has a single writer.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __DEADLINE_H
+#define __DEADLINE_H
+
+typedef struct {
+	const char *name;
+	U32 budget_us;                        /* Release to done, at most           */
+	U32 release_us;                       /* TIMER0 time of the last release    */
+	U32 runs;
+	U32 misses;
+	U32 last_miss_us;                     /* TIMER0 time the last miss ended    */
+	U32 worst_us;                         /* Longest response seen              */
+} dl_job_t;
+
+#define DL_JOB(name, budget_us)  { name, budget_us, 0, 0, 0, 0, 0 }
+
+extern void DL_Release (dl_job_t *job);
+extern void DL_Next    (dl_job_t *job, U32 period_us);
+extern void DL_Done    (dl_job_t *job);
+extern void DL_Report  (dl_job_t *const *jobs, int count);
+
+#endif
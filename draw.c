@@ -0,0 +1,188 @@
+/*----------------------------------------------------------------------------
+ * Name:    draw.c
+ * Purpose: line, circle and polygon primitives
+ * Note(s): Lines and circles step with integer Bresenham / midpoint error
+ *          terms. A step that does not change the minor axis extends the
+ *          current run, so a shallow line is a few horizontal windows and
+ *          a steep one a few vertical windows.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include "GLCD.h"
+#include "draw.h"
+
+/*----------------------------------------------------------------------------
+  Line from (x0, y0) to (x1, y1), both ends included
+ *----------------------------------------------------------------------------*/
+void DRAW_Line (int x0, int y0, int x1, int y1, U16 color) {
+	int dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+	int dy = (y1 > y0) ? y1 - y0 : y0 - y1;
+	int sx = (x1 > x0) ? 1 : -1;
+	int sy = (y1 > y0) ? 1 : -1;
+	int err, run, i;
+
+	if (dx >= dy) {
+		//x major: horizontal runs, one per row
+		err = dx / 2;
+		run = x0;
+		for (i = 0; i < dx; i++) {
+			x0 += sx;
+			err -= dy;
+			if (err < 0) {
+				err += dx;
+				GLCD_Fill((sx > 0) ? run : x0 - sx, y0, (run > x0) ? run - x0 : x0 - run, 1, color);
+				run = x0;
+				y0 += sy;
+			}
+		}
+		GLCD_Fill((sx > 0) ? run : x0, y0, ((run > x0) ? run - x0 : x0 - run) + 1, 1, color);
+	} else {
+		//y major: vertical runs, one per column
+		err = dy / 2;
+		run = y0;
+		for (i = 0; i < dy; i++) {
+			y0 += sy;
+			err -= dx;
+			if (err < 0) {
+				err += dy;
+				GLCD_Fill(x0, (sy > 0) ? run : y0 - sy, 1, (run > y0) ? run - y0 : y0 - run, color);
+				run = y0;
+				x0 += sx;
+			}
+		}
+		GLCD_Fill(x0, (sy > 0) ? run : y0, 1, ((run > y0) ? run - y0 : y0 - run) + 1, color);
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Mirror the outline run x = xs..xe at height y of the first octant into
+  all eight octants: four horizontal and four vertical windows
+ *----------------------------------------------------------------------------*/
+static void draw_octants (int cx, int cy, int xs, int xe, int y, U16 color) {
+	int n = xe - xs + 1;
+
+	GLCD_Fill(cx + xs, cy + y, n, 1, color);
+	GLCD_Fill(cx - xe, cy + y, n, 1, color);
+	GLCD_Fill(cx + xs, cy - y, n, 1, color);
+	GLCD_Fill(cx - xe, cy - y, n, 1, color);
+	GLCD_Fill(cx + y, cy + xs, 1, n, color);
+	GLCD_Fill(cx - y, cy + xs, 1, n, color);
+	GLCD_Fill(cx + y, cy - xe, 1, n, color);
+	GLCD_Fill(cx - y, cy - xe, 1, n, color);
+}
+
+/*----------------------------------------------------------------------------
+  Circle outline of radius r around (cx, cy)
+ *----------------------------------------------------------------------------*/
+void DRAW_Circle (int cx, int cy, int r, U16 color) {
+	int x = 0, y = r, d = 1 - r;
+	int xs = 0;
+
+	if (r <= 0) {
+		GLCD_Fill(cx, cy, 1, 1, color);
+		return;
+	}
+
+	//Walk the octant from the top towards 45 degrees, y only ever drops by one
+	while (x <= y) {
+		if (d < 0) {
+			d += 2 * x + 3;
+		} else {
+			d += 2 * (x - y) + 5;
+			draw_octants(cx, cy, xs, x, y, color);
+			xs = x + 1;
+			y--;
+		}
+		x++;
+	}
+	if (xs < x)
+		draw_octants(cx, cy, xs, x - 1, y, color);
+}
+
+/*----------------------------------------------------------------------------
+  Block of rows cy+first..cy+last and its mirror above cy, 2*half+1 wide.
+  The centre row belongs to the lower block only.
+ *----------------------------------------------------------------------------*/
+static void draw_rows (int cx, int cy, int first, int last, int half, U16 color) {
+	GLCD_Fill(cx - half, cy + first, 2 * half + 1, last - first + 1, color);
+	if (first == 0)
+		first = 1;
+	if (first <= last)
+		GLCD_Fill(cx - half, cy - last, 2 * half + 1, last - first + 1, color);
+}
+
+/*----------------------------------------------------------------------------
+  Filled circle of radius r around (cx, cy), every pixel sent once
+  Each outline run becomes a one row span at the top and bottom, and the
+  rows beside it a block as wide as the circle is at that height. At 45
+  degrees the span row is already in the block.
+ *----------------------------------------------------------------------------*/
+void DRAW_FillCircle (int cx, int cy, int r, U16 color) {
+	int x = 0, y = r, d = 1 - r;
+	int xs = 0;
+
+	if (r <= 0) {
+		GLCD_Fill(cx, cy, 1, 1, color);
+		return;
+	}
+
+	while (x <= y) {
+		if (d < 0) {
+			d += 2 * x + 3;
+		} else {
+			d += 2 * (x - y) + 5;
+			if (y > x) {
+				GLCD_Fill(cx - x, cy + y, 2 * x + 1, 1, color);
+				GLCD_Fill(cx - x, cy - y, 2 * x + 1, 1, color);
+			}
+			draw_rows(cx, cy, xs, x, y, color);
+			xs = x + 1;
+			y--;
+		}
+		x++;
+	}
+	if (xs < x)
+		draw_rows(cx, cy, xs, x - 1, y, color);
+}
+
+/*----------------------------------------------------------------------------
+  Convex polygon with n corners (x[i], y[i]) in either winding, one span
+  per row
+ *----------------------------------------------------------------------------*/
+void DRAW_FillPoly (const S16 *x, const S16 *y, int n, U16 color) {
+	int ymin, ymax, row, i, j;
+	int left, right, xi;
+
+	if (n < 3 || n > DRAW_MAX_POINTS)
+		return;
+
+	ymin = ymax = y[0];
+	for (i = 1; i < n; i++) {
+		if (y[i] < ymin) ymin = y[i];
+		if (y[i] > ymax) ymax = y[i];
+	}
+
+	for (row = ymin; row <= ymax; row++) {
+		left = 0x7FFF;
+		right = -0x7FFF;
+		for (i = 0, j = n - 1; i < n; j = i++) {
+			//Edges crossing this row, horizontal edges are covered by their ends
+			if ((y[i] > row) == (y[j] > row) && y[i] != row)
+				continue;
+			if (y[i] == y[j]) {
+				xi = (x[i] < x[j]) ? x[i] : x[j];
+				if (xi < left) left = xi;
+				xi = (x[i] > x[j]) ? x[i] : x[j];
+				if (xi > right) right = xi;
+				continue;
+			}
+			xi = x[j] + (row - y[j]) * (x[i] - x[j]) / (y[i] - y[j]);
+			if (xi < left) left = xi;
+			if (xi > right) right = xi;
+		}
+		if (left <= right)
+			GLCD_Fill(left, row, right - left + 1, 1, color);
+	}
+}
@@ -0,0 +1,25 @@
+/*----------------------------------------------------------------------------
+ * Name:    draw.h
+ * Purpose: line, circle and polygon primitives
+ * Note(s): Every shape is broken into runs of neighbouring pixels and each
+ *          run is sent as one GLCD_Fill window, so a shape costs a window
+ *          setup per run instead of a cursor setup per pixel. Coordinates
+ *          are screen (GRAM) positions and are clipped by the driver. The
+ *          caller holds the GLCD mutex.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __DRAW_H
+#define __DRAW_H
+
+#define DRAW_MAX_POINTS   8             /* Polygon corners                    */
+
+extern void DRAW_Line       (int x0, int y0, int x1, int y1, U16 color);
+extern void DRAW_Circle     (int cx, int cy, int r, U16 color);
+extern void DRAW_FillCircle (int cx, int cy, int r, U16 color);
+extern void DRAW_FillPoly   (const S16 *x, const S16 *y, int n, U16 color);
+
+#endif
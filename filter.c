@@ -0,0 +1,51 @@
+/*----------------------------------------------------------------------------
+ * Name:    filter.c
+ * Purpose: oversampling and first order IIR smoothing of ADC samples
+ * Note(s):
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include "filter.h"
+
+/*----------------------------------------------------------------------------
+  Empty filter, the first full block sets the output directly
+ *----------------------------------------------------------------------------*/
+void FILTER_Init (filter_t *filter) {
+	filter->sum = 0;
+	filter->state = 0;
+	filter->count = 0;
+	filter->primed = 0;
+}
+
+/*----------------------------------------------------------------------------
+  Add one sample
+  Returns 1 if it completed a block and the output changed
+ *----------------------------------------------------------------------------*/
+int FILTER_Add (filter_t *filter, U16 sample) {
+	U32 block;
+
+	filter->sum += sample;
+	if (++filter->count < FILTER_OVERSAMPLE)
+		return 0;
+
+	block = filter->sum;
+	filter->sum = 0;
+	filter->count = 0;
+
+	if (!filter->primed) {
+		filter->state = block << FILTER_SHIFT;
+		filter->primed = 1;
+	} else {
+		filter->state = filter->state - (filter->state >> FILTER_SHIFT) + block;
+	}
+	return 1;
+}
+
+/*----------------------------------------------------------------------------
+  Smoothed value, 0..FILTER_MAX
+ *----------------------------------------------------------------------------*/
+U16 FILTER_Get (const filter_t *filter) {
+	return (U16)(filter->state >> FILTER_SHIFT);
+}
@@ -0,0 +1,33 @@
+/*----------------------------------------------------------------------------
+ * Name:    filter.h
+ * Purpose: oversampling and first order IIR smoothing of ADC samples
+ * Note(s): FILTER_OVERSAMPLE samples are summed into one block value
+ *          (12 bit samples give 0..FILTER_MAX), then each block moves the
+ *          output 1/2^FILTER_SHIFT of the way towards it. Integer only and
+ *          free of hardware access, so it can run in an interrupt or on a
+ *          recorded sample stream.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __FILTER_H
+#define __FILTER_H
+
+#define FILTER_OVERSAMPLE  16           /* Samples per block, power of two    */
+#define FILTER_SHIFT       3            /* IIR weight of a new block: 1/8     */
+#define FILTER_MAX         (0xFFF * FILTER_OVERSAMPLE)
+
+typedef struct {
+	U32 sum;                              /* Samples of the current block       */
+	U32 state;                            /* Output << FILTER_SHIFT             */
+	U8 count;                             /* Samples in 'sum'                   */
+	U8 primed;                            /* 'state' holds a block              */
+} filter_t;
+
+extern void FILTER_Init (filter_t *filter);
+extern int  FILTER_Add  (filter_t *filter, U16 sample);
+extern U16  FILTER_Get  (const filter_t *filter);
+
+#endif
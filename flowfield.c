@@ -0,0 +1,140 @@
+/*----------------------------------------------------------------------------
+ * Name:    flowfield.c
+ * Purpose: shared flow field that steers the horde towards the human
+ * Note(s): FF_Update is called by the base task only, at a higher priority
+ *          than the readers. Readers fetch a single byte per lookup, so a
+ *          rebuild can at worst hand a zombie last frame's heading.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include "flowfield.h"
+
+#define FF_UNSEEN   0xFFFF              /* Above any path, a maze tops 255    */
+
+const S16 FF_DX[9] = { 0, 256, 181,   0, -181, -256, -181,    0,  181 };
+const S16 FF_DY[9] = { 0,   0, 181, 256,  181,    0, -181, -256, -181 };
+
+U32 FF_Rebuilds = 0;
+
+static U8  ff_dir[FF_CELLS];
+static U16 ff_dist[FF_CELLS];           /* Steps to the target                */
+static U8  ff_blocked[FF_CELLS];
+static U16 ff_queue[FF_CELLS];
+static int ff_target = -1;
+static int ff_dirty = 1;
+
+/*----------------------------------------------------------------------------
+  Cell index of a pixel position, clamped to the playfield
+ *----------------------------------------------------------------------------*/
+static int ff_cell (int x, int y) {
+	int col = x / FF_CELL;
+	int row = y / FF_CELL;
+
+	if (col < 0) col = 0;
+	if (col >= FF_COLS) col = FF_COLS - 1;
+	if (row < 0) row = 0;
+	if (row >= FF_ROWS) row = FF_ROWS - 1;
+	return row * FF_COLS + col;
+}
+
+/*----------------------------------------------------------------------------
+  Breadth first search outwards from the target cell. Each newly reached
+  cell points back at the cell it was reached from.
+ *----------------------------------------------------------------------------*/
+static void ff_build (int target) {
+	int head = 0, tail = 0;
+	int cell, col, row, n_col, n_row, n;
+	U8 d;
+
+	for (cell = 0; cell < FF_CELLS; cell++) {
+		ff_dist[cell] = FF_UNSEEN;
+		ff_dir[cell] = FF_NONE;
+	}
+
+	ff_dist[target] = 0;
+	ff_queue[tail++] = target;
+
+	while (head < tail) {
+		cell = ff_queue[head++];
+		col = cell % FF_COLS;
+		row = cell / FF_COLS;
+
+		for (d = FF_E; d <= FF_NE; d++) {
+			//Step from the neighbour back to this cell is direction d
+			n_col = col - FF_DX[d] / 181;
+			n_row = row - FF_DY[d] / 181;
+			if (n_col < 0 || n_col >= FF_COLS || n_row < 0 || n_row >= FF_ROWS)
+				continue;
+
+			n = n_row * FF_COLS + n_col;
+			if (ff_dist[n] != FF_UNSEEN || ff_blocked[n])
+				continue;
+
+			//No cutting diagonally past a blocked corner
+			if (FF_DX[d] && FF_DY[d] && (ff_blocked[n_row * FF_COLS + col] || ff_blocked[row * FF_COLS + n_col]))
+				continue;
+
+			ff_dist[n] = ff_dist[cell] + 1;
+			ff_dir[n] = d;
+			ff_queue[tail++] = n;
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Retarget the field on the pixel position (x, y). The search only runs when
+  the target changed cell or an obstacle changed.
+  Returns 1 if the field was rebuilt.
+ *----------------------------------------------------------------------------*/
+int FF_Update (int x, int y) {
+	int target = ff_cell(x, y);
+
+	if (target == ff_target && !ff_dirty)
+		return 0;
+
+	ff_build(target);
+	ff_target = target;
+	ff_dirty = 0;
+	FF_Rebuilds++;
+	return 1;
+}
+
+/*----------------------------------------------------------------------------
+  Heading for an agent at pixel position (x, y), FF_NONE in the target cell
+ *----------------------------------------------------------------------------*/
+U8 FF_Direction (int x, int y) {
+	return ff_dir[ff_cell(x, y)];
+}
+
+/*----------------------------------------------------------------------------
+  Direction code pointing along (dx, dy), used inside the target cell
+ *----------------------------------------------------------------------------*/
+U8 FF_DirTowards (int dx, int dy) {
+	static const U8 dirs[3][3] = {
+		/* dy < 0     dy == 0   dy > 0  */
+		{ FF_NW,     FF_W,     FF_SW },   /* dx < 0  */
+		{ FF_N,      FF_NONE,  FF_S  },   /* dx == 0 */
+		{ FF_NE,     FF_E,     FF_SE }    /* dx > 0  */
+	};
+
+	return dirs[(dx > 0) - (dx < 0) + 1][(dy > 0) - (dy < 0) + 1];
+}
+
+/*----------------------------------------------------------------------------
+  Mark a cell as an obstacle (or clear it), the next update rebuilds
+ *----------------------------------------------------------------------------*/
+void FF_SetBlocked (int col, int row, int blocked) {
+	if (col < 0 || col >= FF_COLS || row < 0 || row >= FF_ROWS)
+		return;
+	ff_blocked[row * FF_COLS + col] = blocked ? 1 : 0;
+	ff_dirty = 1;
+}
+
+/*----------------------------------------------------------------------------
+  Bytes of RAM the field and its search queue take
+ *----------------------------------------------------------------------------*/
+U32 FF_RamSize (void) {
+	return sizeof(ff_dir) + sizeof(ff_dist) + sizeof(ff_blocked) + sizeof(ff_queue);
+}
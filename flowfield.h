@@ -0,0 +1,46 @@
+/*----------------------------------------------------------------------------
+ * Name:    flowfield.h
+ * Purpose: shared flow field that steers the horde towards the human
+ * Note(s): The playfield is split into FF_CELL x FF_CELL cells. A breadth
+ *          first search from the target cell stores, for every cell, the
+ *          direction of the next step towards the target, so any number of
+ *          agents get their heading with one table lookup.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include "camera.h"
+
+#ifndef __FLOWFIELD_H
+#define __FLOWFIELD_H
+
+#define FF_CELL     16                  /* Cell size in pixels                */
+#define FF_COLS     (CAM_WORLD_W / FF_CELL)
+#define FF_ROWS     (CAM_WORLD_H / FF_CELL)
+#define FF_CELLS    (FF_COLS * FF_ROWS)
+
+/* Direction codes, same numbering as the zombie arm positions                */
+#define FF_NONE     0                   /* Target cell or unreachable         */
+#define FF_E        1                   /* +x                                 */
+#define FF_SE       2                   /* +x +y                              */
+#define FF_S        3                   /* +y                                 */
+#define FF_SW       4                   /* -x +y                              */
+#define FF_W        5                   /* -x                                 */
+#define FF_NW       6                   /* -x -y                              */
+#define FF_N        7                   /* -y                                 */
+#define FF_NE       8                   /* +x -y                              */
+
+/* Unit vector of each direction code, scaled by 256                          */
+extern const S16 FF_DX[9];
+extern const S16 FF_DY[9];
+
+extern U32  FF_Rebuilds;
+
+extern int  FF_Update     (int x, int y);
+extern U8   FF_Direction  (int x, int y);
+extern U8   FF_DirTowards (int dx, int dy);
+extern void FF_SetBlocked (int col, int row, int blocked);
+extern U32  FF_RamSize    (void);
+
+#endif
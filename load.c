@@ -0,0 +1,67 @@
+/*----------------------------------------------------------------------------
+ * Name:    load.c
+ * Purpose: idle sleep and CPU load measurement
+ * Note(s): Only the idle demon writes the counters, readers take the last
+ *          published value.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include "LPC17xx.H"
+#include <RTL.h>
+#include "TIMER0.h"
+#include "load.h"
+
+static U32 window_start;
+static U32 idle_us;                     /* Asleep since window_start          */
+static volatile U32 load = LOAD_FULL;   /* Published, 0..LOAD_FULL            */
+static volatile U32 published_at;
+
+/*----------------------------------------------------------------------------
+  SVC 1, see SVC_Table.s: sleep until the next interrupt, return the time
+  asleep. The tasks run unprivileged, where __disable_irq is ignored, so
+  the masking is done here in the SVC handler: the wake up time is read
+  before any handler runs, and a task it readies is only switched in
+  once the SVC returns.
+ *----------------------------------------------------------------------------*/
+U32 __svc(1) load_sleep (void);
+
+U32 __SVC_1 (void) {
+	U32 start, now;
+
+	__disable_irq();
+	start = TIMER0_Us();
+	__WFI();
+	now = TIMER0_Us();
+	__enable_irq();
+	return now - start;
+}
+
+/*----------------------------------------------------------------------------
+  Sleep until the next interrupt, called from os_idle_demon only
+ *----------------------------------------------------------------------------*/
+void LOAD_Idle (void) {
+	U32 now, elapsed;
+
+	idle_us += load_sleep();
+	now = TIMER0_Us();
+	elapsed = now - window_start;
+	if (elapsed >= LOAD_WINDOW_US) {
+		if (idle_us > elapsed)
+			idle_us = elapsed;
+		load = LOAD_FULL - (U32)((U64)idle_us * LOAD_FULL / elapsed);
+		published_at = now;
+		window_start = now;
+		idle_us = 0;
+	}
+}
+
+/*----------------------------------------------------------------------------
+  CPU load over the last window in 1/LOAD_FULL
+ *----------------------------------------------------------------------------*/
+U32 LOAD_Get (void) {
+	//The idle demon has not run for a whole window, nothing was idle
+	if (TIMER0_Us() - published_at >= 2 * LOAD_WINDOW_US)
+		return LOAD_FULL;
+	return load;
+}
@@ -0,0 +1,25 @@
+/*----------------------------------------------------------------------------
+ * Name:    load.h
+ * Purpose: idle sleep and CPU load measurement
+ * Note(s): os_idle_demon calls LOAD_Idle in its loop: the core sleeps in
+ *          WFI, inside an SVC so interrupts can be masked from the
+ *          unprivileged demon, and the time asleep is added up on TIMER0.
+ *          Every LOAD_WINDOW_US the share of the window spent awake is
+ *          published as the CPU load. RTX 4.20 has no tickless mode, so the 10 ms
+ *          SysTick (and the 1 ms TIMER0 tick) still wake the core.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __LOAD_H
+#define __LOAD_H
+
+#define LOAD_WINDOW_US  1000000         /* Load is averaged over one second   */
+#define LOAD_FULL       1000            /* LOAD_Get of a never idle CPU       */
+
+extern void LOAD_Idle (void);
+extern U32  LOAD_Get  (void);
+
+#endif
@@ -0,0 +1,119 @@
+/*----------------------------------------------------------------------------
+ * Name:    memstat.c
+ * Purpose: task stack high-water marks and static RAM accounting
+ * Note(s): Stacks are painted with MEM_PAINT_WORD before the task is created
+ *          with os_tsk_create_user_ex. The high-water mark is the deepest
+ *          word that no longer holds the pattern. Word 0 holds the RTX stack
+ *          check magic word (OS_STKCHECK) and is skipped by the scan.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include <stdio.h>
+#include "memstat.h"
+
+typedef struct {
+	const char *name;
+	U64 *stk;
+	U16 size;   // bytes
+	U16 peak;   // bytes, highest mark seen before the stack was last repainted
+} mem_stack_t;
+
+typedef struct {
+	const char *name;
+	U32 size;
+} mem_static_t;
+
+static mem_stack_t mem_stacks[MEM_MAX_STACKS];
+static short mem_num_stacks = 0;
+
+static mem_static_t mem_statics[MEM_MAX_STATICS];
+static short mem_num_statics = 0;
+
+/*----------------------------------------------------------------------------
+  Bytes of the stack that have been written since it was painted
+ *----------------------------------------------------------------------------*/
+U16 MEM_StackUsed (const U64 *stk, U16 size) {
+	const U32 *word = (const U32 *)stk;
+	U16 n_words = size / 4;
+	U16 i;
+
+	for (i = 1; i < n_words; i++) {
+		if (word[i] != MEM_PAINT_WORD)
+			break;
+	}
+	return (U16)((n_words - i + 1) * 4);
+}
+
+/*----------------------------------------------------------------------------
+  Paint a stack and register it for reporting.
+  Must only be called while no task is running on the stack.
+ *----------------------------------------------------------------------------*/
+void MEM_StackPaint (const char *name, U64 *stk, U16 size) {
+	U32 *word = (U32 *)stk;
+	U16 used;
+	short i;
+
+	for (i = 0; i < mem_num_stacks; i++) {
+		if (mem_stacks[i].stk == stk)
+			break;
+	}
+
+	if (i < mem_num_stacks) {
+		//Stack is being reused, keep the deepest mark of its previous owner
+		used = MEM_StackUsed(stk, size);
+		if (used > mem_stacks[i].peak)
+			mem_stacks[i].peak = used;
+	} else if (mem_num_stacks < MEM_MAX_STACKS) {
+		mem_stacks[i].name = name;
+		mem_stacks[i].stk = stk;
+		mem_stacks[i].size = size;
+		mem_stacks[i].peak = 0;
+		mem_num_stacks++;
+	}
+
+	for (i = 0; i < size / 4; i++) {
+		word[i] = MEM_PAINT_WORD;
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Register a statically allocated region (bitmaps, entity arrays...)
+ *----------------------------------------------------------------------------*/
+void MEM_AddStatic (const char *name, U32 size) {
+	if (mem_num_statics < MEM_MAX_STATICS) {
+		mem_statics[mem_num_statics].name = name;
+		mem_statics[mem_num_statics].size = size;
+		mem_num_statics++;
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Print stack high-water marks and the static RAM budget
+ *----------------------------------------------------------------------------*/
+void MEM_Report (void) {
+	short i;
+	U16 used;
+	U32 stack_total = 0;
+	U32 static_total = 0;
+
+	printf("--- Stacks (bytes) ---\n");
+	for (i = 0; i < mem_num_stacks; i++) {
+		used = MEM_StackUsed(mem_stacks[i].stk, mem_stacks[i].size);
+		if (mem_stacks[i].peak > used)
+			used = mem_stacks[i].peak;
+		printf("%-12s %4u / %4u  %3u%%\n", mem_stacks[i].name, used, mem_stacks[i].size,
+			(unsigned int)(used * 100 / mem_stacks[i].size));
+		stack_total += mem_stacks[i].size;
+	}
+
+	printf("--- Static (bytes) ---\n");
+	for (i = 0; i < mem_num_statics; i++) {
+		printf("%-12s %5u\n", mem_statics[i].name, mem_statics[i].size);
+		static_total += mem_statics[i].size;
+	}
+
+	printf("Stacks %u + static %u = %u of %u bytes\n", stack_total, static_total,
+		stack_total + static_total, MEM_RAM_SIZE);
+}
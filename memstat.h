@@ -0,0 +1,27 @@
+/*----------------------------------------------------------------------------
+ * Name:    memstat.h
+ * Purpose: task stack high-water marks and static RAM accounting
+ * Note(s):
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __MEMSTAT_H
+#define __MEMSTAT_H
+
+#define MEM_PAINT_WORD    0xDEADBEEFUL   /* Pattern left in untouched stack   */
+#define MEM_MAX_STACKS    24             /* Task stacks that can be tracked   */
+#define MEM_MAX_STATICS   16             /* Static regions that can be tracked*/
+#define MEM_RAM_SIZE      (32 * 1024)    /* LPC1768 main SRAM bank            */
+
+/* Stack declaration for os_tsk_create_user_ex (RTX needs 8 byte alignment)   */
+#define MEM_STACK(name, bytes)  U64 name[((bytes) + 7) / 8]
+
+extern void MEM_StackPaint (const char *name, U64 *stk, U16 size);
+extern U16  MEM_StackUsed  (const U64 *stk, U16 size);
+extern void MEM_AddStatic  (const char *name, U32 size);
+extern void MEM_Report     (void);
+
+#endif
@@ -0,0 +1,79 @@
+/*----------------------------------------------------------------------------
+ * Name:    pool.c
+ * Purpose: fixed-size object pool
+ * Note(s):
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include <stddef.h>
+#include "pool.h"
+
+/*----------------------------------------------------------------------------
+  Set up a pool over caller provided storage, all slots free
+ *----------------------------------------------------------------------------*/
+void POOL_Init (pool_t *pool, void *items, U16 item_size, U8 count) {
+	U8 i;
+
+	if (count > POOL_MAX_ITEMS)
+		count = POOL_MAX_ITEMS;
+
+	pool->items = (unsigned char *)items;
+	pool->item_size = item_size;
+	pool->count = count;
+	pool->used = 0;
+	pool->live = 0;
+
+	for (i = 0; i < count; i++) {
+		pool->next[i] = (i + 1 < count) ? i + 1 : POOL_NONE;
+	}
+	pool->free_head = count ? 0 : POOL_NONE;
+}
+
+/*----------------------------------------------------------------------------
+  Take a slot from the free list, NULL if the pool is exhausted
+ *----------------------------------------------------------------------------*/
+void *POOL_Alloc (pool_t *pool) {
+	U8 i = pool->free_head;
+
+	if (i == POOL_NONE)
+		return NULL;
+
+	pool->free_head = pool->next[i];
+	pool->live |= (1UL << i);
+	pool->used++;
+	return pool->items + i * pool->item_size;
+}
+
+/*----------------------------------------------------------------------------
+  Return a slot to the free list. Double frees and foreign pointers are ignored
+ *----------------------------------------------------------------------------*/
+void POOL_Free (pool_t *pool, void *item) {
+	U32 offset, slot;
+	U8 i;
+
+	if ((unsigned char *)item < pool->items)
+		return;
+	offset = (unsigned char *)item - pool->items;
+	slot = offset / pool->item_size;
+	if (slot >= pool->count || offset % pool->item_size != 0)
+		return;
+	i = (U8)slot;
+	if (!(pool->live & (1UL << i)))
+		return;
+
+	pool->live &= ~(1UL << i);
+	pool->next[i] = pool->free_head;
+	pool->free_head = i;
+	pool->used--;
+}
+
+/*----------------------------------------------------------------------------
+  Slot at 'index' if it is allocated, NULL otherwise (used for iteration)
+ *----------------------------------------------------------------------------*/
+void *POOL_Item (pool_t *pool, U8 index) {
+	if (index >= pool->count || !(pool->live & (1UL << index)))
+		return NULL;
+	return pool->items + index * pool->item_size;
+}
@@ -0,0 +1,40 @@
+/*----------------------------------------------------------------------------
+ * Name:    pool.h
+ * Purpose: fixed-size object pool
+ * Note(s): Every slot has the same size, so any free slot satisfies any
+ *          allocation and the pool cannot fragment. Alloc and free are O(1)
+ *          (free list of slot indices). No heap is used: the caller owns
+ *          the slot storage. Not thread safe and there is no lock inside:
+ *          only one task may use a pool at a time, by a mutex or by owning
+ *          it for a whole phase of the frame as Blinky.c does.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __POOL_H
+#define __POOL_H
+
+#define POOL_MAX_ITEMS  32              /* One bit per slot in 'live'         */
+#define POOL_NONE       0xFF            /* End of the free list               */
+
+typedef struct {
+	unsigned char *items;                 /* Slot storage, count * item_size    */
+	U16 item_size;
+	U8 count;
+	U8 used;
+	U8 free_head;
+	U8 next[POOL_MAX_ITEMS];              /* Free list links                    */
+	U32 live;                             /* Bit i set while slot i is allocated*/
+} pool_t;
+
+extern void  POOL_Init (pool_t *pool, void *items, U16 item_size, U8 count);
+extern void *POOL_Alloc(pool_t *pool);
+extern void  POOL_Free (pool_t *pool, void *item);
+extern void *POOL_Item (pool_t *pool, U8 index);
+
+#define POOL_Used(pool)  ((pool)->used)
+#define POOL_Full(pool)  ((pool)->free_head == POOL_NONE)
+
+#endif
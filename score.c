@@ -0,0 +1,300 @@
+/*----------------------------------------------------------------------------
+ * Name:    score.c
+ * Purpose: high score table kept in on-chip flash
+ * Note(s): Records are written in page order, so the written pages of a
+ *          sector are followed by blank ones and the boot scan finds the
+ *          end of the log with a binary search. The page with the highest
+ *          sequence number that passes its check is the current table, a
+ *          record torn by a reset is skipped. Flash can not be read while
+ *          IAP programs or erases it, so interrupts are masked around each
+ *          call: about 1 ms per save, about 100 ms for the sector erase
+ *          every SCORE_PAGES_PER_SECTOR saves. The tasks run unprivileged,
+ *          so the call is SVC 2 (see SVC_Table.s). IAP also uses the top
+ *          SCORE_IAP_RAM bytes of the local RAM, iap_ram keeps the linker
+ *          from placing anything, the stack included, there.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include "LPC17xx.H"
+#include <RTL.h>
+#include <stdio.h>
+#include <string.h>
+#include "score.h"
+
+#define SCORE_MAGIC   0x5A4F4D42        /* "ZOMB"                             */
+#define SCORE_PAGES   (2 * SCORE_PAGES_PER_SECTOR)
+#define BLANK         0xFFFFFFFF        /* Erased flash word                  */
+
+#define IAP_LOCATION  0x1FFF1FF1
+#define IAP_PREPARE   50
+#define IAP_COPY      51
+#define IAP_ERASE     52
+#define IAP_SUCCESS   0
+#define IAP_RAM       (0x10008000 - SCORE_IAP_RAM)
+
+typedef void (*iap_t)(U32 *cmd, U32 *result);
+
+/* tests/score_test.c brings its own flash and calls it directly */
+#ifdef SCORE_IAP
+extern void SCORE_IAP (U32 *cmd, U32 *result);
+#define iap_svc       __SVC_2
+#else
+#define SCORE_IAP     IAP_LOCATION
+void __svc(2) iap_svc (U32 *cmd, U32 *result);
+
+static U8 iap_ram[SCORE_IAP_RAM] __attribute__((at(IAP_RAM), zero_init));
+#endif
+
+/* One log record, exactly one flash page */
+typedef struct {
+	U32 magic;
+	U32 seq;                              /* One more than the record before    */
+	score_table_t table;
+	U32 pad[(SCORE_PAGE - 3 * 4 - sizeof(score_table_t)) / 4];
+	U32 check;                            /* page_check of the words above      */
+} score_page_t;
+
+typedef char score_page_size[(sizeof(score_page_t) == SCORE_PAGE) ? 1 : -1];
+
+static const iap_t iap_entry = (iap_t)SCORE_IAP;
+
+static score_table_t table;
+static volatile int dirty;              /* table differs from the log         */
+static U32 next_seq = 1;
+static int next_page;                   /* Log page the next save programs    */
+static score_page_t page_buf;           /* Word aligned IAP source            */
+static U32 saves, erases, failures;
+
+/*----------------------------------------------------------------------------
+  Log page 'page', 0..SCORE_PAGES-1, in place in flash
+ *----------------------------------------------------------------------------*/
+static const score_page_t *page_at (int page) {
+	return (const score_page_t *)(SCORE_FLASH_BASE + page * SCORE_PAGE);
+}
+
+/*----------------------------------------------------------------------------
+  Rotating sum of every word but the check itself, a blank page fails it
+ *----------------------------------------------------------------------------*/
+static U32 page_check (const score_page_t *p) {
+	const U32 *w = (const U32 *)p;
+	U32 sum = 0;
+	int i;
+
+	for (i = 0; i < SCORE_PAGE / 4 - 1; i++)
+		sum = ((sum << 1) | (sum >> 31)) + w[i];
+	return ~sum;
+}
+
+static int page_valid (const score_page_t *p) {
+	return p->magic == SCORE_MAGIC && p->check == page_check(p);
+}
+
+/*----------------------------------------------------------------------------
+  Written pages at the start of log sector 'sector' (0 or 1)
+ *----------------------------------------------------------------------------*/
+static int sector_used (int sector) {
+	int lo = 0, hi = SCORE_PAGES_PER_SECTOR;
+	int mid;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (page_at(sector * SCORE_PAGES_PER_SECTOR + mid)->magic == BLANK)
+			hi = mid;
+		else
+			lo = mid + 1;
+	}
+	return lo;
+}
+
+/*----------------------------------------------------------------------------
+  Newest valid record in log pages [first, end), NULL if there is none
+ *----------------------------------------------------------------------------*/
+static const score_page_t *last_valid (int first, int end) {
+	while (end > first) {
+		end--;
+		if (page_valid(page_at(end)))
+			return page_at(end);
+	}
+	return NULL;
+}
+
+/*----------------------------------------------------------------------------
+  SVC 2: the IAP call with interrupts masked, which only takes effect in
+  the privileged SVC handler
+ *----------------------------------------------------------------------------*/
+void __SVC_2 (U32 *cmd, U32 *result) {
+	__disable_irq();
+	iap_entry(cmd, result);
+	__enable_irq();
+}
+
+/*----------------------------------------------------------------------------
+  IAP command with the flash out of reach, TRUE on success
+ *----------------------------------------------------------------------------*/
+static int iap_call (U32 *cmd) {
+	U32 result[5];
+
+	iap_svc(cmd, result);
+	return result[0] == IAP_SUCCESS;
+}
+
+static int iap_prepare (int sector) {
+	U32 cmd[5];
+
+	cmd[0] = IAP_PREPARE;
+	cmd[1] = cmd[2] = SCORE_SECTOR + sector;
+	return iap_call(cmd);
+}
+
+static int iap_erase (int sector) {
+	U32 cmd[5];
+
+	if (!iap_prepare(sector))
+		return 0;
+	cmd[0] = IAP_ERASE;
+	cmd[1] = cmd[2] = SCORE_SECTOR + sector;
+	cmd[3] = SystemCoreClock / 1000;
+	return iap_call(cmd);
+}
+
+static int iap_program (int page, const score_page_t *src) {
+	U32 cmd[5];
+
+	if (!iap_prepare(page / SCORE_PAGES_PER_SECTOR))
+		return 0;
+	cmd[0] = IAP_COPY;
+	cmd[1] = (U32)page_at(page);
+	cmd[2] = (U32)src;
+	cmd[3] = SCORE_PAGE;
+	cmd[4] = SystemCoreClock / 1000;
+	return iap_call(cmd);
+}
+
+/*----------------------------------------------------------------------------
+  Load the newest table from the log, called once at boot
+ *----------------------------------------------------------------------------*/
+void SCORE_Init (void) {
+	int used[2], active, sector;
+	const score_page_t *last[2];
+
+	for (sector = 0; sector < 2; sector++) {
+		used[sector] = sector_used(sector);
+		last[sector] = last_valid(sector * SCORE_PAGES_PER_SECTOR, sector * SCORE_PAGES_PER_SECTOR + used[sector]);
+	}
+
+	//The log continues in the sector with the newest record, even behind
+	//a first page that failed to program
+	if (last[0] != NULL && last[1] != NULL)
+		active = (last[1]->seq > last[0]->seq) ? 1 : 0;
+	else if (last[0] != NULL || last[1] != NULL)
+		active = (last[1] != NULL) ? 1 : 0;
+	else
+		active = -1;
+
+	memset(&table, 0, sizeof(table));
+	next_seq = 1;
+	next_page = 0;
+	dirty = 0;
+	if (active < 0)
+		return;
+
+	next_page = active * SCORE_PAGES_PER_SECTOR + used[active];
+	table = last[active]->table;
+	next_seq = last[active]->seq + 1;
+}
+
+/*----------------------------------------------------------------------------
+  Enter a finished game into the table in RAM, SCORE_Save writes it out.
+  Returns its rank, 0 for the best, or -1 if it did not make the table.
+ *----------------------------------------------------------------------------*/
+int SCORE_Add (int kills) {
+	int i, rank;
+
+	if (kills < 0) kills = 0;
+	if (kills > 0xFFFF) kills = 0xFFFF;
+
+	tsk_lock();
+	table.games++;
+	for (rank = 0; rank < SCORE_SLOTS && table.kills[rank] >= kills; rank++)
+		;
+	if (rank < SCORE_SLOTS) {
+		for (i = SCORE_SLOTS - 1; i > rank; i--)
+			table.kills[i] = table.kills[i - 1];
+		table.kills[rank] = (U16)kills;
+	} else {
+		rank = -1;
+	}
+	dirty = 1;                            /* The game count changed anyway      */
+	tsk_unlock();
+	return rank;
+}
+
+/*----------------------------------------------------------------------------
+  Append the table to the log if it changed, erasing a sector first when
+  the log moves into it. Blocks for the flash, call it from a low priority
+  task only. Returns 0 if the page did not program, the next call tries
+  the page after it.
+ *----------------------------------------------------------------------------*/
+int SCORE_Save (void) {
+	int ok;
+
+	if (!dirty)
+		return 1;
+
+	tsk_lock();
+	dirty = 0;
+	page_buf.table = table;
+	tsk_unlock();
+
+	page_buf.magic = SCORE_MAGIC;
+	page_buf.seq = next_seq;
+	memset(page_buf.pad, 0xFF, sizeof(page_buf.pad));
+	page_buf.check = page_check(&page_buf);
+
+	if (next_page >= SCORE_PAGES)
+		next_page = 0;
+	if (next_page % SCORE_PAGES_PER_SECTOR == 0) {
+		//Only older records are left in the sector the log enters
+		if (!iap_erase(next_page / SCORE_PAGES_PER_SECTOR)) {
+			failures++;
+			dirty = 1;
+			return 0;
+		}
+		erases++;
+	}
+
+	ok = iap_program(next_page, &page_buf) && memcmp(page_at(next_page), &page_buf, SCORE_PAGE) == 0;
+	next_page++;
+	if (ok) {
+		next_seq++;
+		saves++;
+	} else {
+		failures++;
+		dirty = 1;
+	}
+	return ok;
+}
+
+/*----------------------------------------------------------------------------
+  Table as of the last SCORE_Init/SCORE_Add
+ *----------------------------------------------------------------------------*/
+const score_table_t *SCORE_Table (void) {
+	return &table;
+}
+
+/*----------------------------------------------------------------------------
+  Print the table and the log position
+ *----------------------------------------------------------------------------*/
+void SCORE_Report (void) {
+	int i;
+
+	printf("--- High scores ---\n");
+	for (i = 0; i < SCORE_SLOTS && table.kills[i] > 0; i++)
+		printf("%d. %u\n", i + 1, table.kills[i]);
+	printf("games %u, record %u at page %d/%d%s\n", table.games, next_seq - 1, next_page, SCORE_PAGES, dirty ? ", not saved" : "");
+	printf("saves %u, erases %u, failures %u\n", saves, erases, failures);
+#ifndef SCORE_IAP
+	printf("IAP RAM 0x%08X kept free\n", (U32)iap_ram);
+#endif
+}
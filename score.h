@@ -0,0 +1,37 @@
+/*----------------------------------------------------------------------------
+ * Name:    score.h
+ * Purpose: high score table kept in on-chip flash
+ * Note(s): The last two 32 kB sectors are a log of SCORE_PAGE byte records,
+ *          each a full copy of the table. A save programs the next blank
+ *          page, a sector is only erased when the log moves into it, once
+ *          every SCORE_PAGES_PER_SECTOR saves. The project's IROM area must
+ *          end below SCORE_FLASH_BASE.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __SCORE_H
+#define __SCORE_H
+
+#define SCORE_SLOTS       8             /* Best games kept                    */
+#define SCORE_PAGE        256           /* Smallest IAP program size          */
+#define SCORE_SECTOR      28            /* First of the two log sectors       */
+#define SCORE_FLASH_BASE  0x00070000    /* Address of sector SCORE_SECTOR     */
+#define SCORE_SECTOR_SIZE 0x8000
+#define SCORE_PAGES_PER_SECTOR (SCORE_SECTOR_SIZE / SCORE_PAGE)
+#define SCORE_IAP_RAM     32            /* Top of the local RAM, used by IAP  */
+
+typedef struct {
+	U32 games;                            /* Games saved since the log was new  */
+	U16 kills[SCORE_SLOTS];               /* Best first                         */
+} score_table_t;
+
+extern void  SCORE_Init   (void);
+extern int   SCORE_Add    (int kills);
+extern int   SCORE_Save   (void);
+extern const score_table_t *SCORE_Table (void);
+extern void  SCORE_Report (void);
+
+#endif
@@ -0,0 +1,47 @@
+/*----------------------------------------------------------------------------
+ * Name:    screen.c
+ * Purpose: compressed full-screen images
+ * Note(s): The stream is a sequence of runs (0x00..0x7F: n+1 copies of the
+ *          next palette index) and literals (0x80..0xFF: n-0x7F palette
+ *          indices follow). Runs may cross rows. The caller holds the GLCD
+ *          mutex, if any task is drawing.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include "GLCD.h"
+#include "screen.h"
+
+#define SCR_CHUNK  32                   /* Pixels decoded per write           */
+
+/*----------------------------------------------------------------------------
+  Decode an image into one window at x, y (must fit on screen)
+ *----------------------------------------------------------------------------*/
+void SCR_Draw (const scr_image_t *img, int x, int y) {
+	unsigned short pix[SCR_CHUNK];
+	const U8 *data = img->data;
+	U32 left = (U32)img->w * img->h;
+	int n = 0;
+	int count, literal;
+	U16 color;
+
+	GLCD_WindowStart(x, y, img->w, img->h);
+	while (left > 0) {
+		literal = (*data >= 0x80);
+		count = literal ? *data++ - 0x7F : *data++ + 1;
+		left -= count;
+		while (count-- > 0) {
+			color = img->palette[*data];
+			if (literal || count == 0)
+				data++;
+			pix[n++] = color;
+			if (n == SCR_CHUNK) {
+				GLCD_WindowWrite(pix, n);
+				n = 0;
+			}
+		}
+	}
+	GLCD_WindowWrite(pix, n);
+	GLCD_WindowStop();
+}
@@ -0,0 +1,30 @@
+/*----------------------------------------------------------------------------
+ * Name:    screen.h
+ * Purpose: compressed full-screen images
+ * Note(s): Title and game over screens are converted offline from images
+ *          by tools/rle_screen.py into a palette of up to 256 RGB565
+ *          colors and a run length coded stream of palette indices. An
+ *          image is drawn as one window, decoded in short chunks so no
+ *          frame buffer is needed.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __SCREEN_H
+#define __SCREEN_H
+
+typedef struct {
+	U16 w;
+	U16 h;
+	const U16 *palette;
+	const U8 *data;                       /* See tools/rle_screen.py            */
+} scr_image_t;
+
+extern const scr_image_t SCR_Title;
+extern const scr_image_t SCR_GameOver;
+
+extern void SCR_Draw (const scr_image_t *img, int x, int y);
+
+#endif
@@ -0,0 +1,1612 @@
+/*----------------------------------------------------------------------------
+ * Name:    screen_img.c
+ * Purpose: compressed full-screen images
+ * Note(s): Generated by tools/rle_screen.py, do not edit.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include "screen.h"
+
+/* Title: 320x240 from tools/screens/title.png */
+static const U16 Title_palette[41] = {
+	0x0000, 0xF800, 0x1163, 0x3388, 0x2B47, 0x1102, 0x22A6, 0x4D4C,
+	0x4DAD, 0x08A1, 0x4D8C, 0x5E8F, 0x19E4, 0x564E, 0x562E, 0x2AC6,
+	0x2B27, 0x08E2, 0x560D, 0x55ED, 0x44AA, 0x5E6E, 0x1A05, 0x1984,
+	0x44CB, 0x3C29, 0x2265, 0x08C2, 0x3C6A, 0x3BE9, 0x2AE7, 0x1123,
+	0x33C9, 0x2225, 0x19C4, 0x3368, 0x450B, 0x448A, 0x0861, 0x0881,
+	0x2286,
+};
+static const U8 Title_data[12423] = {
+	0x7F,0x00,0x7F,0x00,0x51,0x00,0x0C,0x01,0x05,0x00,0x05,0x01,0x05,0x00,0x02,0x01,
+	0x08,0x00,0x02,0x01,0x01,0x00,0x07,0x01,0x0C,0x00,0x01,0x01,0x08,0x00,0x0B,0x01,
+	0x18,0x00,0x02,0x01,0x07,0x00,0x09,0x01,0x08,0x00,0x05,0x01,0x0A,0x00,0x04,0x01,
+	0x0B,0x00,0x02,0x01,0x08,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,
+	0x01,0x00,0x09,0x01,0x08,0x00,0x04,0x01,0x07,0x00,0x0B,0x01,0x08,0x00,0x01,0x01,
+	0x28,0x00,0x0C,0x01,0x03,0x00,0x09,0x01,0x03,0x00,0x03,0x01,0x06,0x00,0x03,0x01,
+	0x01,0x00,0x09,0x01,0x0A,0x00,0x01,0x01,0x08,0x00,0x0B,0x01,0x18,0x00,0x02,0x01,
+	0x07,0x00,0x0A,0x01,0x05,0x00,0x09,0x01,0x06,0x00,0x08,0x01,0x09,0x00,0x02,0x01,
+	0x08,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x02,0x00,0x0A,0x01,
+	0x05,0x00,0x08,0x01,0x05,0x00,0x0B,0x01,0x08,0x00,0x01,0x01,0x33,0x00,0x01,0x01,
+	0x02,0x00,0x02,0x01,0x05,0x00,0x02,0x01,0x02,0x00,0x03,0x01,0x06,0x00,0x03,0x01,
+	0x01,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,0x08,0x00,0x01,0x01,
+	0x21,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x06,0x00,0x02,0x01,
+	0x03,0x00,0x02,0x01,0x05,0x00,0x02,0x01,0x04,0x00,0x02,0x01,0x04,0x00,0x02,0x01,
+	0x07,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x00,0x01,0x01,
+	0x07,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x06,0x00,0x02,0x01,0x03,0x00,0x02,0x01,
+	0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x12,0x00,0x01,0x01,0x32,0x00,0x01,0x01,
+	0x02,0x00,0x02,0x01,0x07,0x00,0x02,0x01,0x01,0x00,0x03,0x01,0x06,0x00,0x03,0x01,
+	0x01,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x08,0x00,0x01,0x01,
+	0x21,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x07,0x00,0x01,0x01,
+	0x02,0x00,0x02,0x01,0x07,0x00,0x02,0x01,0x02,0x00,0x02,0x01,0x06,0x00,0x01,0x01,
+	0x07,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x00,0x02,0x01,
+	0x05,0x00,0x02,0x01,0x03,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x03,0x00,0x01,0x01,
+	0x06,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x12,0x00,0x01,0x01,0x31,0x00,0x01,0x01,
+	0x03,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x80,0x00,0x01,0x01,
+	0x04,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x06,0x00,0x01,0x01,
+	0x09,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x21,0x00,0x01,0x01,0x80,0x00,0x01,0x01,
+	0x06,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x09,0x00,0x01,0x01,
+	0x02,0x00,0x01,0x01,0x07,0x00,0x02,0x01,0x06,0x00,0x01,0x01,0x80,0x00,0x01,0x01,
+	0x07,0x00,0x01,0x01,0x0D,0x00,0x02,0x01,0x04,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x07,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x12,0x00,0x01,0x01,0x30,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,
+	0x80,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x80,0x00,0x01,0x01,
+	0x01,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x08,0x00,0x01,0x01,
+	0x20,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x07,0x00,0x01,0x01,
+	0x01,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x09,0x00,0x01,0x01,
+	0x05,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x0E,0x00,0x01,0x01,
+	0x03,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x03,0x00,0x01,0x01,
+	0x0D,0x00,0x01,0x01,0x12,0x00,0x01,0x01,0x2F,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x0B,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x80,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,
+	0x08,0x00,0x01,0x01,0x20,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x05,0x00,0x01,0x01,
+	0x07,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x80,0x00,0x01,0x01,
+	0x11,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x0F,0x00,0x01,0x01,
+	0x01,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x03,0x00,0x02,0x01,
+	0x0C,0x00,0x01,0x01,0x12,0x00,0x01,0x01,0x2E,0x00,0x01,0x01,0x05,0x00,0x01,0x01,
+	0x0B,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x80,0x00,0x01,0x01,0x01,0x00,0x08,0x01,0x0B,0x00,0x01,0x01,0x08,0x00,0x0A,0x01,
+	0x16,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x06,0x00,0x01,0x01,
+	0x02,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x10,0x00,0x01,0x01,
+	0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x0F,0x00,0x05,0x01,0x06,0x00,0x01,0x01,
+	0x06,0x00,0x01,0x01,0x05,0x00,0x06,0x01,0x07,0x00,0x0A,0x01,0x09,0x00,0x01,0x01,
+	0x2D,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x80,0x00,0x01,0x01,
+	0x01,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x00,0x09,0x01,
+	0x0A,0x00,0x01,0x01,0x08,0x00,0x0A,0x01,0x16,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x04,0x00,0x0A,0x01,0x02,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x80,0x00,0x01,0x01,
+	0x10,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x10,0x00,0x03,0x01,
+	0x07,0x00,0x0A,0x01,0x07,0x00,0x06,0x01,0x05,0x00,0x0A,0x01,0x09,0x00,0x01,0x01,
+	0x2C,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x80,0x00,0x01,0x01,
+	0x01,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+	0x06,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x1F,0x00,0x01,0x01,
+	0x04,0x00,0x01,0x01,0x04,0x00,0x08,0x01,0x04,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,
+	0x80,0x00,0x01,0x01,0x10,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,
+	0x11,0x00,0x01,0x01,0x08,0x00,0x08,0x01,0x0D,0x00,0x03,0x01,0x04,0x00,0x01,0x01,
+	0x12,0x00,0x01,0x01,0x2B,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,
+	0x80,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+	0x01,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x08,0x00,0x01,0x01,
+	0x1E,0x00,0x0A,0x01,0x03,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,
+	0x80,0x00,0x01,0x01,0x0F,0x00,0x0A,0x01,0x04,0x00,0x01,0x01,0x11,0x00,0x01,0x01,
+	0x08,0x00,0x01,0x01,0x16,0x00,0x02,0x01,0x03,0x00,0x01,0x01,0x12,0x00,0x01,0x01,
+	0x2A,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x80,0x00,0x01,0x01,
+	0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+	0x07,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x1E,0x00,0x0A,0x01,
+	0x03,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x80,0x00,0x01,0x01,
+	0x0F,0x00,0x0A,0x01,0x04,0x00,0x01,0x01,0x11,0x00,0x01,0x01,0x08,0x00,0x01,0x01,
+	0x0C,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x12,0x00,0x01,0x01,
+	0x29,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+	0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+	0x07,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x1D,0x00,0x02,0x01,
+	0x06,0x00,0x02,0x01,0x02,0x00,0x01,0x01,0x0C,0x00,0x01,0x01,0x09,0x00,0x01,0x01,
+	0x01,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x02,0x00,0x02,0x01,0x06,0x00,0x02,0x01,
+	0x03,0x00,0x01,0x01,0x11,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x00,0x01,0x01,
+	0x08,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x12,0x00,0x01,0x01,0x28,0x00,0x01,0x01,
+	0x0C,0x00,0x02,0x01,0x07,0x00,0x02,0x01,0x01,0x00,0x01,0x01,0x02,0x00,0x01,0x01,
+	0x80,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x07,0x00,0x01,0x01,
+	0x08,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x1D,0x00,0x01,0x01,0x08,0x00,0x01,0x01,
+	0x02,0x00,0x01,0x01,0x0C,0x00,0x02,0x01,0x07,0x00,0x02,0x01,0x02,0x00,0x01,0x01,
+	0x07,0x00,0x02,0x01,0x02,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x03,0x00,0x01,0x01,
+	0x11,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x00,0x02,0x01,0x07,0x00,0x01,0x01,
+	0x03,0x00,0x01,0x01,0x3C,0x00,0x01,0x01,0x0E,0x00,0x02,0x01,0x05,0x00,0x02,0x01,
+	0x02,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,0x01,0x01,
+	0x01,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x08,0x00,0x01,0x01,
+	0x1D,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x0D,0x00,0x02,0x01,
+	0x05,0x00,0x02,0x01,0x03,0x00,0x02,0x01,0x06,0x00,0x01,0x01,0x03,0x00,0x01,0x01,
+	0x08,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x11,0x00,0x01,0x01,0x08,0x00,0x01,0x01,
+	0x0D,0x00,0x02,0x01,0x04,0x00,0x02,0x01,0x04,0x00,0x01,0x01,0x3C,0x00,0x0D,0x01,
+	0x03,0x00,0x09,0x01,0x03,0x00,0x01,0x01,0x03,0x00,0x02,0x01,0x03,0x00,0x01,0x01,
+	0x01,0x00,0x0A,0x01,0x09,0x00,0x01,0x01,0x08,0x00,0x0B,0x01,0x12,0x00,0x01,0x01,
+	0x0A,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x0E,0x00,0x09,0x01,0x06,0x00,0x08,0x01,
+	0x03,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,0x02,0x00,0x09,0x01,0x09,0x00,0x01,0x01,
+	0x08,0x00,0x01,0x01,0x0E,0x00,0x08,0x01,0x05,0x00,0x0B,0x01,0x08,0x00,0x01,0x01,
+	0x27,0x00,0x0D,0x01,0x05,0x00,0x05,0x01,0x05,0x00,0x01,0x01,0x03,0x00,0x02,0x01,
+	0x03,0x00,0x01,0x01,0x01,0x00,0x08,0x01,0x0B,0x00,0x01,0x01,0x08,0x00,0x0B,0x01,
+	0x12,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x10,0x00,0x05,0x01,
+	0x09,0x00,0x05,0x01,0x05,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,0x02,0x00,0x09,0x01,
+	0x09,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x10,0x00,0x05,0x01,0x06,0x00,0x0B,0x01,
+	0x08,0x00,0x01,0x01,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x57,0x00,
+	0x0D,0x01,0x03,0x00,0x01,0x01,0x5D,0x00,0x01,0x01,0x10,0x00,0x01,0x01,0x7A,0x00,
+	0x01,0x01,0x3B,0x00,0x0D,0x01,0x03,0x00,0x01,0x01,0x5D,0x00,0x01,0x01,0x10,0x00,
+	0x01,0x01,0x7A,0x00,0x01,0x01,0x41,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x5D,0x00,
+	0x01,0x01,0x7F,0x00,0x0D,0x00,0x01,0x01,0x41,0x00,0x01,0x01,0x09,0x00,0x01,0x01,
+	0x5D,0x00,0x01,0x01,0x7F,0x00,0x0D,0x00,0x01,0x01,0x41,0x00,0x01,0x01,0x09,0x00,
+	0x01,0x01,0x5D,0x00,0x01,0x01,0x7F,0x00,0x0D,0x00,0x01,0x01,0x41,0x00,0x01,0x01,
+	0x09,0x00,0x01,0x01,0x80,0x00,0x04,0x01,0x0A,0x00,0x03,0x01,0x17,0x00,0x0A,0x01,
+	0x08,0x00,0x03,0x01,0x07,0x00,0x04,0x01,0x02,0x00,0x03,0x01,0x04,0x00,0x01,0x01,
+	0x80,0x00,0x03,0x01,0x0B,0x00,0x01,0x01,0x0D,0x00,0x03,0x01,0x0A,0x00,0x04,0x01,
+	0x19,0x00,0x05,0x01,0x09,0x00,0x01,0x01,0x80,0x00,0x03,0x01,0x0A,0x00,0x03,0x01,
+	0x18,0x00,0x01,0x01,0x80,0x00,0x04,0x01,0x0A,0x00,0x03,0x01,0x09,0x00,0x01,0x01,
+	0x80,0x00,0x03,0x01,0x0A,0x00,0x03,0x01,0x0C,0x00,0x01,0x01,0x09,0x00,0x08,0x01,
+	0x07,0x00,0x07,0x01,0x15,0x00,0x0A,0x01,0x06,0x00,0x07,0x01,0x03,0x00,0x07,0x01,
+	0x80,0x00,0x05,0x01,0x03,0x00,0x08,0x01,0x09,0x00,0x01,0x01,0x0B,0x00,0x07,0x01,
+	0x07,0x00,0x05,0x01,0x18,0x00,0x07,0x01,0x08,0x00,0x05,0x01,0x09,0x00,0x07,0x01,
+	0x16,0x00,0x08,0x01,0x07,0x00,0x07,0x01,0x07,0x00,0x05,0x01,0x09,0x00,0x07,0x01,
+	0x0A,0x00,0x01,0x01,0x09,0x00,0x02,0x01,0x03,0x00,0x02,0x01,0x06,0x00,0x01,0x01,
+	0x03,0x00,0x01,0x01,0x1D,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x03,0x00,0x01,0x01,
+	0x03,0x00,0x02,0x01,0x02,0x00,0x03,0x01,0x02,0x00,0x02,0x01,0x02,0x00,0x02,0x01,
+	0x03,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x03,0x00,0x01,0x01,
+	0x06,0x00,0x02,0x01,0x02,0x00,0x02,0x01,0x15,0x00,0x02,0x01,0x04,0x00,0x01,0x01,
+	0x07,0x00,0x02,0x01,0x0C,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x16,0x00,0x02,0x01,
+	0x03,0x00,0x02,0x01,0x06,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x07,0x00,0x02,0x01,
+	0x0C,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,0x09,0x00,0x01,0x01,
+	0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x1B,0x00,0x01,0x01,
+	0x07,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x04,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x08,0x00,0x01,0x01,
+	0x0A,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x15,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x00,0x01,0x01,
+	0x05,0x00,0x01,0x01,0x15,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,
+	0x05,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x0C,0x00,0x01,0x01,0x05,0x00,0x01,0x01,
+	0x09,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x09,0x01,
+	0x1A,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x02,0x00,0x01,0x01,
+	0x04,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x05,0x00,0x01,0x01,
+	0x08,0x00,0x01,0x01,0x0A,0x00,0x09,0x01,0x05,0x00,0x02,0x01,0x21,0x00,0x03,0x01,
+	0x07,0x00,0x01,0x01,0x0C,0x00,0x09,0x01,0x15,0x00,0x01,0x01,0x05,0x00,0x01,0x01,
+	0x05,0x00,0x09,0x01,0x06,0x00,0x01,0x01,0x0C,0x00,0x09,0x01,0x09,0x00,0x01,0x01,
+	0x09,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x09,0x01,0x19,0x00,0x01,0x01,
+	0x09,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x04,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x08,0x00,0x01,0x01,
+	0x0A,0x00,0x09,0x01,0x06,0x00,0x05,0x01,0x19,0x00,0x07,0x01,0x07,0x00,0x01,0x01,
+	0x0C,0x00,0x09,0x01,0x15,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x09,0x01,
+	0x06,0x00,0x01,0x01,0x0C,0x00,0x09,0x01,0x09,0x00,0x01,0x01,0x09,0x00,0x01,0x01,
+	0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x20,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,
+	0x05,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x02,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,
+	0x10,0x00,0x04,0x01,0x17,0x00,0x04,0x01,0x01,0x00,0x01,0x01,0x07,0x00,0x01,0x01,
+	0x0C,0x00,0x01,0x01,0x1D,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,
+	0x0E,0x00,0x01,0x01,0x0C,0x00,0x01,0x01,0x11,0x00,0x01,0x01,0x09,0x00,0x01,0x01,
+	0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x1F,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,
+	0x05,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x02,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,
+	0x14,0x00,0x01,0x01,0x15,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x07,0x00,0x01,0x01,
+	0x0C,0x00,0x01,0x01,0x1D,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,
+	0x0E,0x00,0x01,0x01,0x0C,0x00,0x01,0x01,0x11,0x00,0x01,0x01,0x09,0x00,0x01,0x01,
+	0x05,0x00,0x01,0x01,0x05,0x00,0x02,0x01,0x04,0x00,0x01,0x01,0x16,0x00,0x01,0x01,
+	0x0C,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x04,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x08,0x00,0x01,0x01,
+	0x0A,0x00,0x02,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x15,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x00,0x02,0x01,
+	0x04,0x00,0x01,0x01,0x15,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x02,0x01,
+	0x04,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x0C,0x00,0x02,0x01,0x04,0x00,0x01,0x01,
+	0x09,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x06,0x00,0x01,0x01,
+	0x03,0x00,0x02,0x01,0x15,0x00,0x01,0x01,0x0E,0x00,0x01,0x01,0x03,0x00,0x01,0x01,
+	0x03,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x02,0x00,0x02,0x01,
+	0x03,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x00,0x01,0x01,0x03,0x00,0x02,0x01,
+	0x05,0x00,0x02,0x01,0x02,0x00,0x02,0x01,0x15,0x00,0x02,0x01,0x02,0x00,0x03,0x01,
+	0x07,0x00,0x01,0x01,0x0D,0x00,0x01,0x01,0x03,0x00,0x02,0x01,0x15,0x00,0x01,0x01,
+	0x05,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x03,0x00,0x02,0x01,0x06,0x00,0x01,0x01,
+	0x0D,0x00,0x01,0x01,0x03,0x00,0x02,0x01,0x09,0x00,0x01,0x01,0x09,0x00,0x01,0x01,
+	0x05,0x00,0x01,0x01,0x06,0x00,0x07,0x01,0x15,0x00,0x0A,0x01,0x06,0x00,0x07,0x01,
+	0x03,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x02,0x00,0x08,0x01,
+	0x09,0x00,0x01,0x01,0x0B,0x00,0x07,0x01,0x07,0x00,0x06,0x01,0x17,0x00,0x08,0x01,
+	0x07,0x00,0x01,0x01,0x0D,0x00,0x07,0x01,0x16,0x00,0x01,0x01,0x05,0x00,0x01,0x01,
+	0x06,0x00,0x07,0x01,0x07,0x00,0x01,0x01,0x0D,0x00,0x07,0x01,0x0A,0x00,0x01,0x01,
+	0x09,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x08,0x00,0x04,0x01,0x16,0x00,0x0A,0x01,
+	0x08,0x00,0x03,0x01,0x05,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x04,0x00,0x01,0x01,
+	0x02,0x00,0x01,0x01,0x80,0x00,0x03,0x01,0x0B,0x00,0x01,0x01,0x0D,0x00,0x04,0x01,
+	0x09,0x00,0x04,0x01,0x19,0x00,0x03,0x01,0x02,0x00,0x01,0x01,0x06,0x00,0x01,0x01,
+	0x0F,0x00,0x04,0x01,0x17,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x08,0x00,0x04,0x01,
+	0x08,0x00,0x01,0x01,0x0F,0x00,0x04,0x01,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x66,0x00,0x01,0x01,0x07,0x00,
+	0x01,0x01,0x7F,0x00,0x7F,0x00,0x33,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x7F,0x00,
+	0x7F,0x00,0x33,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x7F,0x00,0x7F,0x00,0x33,0x00,
+	0x01,0x01,0x07,0x00,0x01,0x01,0x7F,0x00,0x7F,0x00,0x33,0x00,0x01,0x01,0x07,0x00,
+	0x01,0x01,0x7F,0x00,0x7F,0x00,0x33,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x07,0x00,
+	0x03,0x01,0x05,0x00,0x80,0x01,0x04,0x00,0x02,0x01,0x04,0x00,0x80,0x01,0x12,0x00,
+	0x04,0x01,0x02,0x00,0x03,0x01,0x05,0x00,0x05,0x01,0x08,0x00,0x01,0x01,0x01,0x00,
+	0x03,0x01,0x07,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x17,0x00,0x03,0x01,0x09,0x00,
+	0x05,0x01,0x08,0x00,0x01,0x01,0x01,0x00,0x03,0x01,0x17,0x00,0x01,0x01,0x06,0x00,
+	0x01,0x01,0x07,0x00,0x03,0x01,0x08,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x44,0x00,
+	0x01,0x01,0x07,0x00,0x01,0x01,0x05,0x00,0x07,0x01,0x03,0x00,0x80,0x01,0x04,0x00,
+	0x02,0x01,0x04,0x00,0x80,0x01,0x10,0x00,0x07,0x01,0x80,0x00,0x05,0x01,0x03,0x00,
+	0x07,0x01,0x07,0x00,0x08,0x01,0x07,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x16,0x00,
+	0x06,0x01,0x07,0x00,0x07,0x01,0x07,0x00,0x08,0x01,0x17,0x00,0x01,0x01,0x04,0x00,
+	0x01,0x01,0x06,0x00,0x07,0x01,0x06,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x44,0x00,
+	0x0B,0x01,0x05,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x03,0x00,
+	0x02,0x01,0x03,0x00,0x01,0x01,0x10,0x00,0x02,0x01,0x02,0x00,0x03,0x01,0x02,0x00,
+	0x02,0x01,0x01,0x00,0x02,0x01,0x04,0x00,0x01,0x01,0x06,0x00,0x02,0x01,0x03,0x00,
+	0x02,0x01,0x06,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x16,0x00,0x01,0x01,0x02,0x00,
+	0x02,0x01,0x05,0x00,0x02,0x01,0x04,0x00,0x01,0x01,0x06,0x00,0x02,0x01,0x03,0x00,
+	0x02,0x01,0x16,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x03,0x00,
+	0x01,0x01,0x06,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x44,0x00,0x0B,0x01,0x04,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x10,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x04,0x00,
+	0x01,0x01,0x01,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x06,0x00,0x02,0x01,0x03,0x00,0x01,0x01,0x15,0x00,0x01,0x01,0x04,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x16,0x00,0x02,0x01,0x03,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x44,0x00,0x01,0x01,0x07,0x00,
+	0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x02,0x00,
+	0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x10,0x00,0x01,0x01,0x04,0x00,
+	0x01,0x01,0x04,0x00,0x01,0x01,0x07,0x00,0x03,0x01,0x06,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x07,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x16,0x00,0x01,0x01,0x12,0x00,
+	0x03,0x01,0x06,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x17,0x00,0x01,0x01,0x02,0x00,
+	0x01,0x01,0x06,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x44,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,
+	0x01,0x01,0x10,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x03,0x00,
+	0x07,0x01,0x06,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x02,0x00,
+	0x01,0x01,0x16,0x00,0x01,0x01,0x0E,0x00,0x07,0x01,0x06,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x17,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x44,0x00,0x01,0x01,0x07,0x00,
+	0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x11,0x00,0x01,0x01,0x04,0x00,
+	0x01,0x01,0x04,0x00,0x01,0x01,0x02,0x00,0x04,0x01,0x01,0x00,0x01,0x01,0x06,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x07,0x00,0x02,0x01,0x01,0x00,0x01,0x01,0x16,0x00,
+	0x01,0x01,0x0D,0x00,0x04,0x01,0x01,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x17,0x00,0x02,0x01,0x01,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x44,0x00,0x01,0x01,0x07,0x00,
+	0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x11,0x00,0x01,0x01,0x04,0x00,
+	0x01,0x01,0x04,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x06,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x17,0x00,
+	0x01,0x01,0x0C,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x18,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x44,0x00,0x01,0x01,0x07,0x00,
+	0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x11,0x00,0x01,0x01,0x04,0x00,
+	0x01,0x01,0x04,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x06,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x17,0x00,
+	0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x06,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x18,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x07,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x44,0x00,
+	0x01,0x01,0x07,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x05,0x00,
+	0x02,0x01,0x04,0x00,0x02,0x01,0x12,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x04,0x00,
+	0x01,0x01,0x01,0x00,0x02,0x01,0x02,0x00,0x03,0x01,0x06,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x09,0x00,0x02,0x01,0x19,0x00,0x01,0x01,0x02,0x00,0x02,0x01,0x05,0x00,
+	0x02,0x01,0x02,0x00,0x03,0x01,0x06,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x19,0x00,
+	0x02,0x01,0x09,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x06,0x00,0x02,0x01,0x03,0x00,
+	0x02,0x01,0x44,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x05,0x00,0x07,0x01,0x05,0x00,
+	0x02,0x01,0x04,0x00,0x02,0x01,0x12,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x04,0x00,
+	0x01,0x01,0x02,0x00,0x08,0x01,0x06,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x09,0x00,
+	0x02,0x01,0x19,0x00,0x06,0x01,0x07,0x00,0x08,0x01,0x06,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x19,0x00,0x02,0x01,0x09,0x00,0x07,0x01,0x07,0x00,0x08,0x01,0x44,0x00,
+	0x01,0x01,0x07,0x00,0x01,0x01,0x07,0x00,0x03,0x01,0x07,0x00,0x02,0x01,0x04,0x00,
+	0x02,0x01,0x12,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x03,0x00,
+	0x03,0x01,0x02,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x09,0x00,
+	0x02,0x01,0x1B,0x00,0x03,0x01,0x09,0x00,0x03,0x01,0x02,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x19,0x00,0x02,0x01,0x0B,0x00,0x03,0x01,0x0A,0x00,
+	0x03,0x01,0x01,0x00,0x01,0x01,0x7F,0x00,0x39,0x00,0x01,0x01,0x5D,0x00,0x01,0x01,
+	0x7F,0x00,0x5D,0x00,0x01,0x01,0x5D,0x00,0x01,0x01,0x7F,0x00,0x5C,0x00,0x02,0x01,
+	0x5C,0x00,0x02,0x01,0x7F,0x00,0x5A,0x00,0x03,0x01,0x5B,0x00,0x03,0x01,0x7F,0x00,
+	0x5B,0x00,0x02,0x01,0x5C,0x00,0x02,0x01,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7A,0x00,0x01,0x01,0x36,0x00,0x01,0x01,0x58,0x00,0x01,0x01,0x1A,0x00,
+	0x01,0x01,0x4F,0x00,0x04,0x01,0x1C,0x00,0x80,0x01,0x19,0x00,0x01,0x01,0x36,0x00,
+	0x01,0x01,0x58,0x00,0x01,0x01,0x0E,0x00,0x80,0x01,0x0A,0x00,0x01,0x01,0x4D,0x00,
+	0x08,0x01,0x19,0x00,0x01,0x01,0x19,0x00,0x01,0x01,0x36,0x00,0x01,0x01,0x68,0x00,
+	0x01,0x01,0x0A,0x00,0x01,0x01,0x4D,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x19,0x00,
+	0x01,0x01,0x19,0x00,0x01,0x01,0x36,0x00,0x01,0x01,0x68,0x00,0x01,0x01,0x0A,0x00,
+	0x01,0x01,0x4C,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x18,0x00,0x01,0x01,0x19,0x00,
+	0x01,0x01,0x36,0x00,0x01,0x01,0x68,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,0x4C,0x00,
+	0x01,0x01,0x06,0x00,0x01,0x01,0x16,0x00,0x06,0x01,0x08,0x00,0x05,0x01,0x07,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x09,0x00,0x03,0x01,0x1B,0x00,0x03,0x01,0x80,0x00,
+	0x01,0x01,0x08,0x00,0x03,0x01,0x05,0x00,0x80,0x01,0x04,0x00,0x02,0x01,0x04,0x00,
+	0x80,0x01,0x03,0x00,0x01,0x01,0x01,0x00,0x03,0x01,0x14,0x00,0x80,0x01,0x04,0x00,
+	0x02,0x01,0x04,0x00,0x80,0x01,0x06,0x00,0x01,0x01,0x0B,0x00,0x06,0x01,0x07,0x00,
+	0x01,0x01,0x80,0x00,0x04,0x01,0x17,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x07,0x00,
+	0x03,0x01,0x08,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x0D,0x00,0x01,0x01,0x16,0x00,
+	0x06,0x01,0x07,0x00,0x07,0x01,0x06,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x08,0x00,
+	0x07,0x01,0x17,0x00,0x08,0x01,0x06,0x00,0x07,0x01,0x03,0x00,0x80,0x01,0x04,0x00,
+	0x02,0x01,0x04,0x00,0x80,0x01,0x03,0x00,0x08,0x01,0x13,0x00,0x80,0x01,0x04,0x00,
+	0x02,0x01,0x04,0x00,0x80,0x01,0x06,0x00,0x01,0x01,0x0B,0x00,0x06,0x01,0x07,0x00,
+	0x08,0x01,0x17,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x06,0x00,0x07,0x01,0x06,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x0C,0x00,0x01,0x01,0x19,0x00,0x01,0x01,0x09,0x00,
+	0x02,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x09,0x00,
+	0x01,0x01,0x03,0x00,0x01,0x01,0x17,0x00,0x01,0x01,0x03,0x00,0x02,0x01,0x06,0x00,
+	0x01,0x01,0x03,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x03,0x00,0x02,0x01,0x03,0x00,
+	0x01,0x01,0x03,0x00,0x02,0x01,0x03,0x00,0x02,0x01,0x12,0x00,0x01,0x01,0x03,0x00,
+	0x02,0x01,0x03,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x0D,0x00,0x01,0x01,0x0A,0x00,
+	0x02,0x01,0x03,0x00,0x02,0x01,0x16,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x06,0x00,
+	0x01,0x01,0x03,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x0B,0x00,
+	0x01,0x01,0x1A,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x15,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x02,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x03,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x12,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x0D,0x00,0x01,0x01,0x0A,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x16,0x00,0x02,0x01,0x03,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x0A,0x00,
+	0x01,0x01,0x1B,0x00,0x01,0x01,0x0F,0x00,0x03,0x01,0x05,0x00,0x01,0x01,0x01,0x00,
+	0x01,0x01,0x0A,0x00,0x09,0x01,0x15,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x12,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x06,0x00,
+	0x01,0x01,0x0D,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x17,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x1C,0x00,0x01,0x01,0x0B,0x00,
+	0x07,0x01,0x05,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x0B,0x00,0x09,0x01,0x15,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x02,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x03,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x12,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x0D,0x00,0x01,0x01,0x0A,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x17,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x06,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x08,0x00,
+	0x01,0x01,0x1D,0x00,0x01,0x01,0x0A,0x00,0x04,0x01,0x01,0x00,0x01,0x01,0x05,0x00,
+	0x05,0x01,0x0A,0x00,0x01,0x01,0x1D,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,
+	0x01,0x01,0x80,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x13,0x00,
+	0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x07,0x00,
+	0x01,0x01,0x0D,0x00,0x01,0x01,0x0A,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x17,0x00,
+	0x02,0x01,0x01,0x00,0x01,0x01,0x06,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x1D,0x00,0x01,0x01,0x09,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x02,0x01,0x01,0x00,0x01,0x01,0x09,0x00,
+	0x01,0x01,0x1D,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x03,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x13,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x0D,0x00,
+	0x01,0x01,0x0A,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x18,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x07,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x08,0x00,0x01,0x01,0x1D,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x02,0x00,0x02,0x01,0x08,0x00,0x02,0x01,0x04,0x00,
+	0x01,0x01,0x15,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x03,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x13,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x02,0x00,0x01,0x01,0x80,0x00,0x01,0x01,0x07,0x00,0x01,0x01,0x0D,0x00,
+	0x01,0x01,0x0A,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x18,0x00,0x01,0x01,0x80,0x00,
+	0x01,0x01,0x07,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x28,0x00,0x01,0x01,0x09,0x00,0x02,0x01,0x02,0x00,0x03,0x01,0x05,0x00,
+	0x01,0x01,0x03,0x00,0x01,0x01,0x09,0x00,0x01,0x01,0x03,0x00,0x02,0x01,0x16,0x00,
+	0x01,0x01,0x03,0x00,0x02,0x01,0x06,0x00,0x01,0x01,0x03,0x00,0x01,0x01,0x05,0x00,
+	0x02,0x01,0x04,0x00,0x02,0x01,0x05,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x14,0x00,
+	0x02,0x01,0x04,0x00,0x02,0x01,0x08,0x00,0x01,0x01,0x0D,0x00,0x01,0x01,0x0A,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x19,0x00,0x02,0x01,0x09,0x00,0x01,0x01,0x03,0x00,
+	0x01,0x01,0x06,0x00,0x02,0x01,0x03,0x00,0x02,0x01,0x28,0x00,0x04,0x01,0x07,0x00,
+	0x08,0x01,0x05,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x08,0x00,0x07,0x01,0x17,0x00,
+	0x08,0x01,0x06,0x00,0x07,0x01,0x05,0x00,0x02,0x01,0x04,0x00,0x02,0x01,0x05,0x00,
+	0x01,0x01,0x05,0x00,0x01,0x01,0x14,0x00,0x02,0x01,0x04,0x00,0x02,0x01,0x08,0x00,
+	0x01,0x01,0x0D,0x00,0x04,0x01,0x07,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x19,0x00,
+	0x02,0x01,0x09,0x00,0x07,0x01,0x07,0x00,0x08,0x01,0x08,0x00,0x01,0x01,0x1E,0x00,
+	0x03,0x01,0x08,0x00,0x03,0x01,0x02,0x00,0x01,0x01,0x04,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x09,0x00,0x04,0x01,0x1A,0x00,0x03,0x01,0x80,0x00,0x01,0x01,0x08,0x00,
+	0x03,0x01,0x07,0x00,0x02,0x01,0x04,0x00,0x02,0x01,0x05,0x00,0x01,0x01,0x05,0x00,
+	0x01,0x01,0x14,0x00,0x02,0x01,0x04,0x00,0x02,0x01,0x08,0x00,0x01,0x01,0x0E,0x00,
+	0x03,0x01,0x07,0x00,0x01,0x01,0x05,0x00,0x01,0x01,0x19,0x00,0x02,0x01,0x0B,0x00,
+	0x03,0x01,0x0A,0x00,0x03,0x01,0x01,0x00,0x01,0x01,0x08,0x00,0x01,0x01,0x7F,0x00,
+	0x7F,0x00,0x0E,0x00,0x01,0x01,0x7F,0x00,0x7F,0x00,0x3D,0x00,0x01,0x01,0x7F,0x00,
+	0x7F,0x00,0x3C,0x00,0x02,0x01,0x7F,0x00,0x7F,0x00,0x3A,0x00,0x03,0x01,0x7F,0x00,
+	0x7F,0x00,0x3B,0x00,0x02,0x01,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7E,0x00,0x83,0x02,
+	0x03,0x04,0x05,0x03,0x00,0x81,0x06,0x07,0x01,0x08,0x80,0x04,0x7F,0x00,0x7F,0x00,
+	0x31,0x00,0x81,0x09,0x0A,0x01,0x0B,0x81,0x0A,0x05,0x01,0x00,0x80,0x0C,0x01,0x0D,
+	0x80,0x0E,0x01,0x0D,0x80,0x0F,0x7F,0x00,0x7F,0x00,0x30,0x00,0x81,0x10,0x0B,0x01,
+	0x0E,0x81,0x0B,0x10,0x01,0x00,0x82,0x11,0x12,0x0D,0x01,0x0E,0x82,0x0D,0x13,0x09,
+	0x7F,0x00,0x7F,0x00,0x2F,0x00,0x80,0x14,0x01,0x0D,0x82,0x0E,0x15,0x16,0x02,0x00,
+	0x80,0x07,0x03,0x0E,0x81,0x0D,0x17,0x7F,0x00,0x7F,0x00,0x2E,0x00,0x80,0x09,0x01,
+	0x13,0x83,0x07,0x12,0x18,0x09,0x02,0x00,0x81,0x04,0x0B,0x02,0x0E,0x81,0x0D,0x0F,
+	0x7F,0x00,0x7F,0x00,0x2E,0x00,0x85,0x0C,0x15,0x0E,0x19,0x1A,0x05,0x03,0x00,0x86,
+	0x1B,0x1C,0x0A,0x13,0x0E,0x0D,0x1D,0x7F,0x00,0x7F,0x00,0x2E,0x00,0x81,0x1E,0x0B,
+	0x01,0x0E,0x81,0x0D,0x18,0x03,0x00,0x88,0x1F,0x14,0x1C,0x07,0x0E,0x0D,0x03,0x09,
+	0x11,0x7F,0x00,0x7F,0x00,0x2C,0x00,0x85,0x06,0x0D,0x0E,0x0D,0x0B,0x20,0x03,0x00,
+	0x89,0x21,0x0B,0x0D,0x15,0x07,0x19,0x18,0x12,0x07,0x09,0x7F,0x00,0x7F,0x00,0x2B,
+	0x00,0x85,0x1A,0x0D,0x13,0x07,0x19,0x22,0x03,0x00,0x82,0x10,0x15,0x13,0x01,0x1C,
+	0x84,0x13,0x0D,0x0E,0x15,0x20,0x7F,0x00,0x7F,0x00,0x2B,0x00,0x86,0x1A,0x15,0x13,
+	0x23,0x10,0x24,0x09,0x02,0x00,0x81,0x25,0x0B,0x01,0x1C,0x80,0x0D,0x03,0x0E,0x81,
+	0x0D,0x02,0x7F,0x00,0x7F,0x00,0x24,0x00,0x01,0x11,0x03,0x00,0x82,0x1A,0x0D,0x0E,
+	0x02,0x0D,0x80,0x17,0x01,0x00,0x87,0x0C,0x0E,0x0D,0x18,0x14,0x15,0x0E,0x0D,0x01,
+	0x0E,0x81,0x0D,0x1A,0x7F,0x00,0x7F,0x00,0x23,0x00,0x84,0x11,0x13,0x12,0x08,0x25,
+	0x01,0x00,0x80,0x1A,0x01,0x0D,0x01,0x0E,0x81,0x0D,0x04,0x01,0x00,0x8B,0x18,0x0D,
+	0x0E,0x13,0x1A,0x14,0x12,0x07,0x19,0x13,0x0D,0x02,0x7F,0x00,0x7F,0x00,0x23,0x00,
+	0x88,0x1C,0x15,0x0E,0x0D,0x12,0x11,0x00,0x1A,0x0D,0x02,0x0E,0x83,0x0D,0x07,0x02,
+	0x20,0x02,0x0E,0x87,0x13,0x23,0x19,0x1A,0x03,0x07,0x0D,0x07,0x7F,0x00,0x30,0x00,
+	0x83,0x02,0x03,0x04,0x05,0x03,0x00,0x81,0x06,0x07,0x01,0x08,0x80,0x04,0x65,0x00,
+	0x81,0x16,0x0D,0x02,0x0E,0x84,0x0D,0x0C,0x00,0x21,0x0D,0x05,0x0E,0x80,0x0D,0x01,
+	0x0E,0x84,0x0D,0x14,0x25,0x0B,0x12,0x02,0x0D,0x84,0x10,0x0C,0x03,0x1C,0x16,0x7F,
+	0x00,0x2B,0x00,0x81,0x09,0x0A,0x01,0x0B,0x81,0x0A,0x05,0x01,0x00,0x80,0x0C,0x01,
+	0x0D,0x80,0x0E,0x01,0x0D,0x80,0x0F,0x64,0x00,0x81,0x07,0x0D,0x02,0x0E,0x84,0x15,
+	0x10,0x00,0x0C,0x15,0x09,0x0E,0x01,0x13,0x02,0x0E,0x82,0x0D,0x07,0x10,0x01,0x15,
+	0x01,0x0D,0x80,0x1C,0x7F,0x00,0x2A,0x00,0x81,0x10,0x0B,0x01,0x0E,0x81,0x0B,0x10,
+	0x01,0x00,0x82,0x11,0x12,0x0D,0x01,0x0E,0x82,0x0D,0x13,0x09,0x62,0x00,0x81,0x04,
+	0x0D,0x03,0x0E,0x84,0x0D,0x1A,0x00,0x0C,0x0B,0x0E,0x0E,0x83,0x0D,0x0F,0x24,0x0D,
+	0x02,0x0E,0x81,0x0B,0x1C,0x7F,0x00,0x29,0x00,0x80,0x14,0x01,0x0D,0x82,0x0E,0x15,
+	0x16,0x02,0x00,0x80,0x07,0x03,0x0E,0x81,0x0D,0x17,0x61,0x00,0x81,0x26,0x13,0x04,
+	0x0E,0x84,0x0D,0x02,0x00,0x16,0x0D,0x0D,0x0E,0x85,0x0D,0x25,0x11,0x19,0x0B,0x0D,
+	0x01,0x0E,0x81,0x0D,0x18,0x7F,0x00,0x28,0x00,0x80,0x09,0x01,0x13,0x83,0x07,0x12,
+	0x18,0x09,0x02,0x00,0x81,0x04,0x0B,0x02,0x0E,0x81,0x0D,0x0F,0x62,0x00,0x80,0x0A,
+	0x02,0x0E,0x01,0x0D,0x80,0x1D,0x01,0x00,0x81,0x03,0x15,0x0E,0x0E,0x88,0x0F,0x24,
+	0x10,0x03,0x19,0x14,0x0D,0x0B,0x19,0x7F,0x00,0x28,0x00,0x85,0x0C,0x15,0x0E,0x19,
+	0x1A,0x05,0x03,0x00,0x86,0x1B,0x1C,0x0A,0x13,0x0E,0x0D,0x1D,0x62,0x00,0x89,0x1C,
+	0x15,0x0E,0x13,0x25,0x21,0x0C,0x27,0x02,0x12,0x10,0x0E,0x87,0x0D,0x13,0x18,0x1C,
+	0x13,0x15,0x25,0x09,0x7F,0x00,0x28,0x00,0x81,0x1E,0x0B,0x01,0x0E,0x81,0x0D,0x18,
+	0x03,0x00,0x88,0x1F,0x14,0x1C,0x07,0x0E,0x0D,0x03,0x09,0x11,0x60,0x00,0x81,0x10,
+	0x0B,0x01,0x0E,0x85,0x13,0x24,0x0E,0x1A,0x1C,0x0D,0x12,0x0E,0x83,0x0D,0x15,0x0D,
+	0x04,0x7F,0x00,0x2A,0x00,0x85,0x06,0x0D,0x0E,0x0D,0x0B,0x20,0x03,0x00,0x89,0x21,
+	0x0B,0x0D,0x15,0x07,0x19,0x18,0x12,0x07,0x09,0x5F,0x00,0x81,0x16,0x15,0x02,0x0E,
+	0x01,0x0D,0x81,0x07,0x12,0x13,0x0E,0x82,0x0D,0x12,0x21,0x7F,0x00,0x2B,0x00,0x85,
+	0x1A,0x0D,0x13,0x07,0x19,0x22,0x03,0x00,0x82,0x10,0x15,0x13,0x01,0x1C,0x84,0x13,
+	0x0D,0x0E,0x15,0x20,0x5F,0x00,0x81,0x1B,0x12,0x04,0x0E,0x80,0x0D,0x13,0x0E,0x82,
+	0x0D,0x08,0x02,0x7F,0x00,0x2C,0x00,0x86,0x1A,0x15,0x13,0x23,0x10,0x24,0x09,0x02,
+	0x00,0x81,0x25,0x0B,0x01,0x1C,0x80,0x0D,0x03,0x0E,0x81,0x0D,0x02,0x5F,0x00,0x81,
+	0x07,0x0D,0x18,0x0E,0x81,0x0D,0x0C,0x7F,0x00,0x27,0x00,0x01,0x11,0x03,0x00,0x82,
+	0x1A,0x0D,0x0E,0x02,0x0D,0x80,0x17,0x01,0x00,0x87,0x0C,0x0E,0x0D,0x18,0x14,0x15,
+	0x0E,0x0D,0x01,0x0E,0x81,0x0D,0x1A,0x5F,0x00,0x81,0x1C,0x0D,0x17,0x0E,0x81,0x0D,
+	0x1C,0x7F,0x00,0x27,0x00,0x84,0x11,0x13,0x12,0x08,0x25,0x01,0x00,0x80,0x1A,0x01,
+	0x0D,0x01,0x0E,0x81,0x0D,0x04,0x01,0x00,0x8B,0x18,0x0D,0x0E,0x13,0x1A,0x14,0x12,
+	0x07,0x19,0x13,0x0D,0x02,0x5F,0x00,0x81,0x10,0x0D,0x17,0x0E,0x81,0x0D,0x10,0x7F,
+	0x00,0x27,0x00,0x88,0x1C,0x15,0x0E,0x0D,0x12,0x11,0x00,0x1A,0x0D,0x02,0x0E,0x83,
+	0x0D,0x07,0x02,0x20,0x02,0x0E,0x87,0x13,0x23,0x19,0x1A,0x03,0x07,0x0D,0x07,0x60,
+	0x00,0x81,0x0C,0x15,0x17,0x0E,0x81,0x0D,0x17,0x7F,0x00,0x26,0x00,0x81,0x16,0x0D,
+	0x02,0x0E,0x84,0x0D,0x0C,0x00,0x21,0x0D,0x05,0x0E,0x80,0x0D,0x01,0x0E,0x84,0x0D,
+	0x14,0x25,0x0B,0x12,0x02,0x0D,0x84,0x10,0x0C,0x03,0x1C,0x16,0x5C,0x00,0x80,0x09,
+	0x17,0x0E,0x82,0x0D,0x08,0x26,0x7F,0x00,0x26,0x00,0x81,0x07,0x0D,0x02,0x0E,0x84,
+	0x15,0x10,0x00,0x0C,0x15,0x09,0x0E,0x01,0x13,0x02,0x0E,0x82,0x0D,0x07,0x10,0x01,
+	0x15,0x01,0x0D,0x80,0x1C,0x5C,0x00,0x81,0x24,0x0D,0x15,0x0E,0x81,0x0D,0x25,0x7F,
+	0x00,0x26,0x00,0x81,0x04,0x0D,0x03,0x0E,0x84,0x0D,0x1A,0x00,0x0C,0x0B,0x0E,0x0E,
+	0x83,0x0D,0x0F,0x24,0x0D,0x02,0x0E,0x81,0x0B,0x1C,0x5B,0x00,0x81,0x1C,0x0D,0x15,
+	0x0E,0x81,0x15,0x10,0x7F,0x00,0x25,0x00,0x81,0x26,0x13,0x04,0x0E,0x84,0x0D,0x02,
+	0x00,0x16,0x0D,0x0D,0x0E,0x85,0x0D,0x25,0x11,0x19,0x0B,0x0D,0x01,0x0E,0x81,0x0D,
+	0x18,0x5B,0x00,0x82,0x17,0x0E,0x0D,0x15,0x0E,0x80,0x17,0x7F,0x00,0x26,0x00,0x80,
+	0x0A,0x02,0x0E,0x01,0x0D,0x80,0x1D,0x01,0x00,0x81,0x03,0x15,0x0E,0x0E,0x88,0x0F,
+	0x24,0x10,0x03,0x19,0x14,0x0D,0x0B,0x19,0x5C,0x00,0x81,0x1D,0x0D,0x13,0x0E,0x81,
+	0x0D,0x07,0x7F,0x00,0x27,0x00,0x89,0x1C,0x15,0x0E,0x13,0x25,0x21,0x0C,0x27,0x02,
+	0x12,0x10,0x0E,0x87,0x0D,0x13,0x18,0x1C,0x13,0x15,0x25,0x09,0x5C,0x00,0x81,0x26,
+	0x08,0x13,0x0E,0x81,0x0D,0x20,0x7F,0x00,0x27,0x00,0x81,0x10,0x0B,0x01,0x0E,0x85,
+	0x13,0x24,0x0E,0x1A,0x1C,0x0D,0x12,0x0E,0x83,0x0D,0x15,0x0D,0x04,0x5F,0x00,0x81,
+	0x1A,0x15,0x12,0x0E,0x81,0x0D,0x0C,0x7F,0x00,0x27,0x00,0x81,0x16,0x15,0x02,0x0E,
+	0x01,0x0D,0x81,0x07,0x12,0x13,0x0E,0x82,0x0D,0x12,0x21,0x61,0x00,0x81,0x1C,0x15,
+	0x10,0x0E,0x81,0x0D,0x24,0x7F,0x00,0x28,0x00,0x81,0x1B,0x12,0x04,0x0E,0x80,0x0D,
+	0x13,0x0E,0x82,0x0D,0x08,0x02,0x62,0x00,0x81,0x11,0x13,0x10,0x0E,0x81,0x0B,0x06,
+	0x7F,0x00,0x29,0x00,0x81,0x07,0x0D,0x18,0x0E,0x81,0x0D,0x0C,0x64,0x00,0x81,0x1E,
+	0x15,0x0E,0x0E,0x81,0x0D,0x18,0x7F,0x00,0x2A,0x00,0x81,0x1C,0x0D,0x17,0x0E,0x81,
+	0x0D,0x1C,0x66,0x00,0x81,0x18,0x0D,0x0C,0x0E,0x82,0x0D,0x13,0x02,0x7F,0x00,0x2A,
+	0x00,0x81,0x10,0x0D,0x17,0x0E,0x81,0x0D,0x10,0x66,0x00,0x81,0x10,0x0D,0x0C,0x0E,
+	0x82,0x08,0x1E,0x0C,0x7F,0x00,0x2A,0x00,0x81,0x0C,0x15,0x17,0x0E,0x81,0x0D,0x17,
+	0x2E,0x00,0x83,0x02,0x03,0x04,0x05,0x03,0x00,0x81,0x06,0x07,0x01,0x08,0x80,0x04,
+	0x2A,0x00,0x81,0x0F,0x15,0x09,0x0E,0x85,0x13,0x24,0x19,0x04,0x1C,0x23,0x7F,0x00,
+	0x2A,0x00,0x80,0x09,0x17,0x0E,0x82,0x0D,0x08,0x26,0x2D,0x00,0x81,0x09,0x0A,0x01,
+	0x0B,0x81,0x0A,0x05,0x01,0x00,0x80,0x0C,0x01,0x0D,0x80,0x0E,0x01,0x0D,0x80,0x0F,
+	0x29,0x00,0x81,0x28,0x0D,0x0C,0x0E,0x82,0x0D,0x0B,0x16,0x7F,0x00,0x2B,0x00,0x81,
+	0x24,0x0D,0x15,0x0E,0x81,0x0D,0x25,0x2E,0x00,0x81,0x10,0x0B,0x01,0x0E,0x81,0x0B,
+	0x10,0x01,0x00,0x82,0x11,0x12,0x0D,0x01,0x0E,0x82,0x0D,0x13,0x09,0x28,0x00,0x81,
+	0x1A,0x0D,0x0D,0x0E,0x81,0x0D,0x0C,0x7F,0x00,0x2B,0x00,0x81,0x1C,0x0D,0x15,0x0E,
+	0x81,0x15,0x10,0x2E,0x00,0x80,0x14,0x01,0x0D,0x82,0x0E,0x15,0x16,0x02,0x00,0x80,
+	0x07,0x03,0x0E,0x81,0x0D,0x17,0x28,0x00,0x81,0x10,0x0D,0x0D,0x0E,0x81,0x0D,0x1A,
+	0x7F,0x00,0x2B,0x00,0x82,0x17,0x0E,0x0D,0x15,0x0E,0x80,0x17,0x2D,0x00,0x80,0x09,
+	0x01,0x13,0x83,0x07,0x12,0x18,0x09,0x02,0x00,0x81,0x04,0x0B,0x02,0x0E,0x81,0x0D,
+	0x0F,0x28,0x00,0x81,0x19,0x15,0x0D,0x0E,0x81,0x0D,0x10,0x7F,0x00,0x2C,0x00,0x81,
+	0x1D,0x0D,0x13,0x0E,0x81,0x0D,0x07,0x2E,0x00,0x85,0x0C,0x15,0x0E,0x19,0x1A,0x05,
+	0x03,0x00,0x86,0x1B,0x1C,0x0A,0x13,0x0E,0x0D,0x1D,0x28,0x00,0x81,0x07,0x0D,0x0D,
+	0x0E,0x81,0x0D,0x20,0x7F,0x00,0x2C,0x00,0x81,0x26,0x08,0x13,0x0E,0x81,0x0D,0x20,
+	0x2E,0x00,0x81,0x1E,0x0B,0x01,0x0E,0x81,0x0D,0x18,0x03,0x00,0x88,0x1F,0x14,0x1C,
+	0x07,0x0E,0x0D,0x03,0x09,0x11,0x25,0x00,0x81,0x1B,0x13,0x0E,0x0E,0x81,0x0D,0x25,
+	0x7F,0x00,0x2D,0x00,0x81,0x1A,0x15,0x12,0x0E,0x81,0x0D,0x0C,0x2E,0x00,0x85,0x06,
+	0x0D,0x0E,0x0D,0x0B,0x20,0x03,0x00,0x89,0x21,0x0B,0x0D,0x15,0x07,0x19,0x18,0x12,
+	0x07,0x09,0x24,0x00,0x81,0x22,0x0D,0x05,0x0E,0x80,0x12,0x01,0x0D,0x05,0x0E,0x81,
+	0x0D,0x24,0x7F,0x00,0x2E,0x00,0x81,0x1C,0x15,0x10,0x0E,0x81,0x0D,0x24,0x2F,0x00,
+	0x85,0x1A,0x0D,0x13,0x07,0x19,0x22,0x03,0x00,0x82,0x10,0x15,0x13,0x01,0x1C,0x84,
+	0x13,0x0D,0x0E,0x15,0x20,0x24,0x00,0x81,0x10,0x0D,0x02,0x0E,0x86,0x0D,0x12,0x0D,
+	0x07,0x20,0x24,0x0D,0x04,0x0E,0x82,0x07,0x08,0x26,0x7F,0x00,0x2D,0x00,0x81,0x11,
+	0x13,0x10,0x0E,0x81,0x0B,0x06,0x2F,0x00,0x86,0x1A,0x15,0x13,0x23,0x10,0x24,0x09,
+	0x02,0x00,0x81,0x25,0x0B,0x01,0x1C,0x80,0x0D,0x03,0x0E,0x81,0x0D,0x02,0x23,0x00,
+	0x81,0x19,0x15,0x01,0x0E,0x88,0x0D,0x03,0x18,0x0E,0x15,0x07,0x05,0x18,0x0D,0x01,
+	0x0E,0x84,0x0D,0x25,0x19,0x13,0x27,0x7F,0x00,0x2E,0x00,0x81,0x1E,0x15,0x0E,0x0E,
+	0x81,0x0D,0x18,0x2A,0x00,0x01,0x11,0x03,0x00,0x82,0x1A,0x0D,0x0E,0x02,0x0D,0x80,
+	0x17,0x01,0x00,0x87,0x0C,0x0E,0x0D,0x18,0x14,0x15,0x0E,0x0D,0x01,0x0E,0x81,0x0D,
+	0x1A,0x23,0x00,0x80,0x24,0x01,0x0D,0x89,0x0E,0x0A,0x11,0x0A,0x15,0x19,0x07,0x23,
+	0x1A,0x15,0x02,0x0E,0x82,0x22,0x18,0x07,0x7F,0x00,0x30,0x00,0x81,0x18,0x0D,0x0C,
+	0x0E,0x82,0x0D,0x13,0x02,0x29,0x00,0x84,0x11,0x13,0x12,0x08,0x25,0x01,0x00,0x80,
+	0x1A,0x01,0x0D,0x01,0x0E,0x81,0x0D,0x04,0x01,0x00,0x8B,0x18,0x0D,0x0E,0x13,0x1A,
+	0x14,0x12,0x07,0x19,0x13,0x0D,0x02,0x22,0x00,0x8D,0x11,0x18,0x19,0x08,0x0D,0x24,
+	0x00,0x25,0x0E,0x1F,0x24,0x07,0x11,0x07,0x01,0x0D,0x83,0x18,0x00,0x08,0x07,0x7F,
+	0x00,0x30,0x00,0x81,0x10,0x0D,0x0C,0x0E,0x82,0x08,0x1E,0x0C,0x29,0x00,0x88,0x1C,
+	0x15,0x0E,0x0D,0x12,0x11,0x00,0x1A,0x0D,0x02,0x0E,0x83,0x0D,0x07,0x02,0x20,0x02,
+	0x0E,0x87,0x13,0x23,0x19,0x1A,0x03,0x07,0x0D,0x07,0x23,0x00,0x8D,0x0C,0x24,0x22,
+	0x04,0x0D,0x0A,0x00,0x1A,0x0E,0x26,0x14,0x0E,0x00,0x19,0x01,0x15,0x83,0x04,0x00,
+	0x08,0x07,0x7F,0x00,0x30,0x00,0x81,0x0F,0x15,0x09,0x0E,0x85,0x13,0x24,0x19,0x04,
+	0x1C,0x23,0x28,0x00,0x81,0x16,0x0D,0x02,0x0E,0x84,0x0D,0x0C,0x00,0x21,0x0D,0x05,
+	0x0E,0x80,0x0D,0x01,0x0E,0x84,0x0D,0x14,0x25,0x0B,0x12,0x02,0x0D,0x84,0x10,0x0C,
+	0x03,0x1C,0x16,0x1F,0x00,0x85,0x26,0x0C,0x00,0x1A,0x15,0x18,0x01,0x00,0x8B,0x03,
+	0x00,0x06,0x1A,0x00,0x1A,0x0E,0x08,0x02,0x00,0x22,0x28,0x7F,0x00,0x30,0x00,0x81,
+	0x28,0x0D,0x0C,0x0E,0x82,0x0D,0x0B,0x16,0x28,0x00,0x81,0x07,0x0D,0x02,0x0E,0x84,
+	0x15,0x10,0x00,0x0C,0x15,0x09,0x0E,0x01,0x13,0x02,0x0E,0x82,0x0D,0x07,0x10,0x01,
+	0x15,0x01,0x0D,0x80,0x1C,0x22,0x00,0x81,0x1F,0x11,0x07,0x00,0x80,0x27,0x7F,0x00,
+	0x35,0x00,0x81,0x1A,0x0D,0x0D,0x0E,0x81,0x0D,0x0C,0x27,0x00,0x81,0x04,0x0D,0x03,
+	0x0E,0x84,0x0D,0x1A,0x00,0x0C,0x0B,0x0E,0x0E,0x83,0x0D,0x0F,0x24,0x0D,0x02,0x0E,
+	0x81,0x0B,0x1C,0x69,0x00,0x83,0x02,0x03,0x04,0x05,0x03,0x00,0x81,0x06,0x07,0x01,
+	0x08,0x80,0x04,0x6B,0x00,0x81,0x10,0x0D,0x0D,0x0E,0x81,0x0D,0x1A,0x26,0x00,0x81,
+	0x26,0x13,0x04,0x0E,0x84,0x0D,0x02,0x00,0x16,0x0D,0x0D,0x0E,0x85,0x0D,0x25,0x11,
+	0x19,0x0B,0x0D,0x01,0x0E,0x81,0x0D,0x18,0x68,0x00,0x81,0x09,0x0A,0x01,0x0B,0x81,
+	0x0A,0x05,0x01,0x00,0x80,0x0C,0x01,0x0D,0x80,0x0E,0x01,0x0D,0x80,0x0F,0x6A,0x00,
+	0x81,0x19,0x15,0x0D,0x0E,0x81,0x0D,0x10,0x27,0x00,0x80,0x0A,0x02,0x0E,0x01,0x0D,
+	0x80,0x1D,0x01,0x00,0x81,0x03,0x15,0x0E,0x0E,0x88,0x0F,0x24,0x10,0x03,0x19,0x14,
+	0x0D,0x0B,0x19,0x68,0x00,0x81,0x10,0x0B,0x01,0x0E,0x81,0x0B,0x10,0x01,0x00,0x82,
+	0x11,0x12,0x0D,0x01,0x0E,0x82,0x0D,0x13,0x09,0x69,0x00,0x81,0x07,0x0D,0x0D,0x0E,
+	0x81,0x0D,0x20,0x27,0x00,0x89,0x1C,0x15,0x0E,0x13,0x25,0x21,0x0C,0x27,0x02,0x12,
+	0x10,0x0E,0x87,0x0D,0x13,0x18,0x1C,0x13,0x15,0x25,0x09,0x68,0x00,0x80,0x14,0x01,
+	0x0D,0x82,0x0E,0x15,0x16,0x02,0x00,0x80,0x07,0x03,0x0E,0x81,0x0D,0x17,0x68,0x00,
+	0x81,0x1B,0x13,0x0E,0x0E,0x81,0x0D,0x25,0x27,0x00,0x81,0x10,0x0B,0x01,0x0E,0x85,
+	0x13,0x24,0x0E,0x1A,0x1C,0x0D,0x12,0x0E,0x83,0x0D,0x15,0x0D,0x04,0x69,0x00,0x80,
+	0x09,0x01,0x13,0x83,0x07,0x12,0x18,0x09,0x02,0x00,0x81,0x04,0x0B,0x02,0x0E,0x81,
+	0x0D,0x0F,0x3B,0x00,0x83,0x02,0x03,0x04,0x05,0x03,0x00,0x81,0x06,0x07,0x01,0x08,
+	0x80,0x04,0x1F,0x00,0x81,0x22,0x0D,0x05,0x0E,0x80,0x12,0x01,0x0D,0x05,0x0E,0x81,
+	0x0D,0x24,0x27,0x00,0x81,0x16,0x15,0x02,0x0E,0x01,0x0D,0x81,0x07,0x12,0x13,0x0E,
+	0x82,0x0D,0x12,0x21,0x6A,0x00,0x85,0x0C,0x15,0x0E,0x19,0x1A,0x05,0x03,0x00,0x86,
+	0x1B,0x1C,0x0A,0x13,0x0E,0x0D,0x1D,0x3A,0x00,0x81,0x09,0x0A,0x01,0x0B,0x81,0x0A,
+	0x05,0x01,0x00,0x80,0x0C,0x01,0x0D,0x80,0x0E,0x01,0x0D,0x80,0x0F,0x1E,0x00,0x81,
+	0x10,0x0D,0x02,0x0E,0x86,0x0D,0x12,0x0D,0x07,0x20,0x24,0x0D,0x04,0x0E,0x82,0x07,
+	0x08,0x26,0x26,0x00,0x81,0x1B,0x12,0x04,0x0E,0x80,0x0D,0x13,0x0E,0x82,0x0D,0x08,
+	0x02,0x6B,0x00,0x81,0x1E,0x0B,0x01,0x0E,0x81,0x0D,0x18,0x03,0x00,0x88,0x1F,0x14,
+	0x1C,0x07,0x0E,0x0D,0x03,0x09,0x11,0x38,0x00,0x81,0x10,0x0B,0x01,0x0E,0x81,0x0B,
+	0x10,0x01,0x00,0x82,0x11,0x12,0x0D,0x01,0x0E,0x82,0x0D,0x13,0x09,0x1D,0x00,0x81,
+	0x19,0x15,0x01,0x0E,0x88,0x0D,0x03,0x18,0x0E,0x15,0x07,0x05,0x18,0x0D,0x01,0x0E,
+	0x84,0x0D,0x25,0x19,0x13,0x27,0x27,0x00,0x81,0x07,0x0D,0x18,0x0E,0x81,0x0D,0x0C,
+	0x6C,0x00,0x85,0x06,0x0D,0x0E,0x0D,0x0B,0x20,0x03,0x00,0x89,0x21,0x0B,0x0D,0x15,
+	0x07,0x19,0x18,0x12,0x07,0x09,0x37,0x00,0x80,0x14,0x01,0x0D,0x82,0x0E,0x15,0x16,
+	0x02,0x00,0x80,0x07,0x03,0x0E,0x81,0x0D,0x17,0x1D,0x00,0x80,0x24,0x01,0x0D,0x89,
+	0x0E,0x0A,0x11,0x0A,0x15,0x19,0x07,0x23,0x1A,0x15,0x02,0x0E,0x82,0x22,0x18,0x07,
+	0x28,0x00,0x81,0x1C,0x0D,0x17,0x0E,0x81,0x0D,0x1C,0x6D,0x00,0x85,0x1A,0x0D,0x13,
+	0x07,0x19,0x22,0x03,0x00,0x82,0x10,0x15,0x13,0x01,0x1C,0x84,0x13,0x0D,0x0E,0x15,
+	0x20,0x36,0x00,0x80,0x09,0x01,0x13,0x83,0x07,0x12,0x18,0x09,0x02,0x00,0x81,0x04,
+	0x0B,0x02,0x0E,0x81,0x0D,0x0F,0x1C,0x00,0x8D,0x11,0x18,0x19,0x08,0x0D,0x24,0x00,
+	0x25,0x0E,0x1F,0x24,0x07,0x11,0x07,0x01,0x0D,0x83,0x18,0x00,0x08,0x07,0x28,0x00,
+	0x81,0x10,0x0D,0x17,0x0E,0x81,0x0D,0x10,0x6D,0x00,0x86,0x1A,0x15,0x13,0x23,0x10,
+	0x24,0x09,0x02,0x00,0x81,0x25,0x0B,0x01,0x1C,0x80,0x0D,0x03,0x0E,0x81,0x0D,0x02,
+	0x35,0x00,0x85,0x0C,0x15,0x0E,0x19,0x1A,0x05,0x03,0x00,0x86,0x1B,0x1C,0x0A,0x13,
+	0x0E,0x0D,0x1D,0x1C,0x00,0x8D,0x0C,0x24,0x22,0x04,0x0D,0x0A,0x00,0x1A,0x0E,0x26,
+	0x14,0x0E,0x00,0x19,0x01,0x15,0x83,0x04,0x00,0x08,0x07,0x28,0x00,0x81,0x0C,0x15,
+	0x17,0x0E,0x81,0x0D,0x17,0x67,0x00,0x01,0x11,0x03,0x00,0x82,0x1A,0x0D,0x0E,0x02,
+	0x0D,0x80,0x17,0x01,0x00,0x87,0x0C,0x0E,0x0D,0x18,0x14,0x15,0x0E,0x0D,0x01,0x0E,
+	0x81,0x0D,0x1A,0x35,0x00,0x81,0x1E,0x0B,0x01,0x0E,0x81,0x0D,0x18,0x03,0x00,0x88,
+	0x1F,0x14,0x1C,0x07,0x0E,0x0D,0x03,0x09,0x11,0x1A,0x00,0x85,0x26,0x0C,0x00,0x1A,
+	0x15,0x18,0x01,0x00,0x8B,0x03,0x00,0x06,0x1A,0x00,0x1A,0x0E,0x08,0x02,0x00,0x22,
+	0x28,0x28,0x00,0x80,0x09,0x17,0x0E,0x82,0x0D,0x08,0x26,0x66,0x00,0x84,0x11,0x13,
+	0x12,0x08,0x25,0x01,0x00,0x80,0x1A,0x01,0x0D,0x01,0x0E,0x81,0x0D,0x04,0x01,0x00,
+	0x8B,0x18,0x0D,0x0E,0x13,0x1A,0x14,0x12,0x07,0x19,0x13,0x0D,0x02,0x35,0x00,0x85,
+	0x06,0x0D,0x0E,0x0D,0x0B,0x20,0x03,0x00,0x89,0x21,0x0B,0x0D,0x15,0x07,0x19,0x18,
+	0x12,0x07,0x09,0x1D,0x00,0x81,0x1F,0x11,0x07,0x00,0x80,0x27,0x2E,0x00,0x81,0x24,
+	0x0D,0x15,0x0E,0x81,0x0D,0x25,0x67,0x00,0x88,0x1C,0x15,0x0E,0x0D,0x12,0x11,0x00,
+	0x1A,0x0D,0x02,0x0E,0x83,0x0D,0x07,0x02,0x20,0x02,0x0E,0x87,0x13,0x23,0x19,0x1A,
+	0x03,0x07,0x0D,0x07,0x36,0x00,0x85,0x1A,0x0D,0x13,0x07,0x19,0x22,0x03,0x00,0x82,
+	0x10,0x15,0x13,0x01,0x1C,0x84,0x13,0x0D,0x0E,0x15,0x20,0x57,0x00,0x81,0x1C,0x0D,
+	0x15,0x0E,0x81,0x15,0x10,0x66,0x00,0x81,0x16,0x0D,0x02,0x0E,0x84,0x0D,0x0C,0x00,
+	0x21,0x0D,0x05,0x0E,0x80,0x0D,0x01,0x0E,0x84,0x0D,0x14,0x25,0x0B,0x12,0x02,0x0D,
+	0x84,0x10,0x0C,0x03,0x1C,0x16,0x32,0x00,0x86,0x1A,0x15,0x13,0x23,0x10,0x24,0x09,
+	0x02,0x00,0x81,0x25,0x0B,0x01,0x1C,0x80,0x0D,0x03,0x0E,0x81,0x0D,0x02,0x56,0x00,
+	0x82,0x17,0x0E,0x0D,0x15,0x0E,0x80,0x17,0x66,0x00,0x81,0x07,0x0D,0x02,0x0E,0x84,
+	0x15,0x10,0x00,0x0C,0x15,0x09,0x0E,0x01,0x13,0x02,0x0E,0x82,0x0D,0x07,0x10,0x01,
+	0x15,0x01,0x0D,0x80,0x1C,0x2B,0x00,0x01,0x11,0x03,0x00,0x82,0x1A,0x0D,0x0E,0x02,
+	0x0D,0x80,0x17,0x01,0x00,0x87,0x0C,0x0E,0x0D,0x18,0x14,0x15,0x0E,0x0D,0x01,0x0E,
+	0x81,0x0D,0x1A,0x57,0x00,0x81,0x1D,0x0D,0x13,0x0E,0x81,0x0D,0x07,0x35,0x00,0x83,
+	0x02,0x03,0x04,0x05,0x03,0x00,0x81,0x06,0x07,0x01,0x08,0x80,0x04,0x23,0x00,0x81,
+	0x04,0x0D,0x03,0x0E,0x84,0x0D,0x1A,0x00,0x0C,0x0B,0x0E,0x0E,0x83,0x0D,0x0F,0x24,
+	0x0D,0x02,0x0E,0x81,0x0B,0x1C,0x29,0x00,0x84,0x11,0x13,0x12,0x08,0x25,0x01,0x00,
+	0x80,0x1A,0x01,0x0D,0x01,0x0E,0x81,0x0D,0x04,0x01,0x00,0x8B,0x18,0x0D,0x0E,0x13,
+	0x1A,0x14,0x12,0x07,0x19,0x13,0x0D,0x02,0x57,0x00,0x81,0x26,0x08,0x13,0x0E,0x81,
+	0x0D,0x20,0x34,0x00,0x81,0x09,0x0A,0x01,0x0B,0x81,0x0A,0x05,0x01,0x00,0x80,0x0C,
+	0x01,0x0D,0x80,0x0E,0x01,0x0D,0x80,0x0F,0x21,0x00,0x81,0x26,0x13,0x04,0x0E,0x84,
+	0x0D,0x02,0x00,0x16,0x0D,0x0D,0x0E,0x85,0x0D,0x25,0x11,0x19,0x0B,0x0D,0x01,0x0E,
+	0x81,0x0D,0x18,0x29,0x00,0x88,0x1C,0x15,0x0E,0x0D,0x12,0x11,0x00,0x1A,0x0D,0x02,
+	0x0E,0x83,0x0D,0x07,0x02,0x20,0x02,0x0E,0x87,0x13,0x23,0x19,0x1A,0x03,0x07,0x0D,
+	0x07,0x59,0x00,0x81,0x1A,0x15,0x12,0x0E,0x81,0x0D,0x0C,0x34,0x00,0x81,0x10,0x0B,
+	0x01,0x0E,0x81,0x0B,0x10,0x01,0x00,0x82,0x11,0x12,0x0D,0x01,0x0E,0x82,0x0D,0x13,
+	0x09,0x21,0x00,0x80,0x0A,0x02,0x0E,0x01,0x0D,0x80,0x1D,0x01,0x00,0x81,0x03,0x15,
+	0x0E,0x0E,0x88,0x0F,0x24,0x10,0x03,0x19,0x14,0x0D,0x0B,0x19,0x28,0x00,0x81,0x16,
+	0x0D,0x02,0x0E,0x84,0x0D,0x0C,0x00,0x21,0x0D,0x05,0x0E,0x80,0x0D,0x01,0x0E,0x84,
+	0x0D,0x14,0x25,0x0B,0x12,0x02,0x0D,0x84,0x10,0x0C,0x03,0x1C,0x16,0x2A,0x00,0x83,
+	0x02,0x03,0x04,0x05,0x03,0x00,0x81,0x06,0x07,0x01,0x08,0x80,0x04,0x1E,0x00,0x81,
+	0x1C,0x15,0x10,0x0E,0x81,0x0D,0x24,0x35,0x00,0x80,0x14,0x01,0x0D,0x82,0x0E,0x15,
+	0x16,0x02,0x00,0x80,0x07,0x03,0x0E,0x81,0x0D,0x17,0x21,0x00,0x89,0x1C,0x15,0x0E,
+	0x13,0x25,0x21,0x0C,0x27,0x02,0x12,0x10,0x0E,0x87,0x0D,0x13,0x18,0x1C,0x13,0x15,
+	0x25,0x09,0x28,0x00,0x81,0x07,0x0D,0x02,0x0E,0x84,0x15,0x10,0x00,0x0C,0x15,0x09,
+	0x0E,0x01,0x13,0x02,0x0E,0x82,0x0D,0x07,0x10,0x01,0x15,0x01,0x0D,0x80,0x1C,0x28,
+	0x00,0x81,0x09,0x0A,0x01,0x0B,0x81,0x0A,0x05,0x01,0x00,0x80,0x0C,0x01,0x0D,0x80,
+	0x0E,0x01,0x0D,0x80,0x0F,0x1D,0x00,0x81,0x11,0x13,0x10,0x0E,0x81,0x0B,0x06,0x34,
+	0x00,0x80,0x09,0x01,0x13,0x83,0x07,0x12,0x18,0x09,0x02,0x00,0x81,0x04,0x0B,0x02,
+	0x0E,0x81,0x0D,0x0F,0x21,0x00,0x81,0x10,0x0B,0x01,0x0E,0x85,0x13,0x24,0x0E,0x1A,
+	0x1C,0x0D,0x12,0x0E,0x83,0x0D,0x15,0x0D,0x04,0x29,0x00,0x81,0x04,0x0D,0x03,0x0E,
+	0x84,0x0D,0x1A,0x00,0x0C,0x0B,0x0E,0x0E,0x83,0x0D,0x0F,0x24,0x0D,0x02,0x0E,0x81,
+	0x0B,0x1C,0x27,0x00,0x81,0x10,0x0B,0x01,0x0E,0x81,0x0B,0x10,0x01,0x00,0x82,0x11,
+	0x12,0x0D,0x01,0x0E,0x82,0x0D,0x13,0x09,0x1D,0x00,0x81,0x1E,0x15,0x0E,0x0E,0x81,
+	0x0D,0x18,0x35,0x00,0x85,0x0C,0x15,0x0E,0x19,0x1A,0x05,0x03,0x00,0x86,0x1B,0x1C,
+	0x0A,0x13,0x0E,0x0D,0x1D,0x21,0x00,0x81,0x16,0x15,0x02,0x0E,0x01,0x0D,0x81,0x07,
+	0x12,0x13,0x0E,0x82,0x0D,0x12,0x21,0x29,0x00,0x81,0x26,0x13,0x04,0x0E,0x84,0x0D,
+	0x02,0x00,0x16,0x0D,0x0D,0x0E,0x85,0x0D,0x25,0x11,0x19,0x0B,0x0D,0x01,0x0E,0x81,
+	0x0D,0x18,0x27,0x00,0x80,0x14,0x01,0x0D,0x82,0x0E,0x15,0x16,0x02,0x00,0x80,0x07,
+	0x03,0x0E,0x81,0x0D,0x17,0x1E,0x00,0x81,0x18,0x0D,0x0C,0x0E,0x82,0x0D,0x13,0x02,
+	0x35,0x00,0x81,0x1E,0x0B,0x01,0x0E,0x81,0x0D,0x18,0x03,0x00,0x88,0x1F,0x14,0x1C,
+	0x07,0x0E,0x0D,0x03,0x09,0x11,0x1F,0x00,0x81,0x1B,0x12,0x04,0x0E,0x80,0x0D,0x13,
+	0x0E,0x82,0x0D,0x08,0x02,0x2B,0x00,0x80,0x0A,0x02,0x0E,0x01,0x0D,0x80,0x1D,0x01,
+	0x00,0x81,0x03,0x15,0x0E,0x0E,0x88,0x0F,0x24,0x10,0x03,0x19,0x14,0x0D,0x0B,0x19,
+	0x26,0x00,0x80,0x09,0x01,0x13,0x83,0x07,0x12,0x18,0x09,0x02,0x00,0x81,0x04,0x0B,
+	0x02,0x0E,0x81,0x0D,0x0F,0x1E,0x00,0x81,0x10,0x0D,0x0C,0x0E,0x82,0x08,0x1E,0x0C,
+	0x35,0x00,0x85,0x06,0x0D,0x0E,0x0D,0x0B,0x20,0x03,0x00,0x89,0x21,0x0B,0x0D,0x15,
+	0x07,0x19,0x18,0x12,0x07,0x09,0x1F,0x00,0x81,0x07,0x0D,0x18,0x0E,0x81,0x0D,0x0C,
+	0x2C,0x00,0x89,0x1C,0x15,0x0E,0x13,0x25,0x21,0x0C,0x27,0x02,0x12,0x10,0x0E,0x87,
+	0x0D,0x13,0x18,0x1C,0x13,0x15,0x25,0x09,0x26,0x00,0x85,0x0C,0x15,0x0E,0x19,0x1A,
+	0x05,0x03,0x00,0x86,0x1B,0x1C,0x0A,0x13,0x0E,0x0D,0x1D,0x1E,0x00,0x81,0x0F,0x15,
+	0x09,0x0E,0x85,0x13,0x24,0x19,0x04,0x1C,0x23,0x35,0x00,0x85,0x1A,0x0D,0x13,0x07,
+	0x19,0x22,0x03,0x00,0x82,0x10,0x15,0x13,0x01,0x1C,0x84,0x13,0x0D,0x0E,0x15,0x20,
+	0x1F,0x00,0x81,0x1C,0x0D,0x17,0x0E,0x81,0x0D,0x1C,0x2D,0x00,0x81,0x10,0x0B,0x01,
+	0x0E,0x85,0x13,0x24,0x0E,0x1A,0x1C,0x0D,0x12,0x0E,0x83,0x0D,0x15,0x0D,0x04,0x28,
+	0x00,0x81,0x1E,0x0B,0x01,0x0E,0x81,0x0D,0x18,0x03,0x00,0x88,0x1F,0x14,0x1C,0x07,
+	0x0E,0x0D,0x03,0x09,0x11,0x1C,0x00,0x81,0x28,0x0D,0x0C,0x0E,0x82,0x0D,0x0B,0x16,
+	0x35,0x00,0x86,0x1A,0x15,0x13,0x23,0x10,0x24,0x09,0x02,0x00,0x81,0x25,0x0B,0x01,
+	0x1C,0x80,0x0D,0x03,0x0E,0x81,0x0D,0x02,0x1E,0x00,0x81,0x10,0x0D,0x17,0x0E,0x81,
+	0x0D,0x10,0x2D,0x00,0x81,0x16,0x15,0x02,0x0E,0x01,0x0D,0x81,0x07,0x12,0x13,0x0E,
+	0x82,0x0D,0x12,0x21,0x29,0x00,0x85,0x06,0x0D,0x0E,0x0D,0x0B,0x20,0x03,0x00,0x89,
+	0x21,0x0B,0x0D,0x15,0x07,0x19,0x18,0x12,0x07,0x09,0x1B,0x00,0x81,0x1A,0x0D,0x0D,
+	0x0E,0x81,0x0D,0x0C,0x2F,0x00,0x01,0x11,0x03,0x00,0x82,0x1A,0x0D,0x0E,0x02,0x0D,
+	0x80,0x17,0x01,0x00,0x87,0x0C,0x0E,0x0D,0x18,0x14,0x15,0x0E,0x0D,0x01,0x0E,0x81,
+	0x0D,0x1A,0x1E,0x00,0x81,0x0C,0x15,0x17,0x0E,0x81,0x0D,0x17,0x2D,0x00,0x81,0x1B,
+	0x12,0x04,0x0E,0x80,0x0D,0x13,0x0E,0x82,0x0D,0x08,0x02,0x2A,0x00,0x85,0x1A,0x0D,
+	0x13,0x07,0x19,0x22,0x03,0x00,0x82,0x10,0x15,0x13,0x01,0x1C,0x84,0x13,0x0D,0x0E,
+	0x15,0x20,0x1B,0x00,0x81,0x10,0x0D,0x0D,0x0E,0x81,0x0D,0x1A,0x2E,0x00,0x84,0x11,
+	0x13,0x12,0x08,0x25,0x01,0x00,0x80,0x1A,0x01,0x0D,0x01,0x0E,0x81,0x0D,0x04,0x01,
+	0x00,0x8B,0x18,0x0D,0x0E,0x13,0x1A,0x14,0x12,0x07,0x19,0x13,0x0D,0x02,0x1E,0x00,
+	0x80,0x09,0x17,0x0E,0x82,0x0D,0x08,0x26,0x2E,0x00,0x81,0x07,0x0D,0x18,0x0E,0x81,
+	0x0D,0x0C,0x2B,0x00,0x86,0x1A,0x15,0x13,0x23,0x10,0x24,0x09,0x02,0x00,0x81,0x25,
+	0x0B,0x01,0x1C,0x80,0x0D,0x03,0x0E,0x81,0x0D,0x02,0x1A,0x00,0x81,0x19,0x15,0x0D,
+	0x0E,0x81,0x0D,0x10,0x2E,0x00,0x88,0x1C,0x15,0x0E,0x0D,0x12,0x11,0x00,0x1A,0x0D,
+	0x02,0x0E,0x83,0x0D,0x07,0x02,0x20,0x02,0x0E,0x87,0x13,0x23,0x19,0x1A,0x03,0x07,
+	0x0D,0x07,0x20,0x00,0x81,0x24,0x0D,0x15,0x0E,0x81,0x0D,0x25,0x2F,0x00,0x81,0x1C,
+	0x0D,0x17,0x0E,0x81,0x0D,0x1C,0x26,0x00,0x01,0x11,0x03,0x00,0x82,0x1A,0x0D,0x0E,
+	0x02,0x0D,0x80,0x17,0x01,0x00,0x87,0x0C,0x0E,0x0D,0x18,0x14,0x15,0x0E,0x0D,0x01,
+	0x0E,0x81,0x0D,0x1A,0x1A,0x00,0x81,0x07,0x0D,0x0D,0x0E,0x81,0x0D,0x20,0x2D,0x00,
+	0x81,0x16,0x0D,0x02,0x0E,0x84,0x0D,0x0C,0x00,0x21,0x0D,0x05,0x0E,0x80,0x0D,0x01,
+	0x0E,0x84,0x0D,0x14,0x25,0x0B,0x12,0x02,0x0D,0x84,0x10,0x0C,0x03,0x1C,0x16,0x1C,
+	0x00,0x81,0x1C,0x0D,0x15,0x0E,0x81,0x15,0x10,0x2F,0x00,0x81,0x10,0x0D,0x17,0x0E,
+	0x81,0x0D,0x10,0x25,0x00,0x84,0x11,0x13,0x12,0x08,0x25,0x01,0x00,0x80,0x1A,0x01,
+	0x0D,0x01,0x0E,0x81,0x0D,0x04,0x01,0x00,0x8B,0x18,0x0D,0x0E,0x13,0x1A,0x14,0x12,
+	0x07,0x19,0x13,0x0D,0x02,0x19,0x00,0x81,0x1B,0x13,0x0E,0x0E,0x81,0x0D,0x25,0x2D,
+	0x00,0x81,0x07,0x0D,0x02,0x0E,0x84,0x15,0x10,0x00,0x0C,0x15,0x09,0x0E,0x01,0x13,
+	0x02,0x0E,0x82,0x0D,0x07,0x10,0x01,0x15,0x01,0x0D,0x80,0x1C,0x1B,0x00,0x82,0x17,
+	0x0E,0x0D,0x15,0x0E,0x80,0x17,0x2F,0x00,0x81,0x0C,0x15,0x17,0x0E,0x81,0x0D,0x17,
+	0x25,0x00,0x88,0x1C,0x15,0x0E,0x0D,0x12,0x11,0x00,0x1A,0x0D,0x02,0x0E,0x83,0x0D,
+	0x07,0x02,0x20,0x02,0x0E,0x87,0x13,0x23,0x19,0x1A,0x03,0x07,0x0D,0x07,0x1A,0x00,
+	0x81,0x22,0x0D,0x05,0x0E,0x80,0x12,0x01,0x0D,0x05,0x0E,0x81,0x0D,0x24,0x2C,0x00,
+	0x81,0x04,0x0D,0x03,0x0E,0x84,0x0D,0x1A,0x00,0x0C,0x0B,0x0E,0x0E,0x83,0x0D,0x0F,
+	0x24,0x0D,0x02,0x0E,0x81,0x0B,0x1C,0x1B,0x00,0x81,0x1D,0x0D,0x13,0x0E,0x81,0x0D,
+	0x07,0x30,0x00,0x80,0x09,0x17,0x0E,0x82,0x0D,0x08,0x26,0x24,0x00,0x81,0x16,0x0D,
+	0x02,0x0E,0x84,0x0D,0x0C,0x00,0x21,0x0D,0x05,0x0E,0x80,0x0D,0x01,0x0E,0x84,0x0D,
+	0x14,0x25,0x0B,0x12,0x02,0x0D,0x84,0x10,0x0C,0x03,0x1C,0x16,0x16,0x00,0x81,0x10,
+	0x0D,0x02,0x0E,0x86,0x0D,0x12,0x0D,0x07,0x20,0x24,0x0D,0x04,0x0E,0x82,0x07,0x08,
+	0x26,0x2A,0x00,0x81,0x26,0x13,0x04,0x0E,0x84,0x0D,0x02,0x00,0x16,0x0D,0x0D,0x0E,
+	0x85,0x0D,0x25,0x11,0x19,0x0B,0x0D,0x01,0x0E,0x81,0x0D,0x18,0x1B,0x00,0x81,0x26,
+	0x08,0x13,0x0E,0x81,0x0D,0x20,0x31,0x00,0x81,0x24,0x0D,0x15,0x0E,0x81,0x0D,0x25,
+	0x25,0x00,0x81,0x07,0x0D,0x02,0x0E,0x84,0x15,0x10,0x00,0x0C,0x15,0x09,0x0E,0x01,
+	0x13,0x02,0x0E,0x82,0x0D,0x07,0x10,0x01,0x15,0x01,0x0D,0x80,0x1C,0x15,0x00,0x81,
+	0x19,0x15,0x01,0x0E,0x88,0x0D,0x03,0x18,0x0E,0x15,0x07,0x05,0x18,0x0D,0x01,0x0E,
+	0x84,0x0D,0x25,0x19,0x13,0x27,0x2B,0x00,0x80,0x0A,0x02,0x0E,0x01,0x0D,0x80,0x1D,
+	0x01,0x00,0x81,0x03,0x15,0x0E,0x0E,0x88,0x0F,0x24,0x10,0x03,0x19,0x14,0x0D,0x0B,
+	0x19,0x1C,0x00,0x81,0x1A,0x15,0x12,0x0E,0x81,0x0D,0x0C,0x31,0x00,0x81,0x1C,0x0D,
+	0x15,0x0E,0x81,0x15,0x10,0x24,0x00,0x81,0x04,0x0D,0x03,0x0E,0x84,0x0D,0x1A,0x00,
+	0x0C,0x0B,0x0E,0x0E,0x83,0x0D,0x0F,0x24,0x0D,0x02,0x0E,0x81,0x0B,0x1C,0x14,0x00,
+	0x80,0x24,0x01,0x0D,0x89,0x0E,0x0A,0x11,0x0A,0x15,0x19,0x07,0x23,0x1A,0x15,0x02,
+	0x0E,0x82,0x22,0x18,0x07,0x2C,0x00,0x89,0x1C,0x15,0x0E,0x13,0x25,0x21,0x0C,0x27,
+	0x02,0x12,0x10,0x0E,0x87,0x0D,0x13,0x18,0x1C,0x13,0x15,0x25,0x09,0x1D,0x00,0x81,
+	0x1C,0x15,0x10,0x0E,0x81,0x0D,0x24,0x32,0x00,0x82,0x17,0x0E,0x0D,0x15,0x0E,0x80,
+	0x17,0x23,0x00,0x81,0x26,0x13,0x04,0x0E,0x84,0x0D,0x02,0x00,0x16,0x0D,0x0D,0x0E,
+	0x85,0x0D,0x25,0x11,0x19,0x0B,0x0D,0x01,0x0E,0x81,0x0D,0x18,0x13,0x00,0x8D,0x11,
+	0x18,0x19,0x08,0x0D,0x24,0x00,0x25,0x0E,0x1F,0x24,0x07,0x11,0x07,0x01,0x0D,0x83,
+	0x18,0x00,0x08,0x07,0x2C,0x00,0x81,0x10,0x0B,0x01,0x0E,0x85,0x13,0x24,0x0E,0x1A,
+	0x1C,0x0D,0x12,0x0E,0x83,0x0D,0x15,0x0D,0x04,0x1F,0x00,0x81,0x11,0x13,0x10,0x0E,
+	0x81,0x0B,0x06,0x33,0x00,0x81,0x1D,0x0D,0x13,0x0E,0x81,0x0D,0x07,0x25,0x00,0x80,
+	0x0A,0x02,0x0E,0x01,0x0D,0x80,0x1D,0x01,0x00,0x81,0x03,0x15,0x0E,0x0E,0x88,0x0F,
+	0x24,0x10,0x03,0x19,0x14,0x0D,0x0B,0x19,0x13,0x00,0x8D,0x0C,0x24,0x22,0x04,0x0D,
+	0x0A,0x00,0x1A,0x0E,0x26,0x14,0x0E,0x00,0x19,0x01,0x15,0x83,0x04,0x00,0x08,0x07,
+	0x2C,0x00,0x81,0x16,0x15,0x02,0x0E,0x01,0x0D,0x81,0x07,0x12,0x13,0x0E,0x82,0x0D,
+	0x12,0x21,0x21,0x00,0x81,0x1E,0x15,0x0E,0x0E,0x81,0x0D,0x18,0x34,0x00,0x81,0x26,
+	0x08,0x13,0x0E,0x81,0x0D,0x20,0x25,0x00,0x89,0x1C,0x15,0x0E,0x13,0x25,0x21,0x0C,
+	0x27,0x02,0x12,0x10,0x0E,0x87,0x0D,0x13,0x18,0x1C,0x13,0x15,0x25,0x09,0x13,0x00,
+	0x85,0x26,0x0C,0x00,0x1A,0x15,0x18,0x01,0x00,0x8B,0x03,0x00,0x06,0x1A,0x00,0x1A,
+	0x0E,0x08,0x02,0x00,0x22,0x28,0x2C,0x00,0x81,0x1B,0x12,0x04,0x0E,0x80,0x0D,0x13,
+	0x0E,0x82,0x0D,0x08,0x02,0x23,0x00,0x81,0x18,0x0D,0x0C,0x0E,0x82,0x0D,0x13,0x02,
+	0x35,0x00,0x81,0x1A,0x15,0x12,0x0E,0x81,0x0D,0x0C,0x25,0x00,0x81,0x10,0x0B,0x01,
+	0x0E,0x85,0x13,0x24,0x0E,0x1A,0x1C,0x0D,0x12,0x0E,0x83,0x0D,0x15,0x0D,0x04,0x19,
+	0x00,0x81,0x1F,0x11,0x07,0x00,0x80,0x27,0x32,0x00,0x81,0x07,0x0D,0x18,0x0E,0x81,
+	0x0D,0x0C,0x24,0x00,0x81,0x10,0x0D,0x0C,0x0E,0x82,0x08,0x1E,0x0C,0x36,0x00,0x81,
+	0x1C,0x15,0x10,0x0E,0x81,0x0D,0x24,0x26,0x00,0x81,0x16,0x15,0x02,0x0E,0x01,0x0D,
+	0x81,0x07,0x12,0x13,0x0E,0x82,0x0D,0x12,0x21,0x58,0x00,0x81,0x1C,0x0D,0x17,0x0E,
+	0x81,0x0D,0x1C,0x25,0x00,0x81,0x0F,0x15,0x09,0x0E,0x85,0x13,0x24,0x19,0x04,0x1C,
+	0x23,0x36,0x00,0x81,0x11,0x13,0x10,0x0E,0x81,0x0B,0x06,0x26,0x00,0x81,0x1B,0x12,
+	0x04,0x0E,0x80,0x0D,0x13,0x0E,0x82,0x0D,0x08,0x02,0x59,0x00,0x81,0x10,0x0D,0x17,
+	0x0E,0x81,0x0D,0x10,0x25,0x00,0x81,0x28,0x0D,0x0C,0x0E,0x82,0x0D,0x0B,0x16,0x37,
+	0x00,0x81,0x1E,0x15,0x0E,0x0E,0x81,0x0D,0x18,0x28,0x00,0x81,0x07,0x0D,0x18,0x0E,
+	0x81,0x0D,0x0C,0x5A,0x00,0x81,0x0C,0x15,0x17,0x0E,0x81,0x0D,0x17,0x25,0x00,0x81,
+	0x1A,0x0D,0x0D,0x0E,0x81,0x0D,0x0C,0x38,0x00,0x81,0x18,0x0D,0x0C,0x0E,0x82,0x0D,
+	0x13,0x02,0x28,0x00,0x81,0x1C,0x0D,0x17,0x0E,0x81,0x0D,0x1C,0x5B,0x00,0x80,0x09,
+	0x17,0x0E,0x82,0x0D,0x08,0x26,0x25,0x00,0x81,0x10,0x0D,0x0D,0x0E,0x81,0x0D,0x1A,
+	0x38,0x00,0x81,0x10,0x0D,0x0C,0x0E,0x82,0x08,0x1E,0x0C,0x28,0x00,0x81,0x10,0x0D,
+	0x17,0x0E,0x81,0x0D,0x10,0x5C,0x00,0x81,0x24,0x0D,0x15,0x0E,0x81,0x0D,0x25,0x26,
+	0x00,0x81,0x19,0x15,0x0D,0x0E,0x81,0x0D,0x10,0x38,0x00,0x81,0x0F,0x15,0x09,0x0E,
+	0x85,0x13,0x24,0x19,0x04,0x1C,0x23,0x28,0x00,0x81,0x0C,0x15,0x17,0x0E,0x81,0x0D,
+	0x17,0x5C,0x00,0x81,0x1C,0x0D,0x15,0x0E,0x81,0x15,0x10,0x26,0x00,0x81,0x07,0x0D,
+	0x0D,0x0E,0x81,0x0D,0x20,0x38,0x00,0x81,0x28,0x0D,0x0C,0x0E,0x82,0x0D,0x0B,0x16,
+	0x28,0x00,0x80,0x09,0x17,0x0E,0x82,0x0D,0x08,0x26,0x5C,0x00,0x82,0x17,0x0E,0x0D,
+	0x15,0x0E,0x80,0x17,0x25,0x00,0x81,0x1B,0x13,0x0E,0x0E,0x81,0x0D,0x25,0x38,0x00,
+	0x81,0x1A,0x0D,0x0D,0x0E,0x81,0x0D,0x0C,0x29,0x00,0x81,0x24,0x0D,0x15,0x0E,0x81,
+	0x0D,0x25,0x5E,0x00,0x81,0x1D,0x0D,0x13,0x0E,0x81,0x0D,0x07,0x26,0x00,0x81,0x22,
+	0x0D,0x05,0x0E,0x80,0x12,0x01,0x0D,0x05,0x0E,0x81,0x0D,0x24,0x38,0x00,0x81,0x10,
+	0x0D,0x0D,0x0E,0x81,0x0D,0x1A,0x29,0x00,0x81,0x1C,0x0D,0x15,0x0E,0x81,0x15,0x10,
+	0x5E,0x00,0x81,0x26,0x08,0x13,0x0E,0x81,0x0D,0x20,0x26,0x00,0x81,0x10,0x0D,0x02,
+	0x0E,0x86,0x0D,0x12,0x0D,0x07,0x20,0x24,0x0D,0x04,0x0E,0x82,0x07,0x08,0x26,0x37,
+	0x00,0x81,0x19,0x15,0x0D,0x0E,0x81,0x0D,0x10,0x29,0x00,0x82,0x17,0x0E,0x0D,0x15,
+	0x0E,0x80,0x17,0x5F,0x00,0x81,0x1A,0x15,0x12,0x0E,0x81,0x0D,0x0C,0x26,0x00,0x81,
+	0x19,0x15,0x01,0x0E,0x88,0x0D,0x03,0x18,0x0E,0x15,0x07,0x05,0x18,0x0D,0x01,0x0E,
+	0x84,0x0D,0x25,0x19,0x13,0x27,0x37,0x00,0x81,0x07,0x0D,0x0D,0x0E,0x81,0x0D,0x20,
+	0x2A,0x00,0x81,0x1D,0x0D,0x13,0x0E,0x81,0x0D,0x07,0x61,0x00,0x81,0x1C,0x15,0x10,
+	0x0E,0x81,0x0D,0x24,0x27,0x00,0x80,0x24,0x01,0x0D,0x89,0x0E,0x0A,0x11,0x0A,0x15,
+	0x19,0x07,0x23,0x1A,0x15,0x02,0x0E,0x82,0x22,0x18,0x07,0x37,0x00,0x81,0x1B,0x13,
+	0x0E,0x0E,0x81,0x0D,0x25,0x2A,0x00,0x81,0x26,0x08,0x13,0x0E,0x81,0x0D,0x20,0x61,
+	0x00,0x81,0x11,0x13,0x10,0x0E,0x81,0x0B,0x06,0x26,0x00,0x8D,0x11,0x18,0x19,0x08,
+	0x0D,0x24,0x00,0x25,0x0E,0x1F,0x24,0x07,0x11,0x07,0x01,0x0D,0x83,0x18,0x00,0x08,
+	0x07,0x37,0x00,0x81,0x22,0x0D,0x05,0x0E,0x80,0x12,0x01,0x0D,0x05,0x0E,0x81,0x0D,
+	0x24,0x2B,0x00,0x81,0x1A,0x15,0x12,0x0E,0x81,0x0D,0x0C,0x62,0x00,0x81,0x1E,0x15,
+	0x0E,0x0E,0x81,0x0D,0x18,0x27,0x00,0x8D,0x0C,0x24,0x22,0x04,0x0D,0x0A,0x00,0x1A,
+	0x0E,0x26,0x14,0x0E,0x00,0x19,0x01,0x15,0x83,0x04,0x00,0x08,0x07,0x37,0x00,0x81,
+	0x10,0x0D,0x02,0x0E,0x86,0x0D,0x12,0x0D,0x07,0x20,0x24,0x0D,0x04,0x0E,0x82,0x07,
+	0x08,0x26,0x2B,0x00,0x81,0x1C,0x15,0x10,0x0E,0x81,0x0D,0x24,0x64,0x00,0x81,0x18,
+	0x0D,0x0C,0x0E,0x82,0x0D,0x13,0x02,0x27,0x00,0x85,0x26,0x0C,0x00,0x1A,0x15,0x18,
+	0x01,0x00,0x8B,0x03,0x00,0x06,0x1A,0x00,0x1A,0x0E,0x08,0x02,0x00,0x22,0x28,0x37,
+	0x00,0x81,0x19,0x15,0x01,0x0E,0x88,0x0D,0x03,0x18,0x0E,0x15,0x07,0x05,0x18,0x0D,
+	0x01,0x0E,0x84,0x0D,0x25,0x19,0x13,0x27,0x2B,0x00,0x81,0x11,0x13,0x10,0x0E,0x81,
+	0x0B,0x06,0x64,0x00,0x81,0x10,0x0D,0x0C,0x0E,0x82,0x08,0x1E,0x0C,0x2B,0x00,0x81,
+	0x1F,0x11,0x07,0x00,0x80,0x27,0x3C,0x00,0x80,0x24,0x01,0x0D,0x89,0x0E,0x0A,0x11,
+	0x0A,0x15,0x19,0x07,0x23,0x1A,0x15,0x02,0x0E,0x82,0x22,0x18,0x07,0x2D,0x00,0x81,
+	0x1E,0x15,0x0E,0x0E,0x81,0x0D,0x18,0x65,0x00,0x81,0x0F,0x15,0x09,0x0E,0x85,0x13,
+	0x24,0x19,0x04,0x1C,0x23,0x72,0x00,0x8D,0x11,0x18,0x19,0x08,0x0D,0x24,0x00,0x25,
+	0x0E,0x1F,0x24,0x07,0x11,0x07,0x01,0x0D,0x83,0x18,0x00,0x08,0x07,0x2E,0x00,0x81,
+	0x18,0x0D,0x0C,0x0E,0x82,0x0D,0x13,0x02,0x65,0x00,0x81,0x28,0x0D,0x0C,0x0E,0x82,
+	0x0D,0x0B,0x16,0x72,0x00,0x8D,0x0C,0x24,0x22,0x04,0x0D,0x0A,0x00,0x1A,0x0E,0x26,
+	0x14,0x0E,0x00,0x19,0x01,0x15,0x83,0x04,0x00,0x08,0x07,0x2E,0x00,0x81,0x10,0x0D,
+	0x0C,0x0E,0x82,0x08,0x1E,0x0C,0x65,0x00,0x81,0x1A,0x0D,0x0D,0x0E,0x81,0x0D,0x0C,
+	0x72,0x00,0x85,0x26,0x0C,0x00,0x1A,0x15,0x18,0x01,0x00,0x8B,0x03,0x00,0x06,0x1A,
+	0x00,0x1A,0x0E,0x08,0x02,0x00,0x22,0x28,0x2E,0x00,0x81,0x0F,0x15,0x09,0x0E,0x85,
+	0x13,0x24,0x19,0x04,0x1C,0x23,0x65,0x00,0x81,0x10,0x0D,0x0D,0x0E,0x81,0x0D,0x1A,
+	0x76,0x00,0x81,0x1F,0x11,0x07,0x00,0x80,0x27,0x33,0x00,0x81,0x28,0x0D,0x0C,0x0E,
+	0x82,0x0D,0x0B,0x16,0x65,0x00,0x81,0x19,0x15,0x0D,0x0E,0x81,0x0D,0x10,0x7F,0x00,
+	0x35,0x00,0x81,0x1A,0x0D,0x0D,0x0E,0x81,0x0D,0x0C,0x65,0x00,0x81,0x07,0x0D,0x0D,
+	0x0E,0x81,0x0D,0x20,0x7F,0x00,0x35,0x00,0x81,0x10,0x0D,0x0D,0x0E,0x81,0x0D,0x1A,
+	0x64,0x00,0x81,0x1B,0x13,0x0E,0x0E,0x81,0x0D,0x25,0x7F,0x00,0x35,0x00,0x81,0x19,
+	0x15,0x0D,0x0E,0x81,0x0D,0x10,0x64,0x00,0x81,0x22,0x0D,0x05,0x0E,0x80,0x12,0x01,
+	0x0D,0x05,0x0E,0x81,0x0D,0x24,0x7F,0x00,0x35,0x00,0x81,0x07,0x0D,0x0D,0x0E,0x81,
+	0x0D,0x20,0x64,0x00,0x81,0x10,0x0D,0x02,0x0E,0x86,0x0D,0x12,0x0D,0x07,0x20,0x24,
+	0x0D,0x04,0x0E,0x82,0x07,0x08,0x26,0x7F,0x00,0x33,0x00,0x81,0x1B,0x13,0x0E,0x0E,
+	0x81,0x0D,0x25,0x64,0x00,0x81,0x19,0x15,0x01,0x0E,0x88,0x0D,0x03,0x18,0x0E,0x15,
+	0x07,0x05,0x18,0x0D,0x01,0x0E,0x84,0x0D,0x25,0x19,0x13,0x27,0x7F,0x00,0x33,0x00,
+	0x81,0x22,0x0D,0x05,0x0E,0x80,0x12,0x01,0x0D,0x05,0x0E,0x81,0x0D,0x24,0x64,0x00,
+	0x80,0x24,0x01,0x0D,0x89,0x0E,0x0A,0x11,0x0A,0x15,0x19,0x07,0x23,0x1A,0x15,0x02,
+	0x0E,0x82,0x22,0x18,0x07,0x61,0x00,
+};
+const scr_image_t SCR_Title = { 320, 240, Title_palette, Title_data };
+
+/* GameOver: 320x240 from tools/screens/gameover.png */
+static const U16 GameOver_palette[34] = {
+	0x0000, 0x0861, 0x630C, 0x9492, 0x8C51, 0x83EF, 0x8430, 0x1061,
+	0x0800, 0x2800, 0x2104, 0x9CF3, 0x1082, 0x18E3, 0x5ACB, 0x2965,
+	0x52AA, 0x7BCF, 0x31A6, 0x738E, 0x4A69, 0x6B6D, 0x4228, 0x39E7,
+	0xB596, 0xFFFF, 0xF7BE, 0xAD75, 0xD6BA, 0xA514, 0xDF1B, 0xBDD7,
+	0xEF5D, 0xF800,
+};
+static const U8 GameOver_data[12796] = {
+	0x18,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,
+	0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,
+	0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,
+	0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,
+	0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,
+	0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,
+	0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,
+	0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,
+	0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,
+	0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,
+	0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,
+	0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,
+	0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,
+	0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,
+	0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,
+	0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,
+	0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,
+	0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x2B,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,
+	0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,
+	0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,
+	0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,
+	0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,
+	0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,
+	0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,
+	0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,
+	0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,
+	0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,
+	0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,
+	0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,
+	0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x2E,0x00,0x82,0x01,
+	0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,
+	0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,
+	0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,
+	0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,
+	0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,
+	0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,
+	0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,
+	0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,
+	0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,
+	0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,
+	0x82,0x0F,0x0B,0x01,0x2D,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,
+	0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,
+	0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,
+	0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,
+	0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,
+	0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,
+	0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,
+	0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,
+	0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,
+	0x2D,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,
+	0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,
+	0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,
+	0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,
+	0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,
+	0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,
+	0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,
+	0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,
+	0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,
+	0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,
+	0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x2D,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,
+	0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,
+	0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,
+	0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,
+	0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,
+	0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,
+	0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,
+	0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,
+	0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,
+	0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,
+	0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,
+	0x2D,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,
+	0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,
+	0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,
+	0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,
+	0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,
+	0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,
+	0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,
+	0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,
+	0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,
+	0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,
+	0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x2D,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,
+	0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,
+	0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,
+	0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,
+	0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,
+	0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,
+	0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,
+	0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,
+	0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,
+	0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,
+	0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,
+	0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,
+	0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,
+	0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,
+	0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,
+	0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,
+	0x16,0x13,0x0B,0x17,0x2E,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,
+	0x82,0x1A,0x0B,0x1B,0x2B,0x00,0x88,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,
+	0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,
+	0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,
+	0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,
+	0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,
+	0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,
+	0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,
+	0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,
+	0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,
+	0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,
+	0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,
+	0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,
+	0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,
+	0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,
+	0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,
+	0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,
+	0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,
+	0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,
+	0x1D,0x01,0x00,0x87,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x28,0x00,0x80,0x0F,
+	0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,
+	0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,
+	0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,
+	0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,
+	0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,
+	0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,
+	0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,
+	0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,
+	0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,
+	0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,
+	0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,
+	0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,
+	0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,
+	0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,
+	0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,
+	0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,
+	0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,
+	0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,
+	0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,
+	0x01,0x06,0x80,0x0F,0x27,0x00,0x83,0x03,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,
+	0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,
+	0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,
+	0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,
+	0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,
+	0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,
+	0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,
+	0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,
+	0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,
+	0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,
+	0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,
+	0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,
+	0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,
+	0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,
+	0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,
+	0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,
+	0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,
+	0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,
+	0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,
+	0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x88,0x0F,
+	0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x03,0x27,0x00,0x80,0x03,0x01,0x04,0x85,0x14,
+	0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,
+	0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,
+	0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,
+	0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,
+	0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,
+	0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,
+	0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,
+	0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,
+	0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,
+	0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,
+	0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,
+	0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,
+	0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,
+	0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,
+	0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,
+	0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,
+	0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,
+	0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,
+	0x20,0x15,0x0A,0x01,0x0B,0x88,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x03,0x28,
+	0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,
+	0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,
+	0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,
+	0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,
+	0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,
+	0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,
+	0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,
+	0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,
+	0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,
+	0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,
+	0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,
+	0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,
+	0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,
+	0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,
+	0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,
+	0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,
+	0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,
+	0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,
+	0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,
+	0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,
+	0x0C,0x2C,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,
+	0x0C,0x2F,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x2C,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,
+	0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,
+	0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,
+	0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,
+	0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,
+	0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,
+	0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,
+	0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,
+	0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,
+	0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,
+	0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,
+	0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,
+	0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,
+	0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,
+	0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,
+	0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,
+	0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,
+	0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,
+	0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x29,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,
+	0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,
+	0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,
+	0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,
+	0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,
+	0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,
+	0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,
+	0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,
+	0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,
+	0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,
+	0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,
+	0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,
+	0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,
+	0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,
+	0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,
+	0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,
+	0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,
+	0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,
+	0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x29,0x00,0x84,
+	0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,
+	0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,
+	0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,
+	0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,
+	0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,
+	0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,
+	0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,
+	0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,
+	0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,
+	0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,
+	0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,
+	0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,
+	0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,
+	0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,
+	0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,
+	0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,
+	0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,
+	0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,
+	0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,
+	0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,
+	0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x2A,0x00,0x82,
+	0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,
+	0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,
+	0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,
+	0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,
+	0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,
+	0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,
+	0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,
+	0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,
+	0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,
+	0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,
+	0x00,0x82,0x01,0x1D,0x06,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x2E,
+	0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,
+	0x08,0x80,0x09,0x7F,0x00,0x74,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,
+	0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x2B,0x00,0x83,0x0A,0x0B,0x02,0x0C,
+	0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x7F,0x00,0x77,0x00,0x83,0x0A,0x0B,0x02,0x0C,
+	0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x2E,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,
+	0x0F,0x0B,0x01,0x7F,0x00,0x75,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,
+	0x01,0x2D,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x4C,0x00,0x01,0x21,0x07,
+	0x00,0x01,0x21,0x22,0x00,0x08,0x21,0x07,0x00,0x0B,0x21,0x02,0x00,0x08,0x21,0x50,
+	0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x2D,0x00,0x82,0x11,0x02,0x0D,0x07,
+	0x00,0x82,0x0A,0x0E,0x11,0x4C,0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x22,0x00,0x0A,
+	0x21,0x05,0x00,0x0B,0x21,0x02,0x00,0x0A,0x21,0x4E,0x00,0x82,0x11,0x02,0x0D,0x07,
+	0x00,0x82,0x0A,0x0E,0x11,0x2D,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,
+	0x11,0x4C,0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x22,0x00,0x01,0x21,0x05,0x00,0x02,
+	0x21,0x05,0x00,0x01,0x21,0x0C,0x00,0x01,0x21,0x05,0x00,0x02,0x21,0x4E,0x00,0x82,
+	0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x2D,0x00,0x82,0x13,0x11,0x14,0x07,
+	0x00,0x82,0x0E,0x06,0x15,0x4C,0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x22,0x00,0x01,
+	0x21,0x07,0x00,0x01,0x21,0x04,0x00,0x01,0x21,0x0C,0x00,0x01,0x21,0x07,0x00,0x01,
+	0x21,0x4D,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x2D,0x00,0x83,
+	0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x4C,
+	0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x22,0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x04,
+	0x00,0x01,0x21,0x0C,0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x4D,0x00,0x83,0x14,0x0B,
+	0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x2E,0x00,0x81,
+	0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,0x1A,0x0B,0x1B,0x4D,0x00,0x01,
+	0x21,0x07,0x00,0x01,0x21,0x22,0x00,0x01,0x21,0x08,0x00,0x01,0x21,0x03,0x00,0x01,
+	0x21,0x0C,0x00,0x01,0x21,0x08,0x00,0x01,0x21,0x4D,0x00,0x81,0x18,0x03,0x02,0x19,
+	0x81,0x0D,0x0F,0x01,0x19,0x82,0x1A,0x0B,0x1B,0x2B,0x00,0x88,0x08,0x03,0x15,0x00,
+	0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x87,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,
+	0x4A,0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x22,0x00,0x01,0x21,0x08,0x00,0x01,0x21,
+	0x03,0x00,0x01,0x21,0x0C,0x00,0x01,0x21,0x08,0x00,0x01,0x21,0x49,0x00,0x88,0x08,
+	0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x87,0x18,0x19,0x1C,0x02,0x0E,
+	0x00,0x02,0x04,0x28,0x00,0x80,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,
+	0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x80,0x0F,0x49,0x00,0x01,
+	0x21,0x07,0x00,0x01,0x21,0x22,0x00,0x01,0x21,0x08,0x00,0x01,0x21,0x03,0x00,0x0A,
+	0x21,0x03,0x00,0x01,0x21,0x08,0x00,0x01,0x21,0x49,0x00,0x80,0x0F,0x01,0x06,0x85,
+	0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,
+	0x06,0x80,0x0F,0x27,0x00,0x83,0x03,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,
+	0x01,0x1E,0x88,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x03,0x49,0x00,0x01,0x21,
+	0x07,0x00,0x01,0x21,0x22,0x00,0x01,0x21,0x08,0x00,0x01,0x21,0x03,0x00,0x0A,0x21,
+	0x03,0x00,0x01,0x21,0x08,0x00,0x01,0x21,0x49,0x00,0x83,0x03,0x0F,0x0C,0x06,0x01,
+	0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x88,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,
+	0x03,0x27,0x00,0x80,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,
+	0x88,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x03,0x49,0x00,0x01,0x21,0x07,0x00,
+	0x01,0x21,0x22,0x00,0x01,0x21,0x08,0x00,0x01,0x21,0x03,0x00,0x01,0x21,0x0C,0x00,
+	0x01,0x21,0x08,0x00,0x01,0x21,0x49,0x00,0x80,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,
+	0x20,0x15,0x0A,0x01,0x0B,0x88,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x03,0x28,
+	0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,
+	0x1F,0x10,0x03,0x13,0x0D,0x0C,0x4A,0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x22,0x00,
+	0x01,0x21,0x08,0x00,0x01,0x21,0x03,0x00,0x01,0x21,0x0C,0x00,0x01,0x21,0x08,0x00,
+	0x01,0x21,0x4A,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,
+	0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x2C,0x00,0x84,0x0C,0x15,0x1F,0x1D,
+	0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,0x4D,0x00,0x01,0x21,0x07,0x00,0x01,
+	0x21,0x22,0x00,0x01,0x21,0x08,0x00,0x01,0x21,0x03,0x00,0x01,0x21,0x0C,0x00,0x01,
+	0x21,0x08,0x00,0x01,0x21,0x4D,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,
+	0x1B,0x1D,0x1F,0x13,0x0C,0x2F,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,
+	0x83,0x15,0x1B,0x06,0x0F,0x4D,0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x22,0x00,0x01,
+	0x21,0x07,0x00,0x01,0x21,0x04,0x00,0x01,0x21,0x0C,0x00,0x01,0x21,0x07,0x00,0x01,
+	0x21,0x4E,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,
+	0x0F,0x2C,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,
+	0x1B,0x12,0x06,0x03,0x04,0x0E,0x4A,0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x22,0x00,
+	0x01,0x21,0x07,0x00,0x01,0x21,0x04,0x00,0x01,0x21,0x0C,0x00,0x01,0x21,0x07,0x00,
+	0x01,0x21,0x4B,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,
+	0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x29,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,
+	0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x4B,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x23,0x00,0x01,0x21,0x05,0x00,0x02,0x21,0x05,0x00,0x01,0x21,
+	0x0C,0x00,0x01,0x21,0x05,0x00,0x02,0x21,0x4C,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,
+	0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x29,0x00,0x84,
+	0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,
+	0x0D,0x04,0x14,0x03,0x0C,0x4B,0x00,0x09,0x21,0x23,0x00,0x0A,0x21,0x05,0x00,0x0B,
+	0x21,0x02,0x00,0x0A,0x21,0x4C,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,
+	0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x2A,0x00,0x82,
+	0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x4E,0x00,0x05,0x21,0x25,0x00,0x08,
+	0x21,0x07,0x00,0x0B,0x21,0x02,0x00,0x08,0x21,0x4F,0x00,0x82,0x04,0x03,0x01,0x09,
+	0x00,0x82,0x01,0x1D,0x06,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x2E,
+	0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,
+	0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,
+	0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,
+	0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,
+	0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,
+	0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,
+	0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,
+	0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,
+	0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,
+	0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,
+	0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,
+	0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,
+	0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,
+	0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,
+	0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x04,
+	0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,0x07,0x01,0x00,0x01,
+	0x08,0x80,0x09,0x04,0x00,0x85,0x01,0x02,0x03,0x04,0x05,0x06,0x01,0x03,0x81,0x02,
+	0x07,0x01,0x00,0x01,0x08,0x80,0x09,0x2B,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,
+	0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,
+	0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,
+	0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,
+	0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,
+	0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,
+	0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,
+	0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,
+	0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,
+	0x0E,0x0B,0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,
+	0x0A,0x07,0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,
+	0x00,0x83,0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x07,0x00,0x83,
+	0x0A,0x0B,0x02,0x0C,0x03,0x00,0x83,0x0D,0x0E,0x0B,0x0A,0x2E,0x00,0x82,0x01,0x03,
+	0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,
+	0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,
+	0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,
+	0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,
+	0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,
+	0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,
+	0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,
+	0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,
+	0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,
+	0x0F,0x07,0x00,0x82,0x0F,0x0B,0x01,0x05,0x00,0x82,0x01,0x03,0x0F,0x07,0x00,0x82,
+	0x0F,0x0B,0x01,0x2D,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,
+	0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,
+	0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,
+	0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,
+	0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,
+	0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,
+	0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,
+	0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,
+	0x09,0x00,0x81,0x02,0x10,0x05,0x00,0x81,0x10,0x02,0x09,0x00,0x81,0x02,0x10,0x2D,
+	0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,
+	0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,
+	0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,
+	0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,
+	0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,
+	0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,
+	0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,
+	0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,
+	0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,
+	0x00,0x82,0x11,0x02,0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x05,0x00,0x82,0x11,0x02,
+	0x0D,0x07,0x00,0x82,0x0A,0x0E,0x11,0x2D,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,
+	0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,
+	0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,
+	0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,
+	0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,
+	0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,
+	0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,
+	0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,
+	0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,
+	0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,
+	0x12,0x04,0x11,0x05,0x00,0x82,0x11,0x03,0x0F,0x07,0x00,0x82,0x12,0x04,0x11,0x2D,
+	0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,
+	0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,
+	0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,
+	0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,
+	0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,
+	0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,
+	0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,
+	0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,
+	0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,
+	0x00,0x82,0x13,0x11,0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x05,0x00,0x82,0x13,0x11,
+	0x14,0x07,0x00,0x82,0x0E,0x06,0x15,0x2D,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,
+	0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,
+	0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,
+	0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,
+	0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,
+	0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,
+	0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,
+	0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,
+	0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,
+	0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,
+	0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,
+	0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,0x14,0x0B,
+	0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,0x00,0x83,
+	0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,0x17,0x05,
+	0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,0x13,0x0B,
+	0x17,0x05,0x00,0x83,0x14,0x0B,0x15,0x16,0x01,0x06,0x01,0x01,0x01,0x06,0x83,0x16,
+	0x13,0x0B,0x17,0x2E,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x07,0x00,0x81,0x18,0x03,0x02,0x19,0x81,0x0D,0x0F,0x01,0x19,0x82,
+	0x1A,0x0B,0x1B,0x2B,0x00,0x88,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,
+	0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,
+	0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,
+	0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,
+	0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,
+	0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,
+	0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,
+	0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,
+	0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,
+	0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,
+	0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,
+	0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,
+	0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,
+	0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,
+	0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,
+	0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,
+	0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,0x01,0x00,0x91,0x18,0x19,
+	0x1C,0x02,0x0E,0x00,0x02,0x04,0x00,0x08,0x03,0x15,0x00,0x02,0x10,0x1C,0x19,0x1D,
+	0x01,0x00,0x87,0x18,0x19,0x1C,0x02,0x0E,0x00,0x02,0x04,0x28,0x00,0x80,0x0F,0x01,
+	0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,
+	0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,
+	0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,
+	0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,
+	0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,
+	0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,
+	0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,
+	0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,
+	0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,
+	0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,
+	0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,
+	0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,
+	0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,
+	0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,
+	0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,
+	0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,
+	0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,0x17,0x02,0x12,0x16,0x03,0x0D,
+	0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,0x06,0x01,0x0F,0x01,0x06,0x85,
+	0x17,0x02,0x12,0x16,0x03,0x0D,0x01,0x03,0x85,0x0D,0x03,0x12,0x16,0x10,0x16,0x01,
+	0x06,0x80,0x0F,0x27,0x00,0x83,0x03,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,
+	0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,
+	0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,
+	0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,
+	0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,
+	0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,
+	0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,
+	0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,
+	0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,
+	0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,
+	0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,
+	0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,
+	0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,
+	0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,
+	0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,
+	0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,
+	0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,
+	0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,
+	0x82,0x0A,0x00,0x12,0x01,0x1E,0x87,0x0F,0x00,0x0A,0x1F,0x1B,0x05,0x01,0x12,0x01,
+	0x03,0x82,0x0F,0x0C,0x06,0x01,0x18,0x82,0x0A,0x00,0x12,0x01,0x1E,0x88,0x0F,0x00,
+	0x0A,0x1F,0x1B,0x05,0x01,0x12,0x03,0x27,0x00,0x80,0x03,0x01,0x04,0x85,0x14,0x12,
+	0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,
+	0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,
+	0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,
+	0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,
+	0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,
+	0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,
+	0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,
+	0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,
+	0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,
+	0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,
+	0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,
+	0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,
+	0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,
+	0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,
+	0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,
+	0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,
+	0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,0x15,0x0A,0x01,0x0B,0x87,0x0D,
+	0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x01,0x03,0x01,0x04,0x85,0x14,0x12,0x1D,0x20,
+	0x15,0x0A,0x01,0x0B,0x88,0x0D,0x11,0x1A,0x0B,0x17,0x14,0x03,0x04,0x03,0x28,0x00,
+	0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,
+	0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,
+	0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,
+	0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,
+	0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,
+	0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,
+	0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,
+	0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,
+	0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,
+	0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,
+	0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,
+	0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,
+	0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,
+	0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,
+	0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,
+	0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,
+	0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,
+	0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,
+	0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,0x01,0x00,0x84,0x0C,0x0D,0x13,0x03,
+	0x10,0x01,0x1F,0x80,0x17,0x01,0x0D,0x87,0x16,0x18,0x1F,0x10,0x03,0x13,0x0D,0x0C,
+	0x2C,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x07,0x00,0x84,0x0C,0x15,0x1F,0x1D,0x18,0x01,0x0B,0x84,0x1B,0x1D,0x1F,0x13,0x0C,
+	0x2F,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x07,0x00,0x85,0x17,0x04,0x1D,0x13,0x18,0x1B,0x01,0x18,0x83,0x15,0x1B,0x06,0x0F,
+	0x2C,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,
+	0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,
+	0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,
+	0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,
+	0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,
+	0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,
+	0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,
+	0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,
+	0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,
+	0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,
+	0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,
+	0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,
+	0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,
+	0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,
+	0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,
+	0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,0x0E,0x01,0x00,0x91,0x02,
+	0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,0x1B,0x12,0x06,0x03,0x04,
+	0x0E,0x01,0x00,0x91,0x02,0x04,0x03,0x11,0x12,0x1B,0x16,0x0A,0x17,0x16,0x0A,0x16,
+	0x1B,0x12,0x06,0x03,0x04,0x0E,0x29,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,
+	0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,
+	0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,
+	0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,
+	0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,
+	0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,
+	0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,
+	0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,
+	0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,
+	0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,
+	0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,
+	0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,
+	0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,
+	0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,
+	0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,
+	0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,
+	0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,0x03,0x15,0x17,0x12,0x15,
+	0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x01,0x00,0x91,0x0B,0x14,0x01,0x10,0x03,0x02,
+	0x03,0x15,0x17,0x12,0x15,0x03,0x02,0x03,0x14,0x0C,0x0E,0x04,0x29,0x00,0x84,0x0D,
+	0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,
+	0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,
+	0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,
+	0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,
+	0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,
+	0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,
+	0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,
+	0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,
+	0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,
+	0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,
+	0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,
+	0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,
+	0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,
+	0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,
+	0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,
+	0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,
+	0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,
+	0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,
+	0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,
+	0x04,0x14,0x03,0x0C,0x01,0x00,0x84,0x0D,0x04,0x10,0x06,0x0C,0x01,0x00,0x80,0x14,
+	0x01,0x13,0x80,0x14,0x01,0x00,0x84,0x0D,0x04,0x14,0x03,0x0C,0x2A,0x00,0x82,0x04,
+	0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,
+	0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,
+	0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,
+	0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,
+	0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,
+	0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,
+	0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,
+	0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,
+	0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,
+	0x03,0x01,0x09,0x00,0x82,0x01,0x1D,0x06,0x03,0x00,0x82,0x04,0x03,0x01,0x09,0x00,
+	0x82,0x01,0x1D,0x06,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x55,0x00,0x01,0x21,0x0B,0x00,0x01,0x21,
+	0x32,0x00,0x01,0x21,0x4C,0x00,0x01,0x21,0x11,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,
+	0x0D,0x00,0x01,0x21,0x22,0x00,0x01,0x21,0x53,0x00,0x01,0x21,0x09,0x00,0x01,0x21,
+	0x33,0x00,0x01,0x21,0x4C,0x00,0x01,0x21,0x11,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,
+	0x0D,0x00,0x01,0x21,0x22,0x00,0x01,0x21,0x54,0x00,0x01,0x21,0x07,0x00,0x01,0x21,
+	0x34,0x00,0x01,0x21,0x4C,0x00,0x01,0x21,0x21,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,
+	0x22,0x00,0x01,0x21,0x54,0x00,0x02,0x21,0x05,0x00,0x02,0x21,0x34,0x00,0x01,0x21,
+	0x4C,0x00,0x01,0x21,0x21,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x22,0x00,0x01,0x21,
+	0x55,0x00,0x02,0x21,0x04,0x00,0x01,0x21,0x35,0x00,0x01,0x21,0x4C,0x00,0x01,0x21,
+	0x21,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x22,0x00,0x01,0x21,0x56,0x00,0x01,0x21,
+	0x03,0x00,0x01,0x21,0x09,0x00,0x03,0x21,0x08,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x15,0x00,0x01,0x21,0x80,0x00,0x04,0x21,0x08,0x00,0x05,0x21,0x07,0x00,0x01,0x21,
+	0x06,0x00,0x01,0x21,0x08,0x00,0x03,0x21,0x17,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x09,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x0D,0x00,0x03,0x21,
+	0x0B,0x00,0x03,0x21,0x80,0x00,0x01,0x21,0x57,0x00,0x01,0x21,0x01,0x00,0x01,0x21,
+	0x08,0x00,0x07,0x21,0x06,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x15,0x00,0x08,0x21,
+	0x06,0x00,0x07,0x21,0x07,0x00,0x01,0x21,0x04,0x00,0x01,0x21,0x07,0x00,0x07,0x21,
+	0x15,0x00,0x01,0x21,0x04,0x00,0x01,0x21,0x0A,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,
+	0x0D,0x00,0x01,0x21,0x0B,0x00,0x07,0x21,0x07,0x00,0x08,0x21,0x57,0x00,0x05,0x21,
+	0x08,0x00,0x01,0x21,0x03,0x00,0x01,0x21,0x06,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x15,0x00,0x02,0x21,0x03,0x00,0x02,0x21,0x04,0x00,0x02,0x21,0x04,0x00,0x01,0x21,
+	0x06,0x00,0x01,0x21,0x04,0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x03,0x00,0x01,0x21,
+	0x15,0x00,0x01,0x21,0x03,0x00,0x01,0x21,0x0B,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,
+	0x0D,0x00,0x01,0x21,0x0B,0x00,0x01,0x21,0x03,0x00,0x01,0x21,0x07,0x00,0x01,0x21,
+	0x03,0x00,0x02,0x21,0x58,0x00,0x03,0x21,0x08,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x15,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x04,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x06,0x00,0x01,0x21,0x04,0x00,0x01,0x21,
+	0x06,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x14,0x00,0x01,0x21,0x02,0x00,0x01,0x21,
+	0x0C,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x0A,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x59,0x00,0x01,0x21,
+	0x09,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x15,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x0A,0x00,0x03,0x21,0x07,0x00,0x01,0x21,
+	0x02,0x00,0x01,0x21,0x07,0x00,0x09,0x21,0x14,0x00,0x01,0x21,0x01,0x00,0x01,0x21,
+	0x0D,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x0A,0x00,0x09,0x21,
+	0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x59,0x00,0x01,0x21,0x09,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x15,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x06,0x00,0x07,0x21,0x07,0x00,0x01,0x21,0x02,0x00,0x01,0x21,
+	0x07,0x00,0x09,0x21,0x14,0x00,0x01,0x21,0x80,0x00,0x01,0x21,0x0E,0x00,0x01,0x21,
+	0x0D,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x0A,0x00,0x09,0x21,0x05,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x59,0x00,0x01,0x21,0x09,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x15,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x05,0x00,0x04,0x21,0x01,0x00,0x01,0x21,0x07,0x00,0x01,0x21,0x02,0x00,0x01,0x21,
+	0x07,0x00,0x01,0x21,0x1C,0x00,0x05,0x21,0x0D,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,
+	0x0D,0x00,0x01,0x21,0x0A,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x59,0x00,0x01,0x21,0x09,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x15,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x04,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x08,0x00,0x01,0x21,0x80,0x00,0x01,0x21,0x08,0x00,0x01,0x21,
+	0x1C,0x00,0x02,0x21,0x01,0x00,0x01,0x21,0x0C,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,
+	0x0D,0x00,0x01,0x21,0x0A,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x59,0x00,0x01,0x21,0x09,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x15,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x04,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x08,0x00,0x01,0x21,0x80,0x00,0x01,0x21,0x08,0x00,0x02,0x21,
+	0x04,0x00,0x01,0x21,0x14,0x00,0x01,0x21,0x02,0x00,0x02,0x21,0x0B,0x00,0x01,0x21,
+	0x0D,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x0A,0x00,0x02,0x21,0x04,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x59,0x00,0x01,0x21,0x0A,0x00,0x01,0x21,
+	0x03,0x00,0x01,0x21,0x06,0x00,0x02,0x21,0x03,0x00,0x02,0x21,0x15,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x04,0x00,0x02,0x21,0x02,0x00,0x03,0x21,0x08,0x00,0x01,0x21,
+	0x80,0x00,0x01,0x21,0x09,0x00,0x01,0x21,0x03,0x00,0x02,0x21,0x14,0x00,0x01,0x21,
+	0x03,0x00,0x01,0x21,0x0B,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,
+	0x0B,0x00,0x01,0x21,0x03,0x00,0x02,0x21,0x06,0x00,0x01,0x21,0x03,0x00,0x02,0x21,
+	0x59,0x00,0x01,0x21,0x0A,0x00,0x07,0x21,0x07,0x00,0x08,0x21,0x15,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x05,0x00,0x08,0x21,0x09,0x00,0x02,0x21,0x0A,0x00,0x07,0x21,
+	0x15,0x00,0x01,0x21,0x04,0x00,0x01,0x21,0x0A,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,
+	0x0D,0x00,0x01,0x21,0x0B,0x00,0x07,0x21,0x07,0x00,0x08,0x21,0x59,0x00,0x01,0x21,
+	0x0C,0x00,0x03,0x21,0x0A,0x00,0x03,0x21,0x01,0x00,0x01,0x21,0x15,0x00,0x01,0x21,
+	0x05,0x00,0x01,0x21,0x06,0x00,0x03,0x21,0x02,0x00,0x01,0x21,0x08,0x00,0x02,0x21,
+	0x0C,0x00,0x04,0x21,0x16,0x00,0x01,0x21,0x05,0x00,0x01,0x21,0x09,0x00,0x01,0x21,
+	0x0D,0x00,0x01,0x21,0x0D,0x00,0x01,0x21,0x0D,0x00,0x04,0x21,0x0A,0x00,0x03,0x21,
+	0x80,0x00,0x01,0x21,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,
+	0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x7F,0x00,0x52,0x00,
+};
+const scr_image_t SCR_GameOver = { 320, 240, GameOver_palette, GameOver_data };
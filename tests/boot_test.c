@@ -0,0 +1,120 @@
+/*----------------------------------------------------------------------------
+ * Name:    boot_test.c
+ * Purpose: host model of the boot time to the first frame
+ * Note(s): main() starts the LCD init, does the rest of the setup while the
+ *          controller waits for its power up steps, finishes the init and
+ *          draws the title screen. Here the same calls run on the real
+ *          driver and lcd_model.c, whose clock advances with every SPI byte
+ *          and TIMER0 poll; the rest of the setup is a wait of a given
+ *          length. The gaps between the register writes must hold the
+ *          minimum waits of the init tables. main() does the setup in one
+ *          piece after GLCD_InitStart, so it can only hide in the first
+ *          wait; the later ones follow it.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include "RTL.h"
+#include "GLCD.h"
+#include "TIMER0.h"
+#include "screen.h"
+#include "lcd_model.h"
+
+#define GAPS        8
+
+typedef struct {
+	const char *name;
+	int   kind;
+	U16   id;
+	int   n_waits;
+	U32   waits[GAPS];                    /* Non zero waits of the init tables, ms */
+} CONTROLLER;
+
+static const CONTROLLER controllers[] = {
+	{ "ili",   LCD_ILI,   0x9325, 4, { 200, 50, 50, 50 } },
+	{ "himax", LCD_HIMAX, 0x0047, 5, { 200, 50, 50, 50, 200 } },
+};
+
+static U32 last_write, last_regs;
+static U32 gaps[GAPS];
+static int n_gaps;
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/* The driver's SSP, built with -DGLCD_SSP=test_ssp: note gaps over 1 ms   */
+/* between register writes                                                   */
+unsigned char test_ssp (unsigned char byte) {
+	unsigned char in = LCD_Ssp(byte);
+
+	if (LCD_Count.reg_writes != last_regs) {
+		if (LCD_Now() - last_write > 1000 && last_regs != 0 && n_gaps < GAPS)
+			gaps[n_gaps++] = LCD_Now() - last_write;
+		last_regs = LCD_Count.reg_writes;
+		last_write = LCD_Now();
+	}
+	return in;
+}
+
+/*----------------------------------------------------------------------------
+  Boot with 'setup' us of other work in the LCD waits, as main() does.
+  Returns the time to the first frame, *ready the time to the end of init.
+ *----------------------------------------------------------------------------*/
+static U32 boot (const CONTROLLER *c, U32 setup, U32 *ready) {
+	U32 t0;
+	int i;
+
+	LCD_Reset(c->kind, c->id);
+	last_regs = 0;
+	n_gaps = 0;
+	t0 = LCD_Now();
+
+	TIMER0_Init();
+	GLCD_InitStart();
+	TIMER0_Wait(setup);
+	while (GLCD_InitStep());
+	*ready = LCD_Now() - t0;
+
+	//The writes the setup delayed are late, never early
+	CHECK(n_gaps == c->n_waits);
+	for (i = 0; i < n_gaps && i < c->n_waits; i++)
+		CHECK(gaps[i] >= c->waits[i] * 1000);
+
+	SCR_Draw(&SCR_Title, 0, 0);
+	CHECK(LCD_Count.errors == 0);
+	return LCD_Now() - t0;
+}
+
+int main (void) {
+	static const U32 setups[] = { 0, 100000, 300000, 600000 };
+	const CONTROLLER *c;
+	U32 floor_ms, ready, ready0, frame, frame0, draw;
+	int k, i;
+
+	for (k = 0; k < (int)(sizeof(controllers) / sizeof(controllers[0])); k++) {
+		c = &controllers[k];
+		for (i = 0, floor_ms = 0; i < c->n_waits; i++)
+			floor_ms += c->waits[i];
+
+		frame0 = boot(c, 0, &ready0);
+		draw = frame0 - ready0;
+		//The waits are the floor, the writes themselves are cheap
+		CHECK(ready0 >= floor_ms * 1000 && ready0 < floor_ms * 1000 + 5000);
+		printf("boot: %-5s init %u.%03u ms (waits %u ms), title %u.%03u ms\n", c->name,
+			ready0 / 1000, ready0 % 1000, floor_ms, draw / 1000, draw % 1000);
+
+		for (i = 0; i < (int)(sizeof(setups) / sizeof(setups[0])); i++) {
+			frame = boot(c, setups[i], &ready);
+			//Setup shorter than the first wait hides in it
+			if (setups[i] + 5000 < c->waits[0] * 1000)
+				CHECK(ready <= ready0 + 1000);
+			CHECK(ready >= setups[i]);
+			printf("boot: %-5s setup %3u ms: first frame at %u ms, %u ms one after the other\n", c->name,
+				setups[i] / 1000, frame / 1000, (setups[i] + frame0) / 1000);
+		}
+	}
+
+	printf("boot_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
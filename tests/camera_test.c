@@ -0,0 +1,230 @@
+/*----------------------------------------------------------------------------
+ * Name:    camera_test.c
+ * Purpose: host check of the GRAM ring seam splitting in camera.c
+ * Note(s): The GLCD calls camera.c makes are replaced by a GRAM in RAM
+ *          that clips like the driver, counts every pixel written and keeps
+ *          the scroll offset. The screen shows GRAM column (scroll + x) %
+ *          CAM_VIEW_W at x, so every visible pixel of a sprite must land
+ *          there exactly once, wherever the seam cuts it. Circles go
+ *          through the real draw.c and are compared with the same circle
+ *          drawn unclipped in world coordinates.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#include "RTL.h"
+#include "GLCD.h"
+#include "draw.h"
+#include "camera.h"
+
+#define MAX_W  64
+#define MAX_H  24
+#define MARGIN 64                       /* World raster room off both ends    */
+
+static unsigned short gram[CAM_VIEW_H][CAM_VIEW_W];
+static U8 hits[CAM_VIEW_H][CAM_VIEW_W];
+static int clip[4] = { 0, 0, CAM_VIEW_W, CAM_VIEW_H };
+static unsigned int scroll;
+static U32 writes;
+static U8 world_px[CAM_VIEW_H][CAM_WORLD_W + 2 * MARGIN];
+static int to_world;                    /* GLCD_Fill draws the reference      */
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*----------------------------------------------------------------------------
+  Stand-ins for the driver
+ *----------------------------------------------------------------------------*/
+void GLCD_ScrollTo (unsigned int line) {
+	scroll = line;
+}
+
+void GLCD_SetClip (int x, int y, int w, int h) {
+	clip[0] = (x > 0) ? x : 0;
+	clip[1] = (y > 0) ? y : 0;
+	clip[2] = (x + w < CAM_VIEW_W) ? x + w : CAM_VIEW_W;
+	clip[3] = (y + h < CAM_VIEW_H) ? y + h : CAM_VIEW_H;
+}
+
+void GLCD_ClipMax (void) {
+	GLCD_SetClip(0, 0, CAM_VIEW_W, CAM_VIEW_H);
+}
+
+/* Every alpha writes the source pixel, the check is where it goes           */
+void GLCD_Blend (int x, int y, unsigned int w, unsigned int h, unsigned char *bitmap, unsigned int alpha) {
+	const unsigned short *src = (const unsigned short *)bitmap;
+	int r, c;
+
+	(void)alpha;
+	for (r = y; r < y + (int)h; r++)
+		for (c = x; c < x + (int)w; c++) {
+			if (c < clip[0] || c >= clip[2] || r < clip[1] || r >= clip[3])
+				continue;
+			//Rows are stored bottom up
+			gram[r][c] = src[(y + (int)h - 1 - r) * (int)w + (c - x)];
+			hits[r][c]++;
+			writes++;
+		}
+}
+
+void GLCD_Fill (int x, int y, int w, int h, unsigned short color) {
+	int r, c;
+
+	(void)color;
+	for (r = y; r < y + h; r++)
+		for (c = x; c < x + w; c++) {
+			if (to_world) {
+				if (r >= 0 && r < CAM_VIEW_H && c >= -MARGIN && c < CAM_WORLD_W + MARGIN)
+					world_px[r][c + MARGIN] = 1;
+				continue;
+			}
+			if (c < clip[0] || c >= clip[2] || r < clip[1] || r >= clip[3])
+				continue;
+			gram[r][c] = color;
+			hits[r][c]++;
+			writes++;
+		}
+}
+
+/*----------------------------------------------------------------------------
+  Sprite pixel at column c, row r: never 0, unique within the sprite
+ *----------------------------------------------------------------------------*/
+static unsigned short pixel (int c, int r) {
+	return (unsigned short)((c << 8 | r) + 1);
+}
+
+/*----------------------------------------------------------------------------
+  Draw a w x h sprite at world (x, y) and compare the screen with it
+ *----------------------------------------------------------------------------*/
+static int check_sprite (int x, int y, int w, int h) {
+	static unsigned short bitmap[MAX_W * MAX_H];
+	int r, c, sx, gx, wx, expect = 0, bad = 0;
+
+	for (r = 0; r < h; r++)
+		for (c = 0; c < w; c++)
+			bitmap[(h - 1 - r) * w + c] = pixel(c, r);
+
+	memset(gram, 0, sizeof(gram));
+	memset(hits, 0, sizeof(hits));
+	writes = 0;
+	CAM_Blend(x, y, w, h, bitmap, GLCD_ALPHA_MAX / 2);
+
+	for (r = 0; r < CAM_VIEW_H; r++)
+		for (sx = 0; sx < CAM_VIEW_W; sx++) {
+			gx = (scroll + sx) % CAM_VIEW_W;
+			wx = CAM_Get() + sx;
+			if (wx >= x && wx < x + w && r >= y && r < y + h) {
+				expect++;
+				if (hits[r][gx] != 1 || gram[r][gx] != pixel(wx - x, r - y))
+					bad++;
+			} else if (hits[r][gx] != 0) {
+				bad++;
+			}
+		}
+	if (writes != (U32)expect)
+		bad++;
+	return bad;
+}
+
+/*----------------------------------------------------------------------------
+  Draw a circle of radius r around world (x, y) and compare the screen with
+  the world reference
+ *----------------------------------------------------------------------------*/
+static int check_circle (int x, int y, int r) {
+	int row, sx, gx, wx, bad = 0;
+
+	memset(world_px, 0, sizeof(world_px));
+	to_world = 1;
+	DRAW_Circle(x, y, r, 1);
+	to_world = 0;
+
+	memset(hits, 0, sizeof(hits));
+	CAM_Circle(x, y, r, 1);
+
+	for (row = 0; row < CAM_VIEW_H; row++)
+		for (sx = 0; sx < CAM_VIEW_W; sx++) {
+			gx = (scroll + sx) % CAM_VIEW_W;
+			wx = CAM_Get() + sx;
+			if ((hits[row][gx] != 0) != (world_px[row][wx + MARGIN] != 0))
+				bad++;
+		}
+	return bad;
+}
+
+/*----------------------------------------------------------------------------
+  CAM_Gram and the scroll offset agree on where world columns show
+ *----------------------------------------------------------------------------*/
+static void test_gram (void) {
+	int cam, x, strip_x, strip_w, bad = 0;
+
+	for (cam = 0; cam <= CAM_WORLD_W - CAM_VIEW_W; cam++) {
+		CAM_Init(1);
+		CAM_Move(cam, &strip_x, &strip_w);
+		for (x = cam; x < cam + CAM_VIEW_W; x++)
+			if ((CAM_Gram(x) + CAM_VIEW_W - (int)scroll) % CAM_VIEW_W != x - cam)
+				bad++;
+	}
+	CHECK(bad == 0);
+}
+
+/*----------------------------------------------------------------------------
+  Sprites at every offset around the view edges and the seam
+ *----------------------------------------------------------------------------*/
+static void test_seam (void) {
+	static const int cams[] = { 0, 1, 16, 150, 300, 304, 319, CAM_WORLD_W - CAM_VIEW_W };
+	static const int widths[] = { 1, 20, MAX_W };
+	int i, k, x, seam, strip_x, strip_w, bad = 0, cases = 0;
+
+	for (i = 0; i < (int)(sizeof(cams) / sizeof(cams[0])); i++) {
+		CAM_Init(1);
+		CAM_Move(cams[i], &strip_x, &strip_w);
+		seam = CAM_Get() + (CAM_VIEW_W - (int)scroll) % CAM_VIEW_W;
+		for (k = 0; k < (int)(sizeof(widths) / sizeof(widths[0])); k++) {
+			//Both view edges
+			for (x = CAM_Get() - MAX_W - 2; x <= CAM_Get() + 2; x++, cases++)
+				bad += check_sprite(x, 100, widths[k], 4);
+			for (x = CAM_Get() + CAM_VIEW_W - MAX_W - 2; x <= CAM_Get() + CAM_VIEW_W + 2; x++, cases++)
+				bad += check_sprite(x, 100, widths[k], 4);
+			//Across the GRAM seam, clipped at the top and bottom too
+			for (x = seam - MAX_W - 2; x <= seam + 2; x++, cases += 2) {
+				bad += check_sprite(x, -3, widths[k], MAX_H);
+				bad += check_sprite(x, CAM_VIEW_H - 5, widths[k], MAX_H);
+			}
+		}
+	}
+	CHECK(bad == 0);
+	printf("seam: %d sprites checked\n", cases);
+}
+
+/*----------------------------------------------------------------------------
+  Rings around the view edges and across the seam, as the bomb radius
+ *----------------------------------------------------------------------------*/
+static void test_circle (void) {
+	static const int cams[] = { 0, 7, 160, 313, CAM_WORLD_W - CAM_VIEW_W };
+	int i, x, seam, strip_x, strip_w, bad = 0, cases = 0;
+
+	for (i = 0; i < (int)(sizeof(cams) / sizeof(cams[0])); i++) {
+		CAM_Init(1);
+		CAM_Move(cams[i], &strip_x, &strip_w);
+		seam = CAM_Get() + (CAM_VIEW_W - (int)scroll) % CAM_VIEW_W;
+		for (x = seam - 55; x <= seam + 55; x += 3, cases++)
+			bad += check_circle(x, 120, 50);
+		for (x = CAM_Get() - 55; x <= CAM_Get() + 55; x += 5, cases++)
+			bad += check_circle(x, 30, 50);
+		for (x = CAM_Get() + CAM_VIEW_W - 55; x <= CAM_Get() + CAM_VIEW_W + 55; x += 5, cases++)
+			bad += check_circle(x, 220, 50);
+	}
+	CHECK(bad == 0);
+	printf("seam: %d circles checked\n", cases);
+}
+
+int main (void) {
+	test_gram();
+	test_seam();
+	test_circle();
+
+	printf("camera_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
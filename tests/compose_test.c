@@ -0,0 +1,200 @@
+/*----------------------------------------------------------------------------
+ * Name:    compose_test.c
+ * Purpose: host benchmark of compose.c against drawing straight to GRAM
+ * Note(s): The same scripted scene, a horde chasing the human across the
+ *          world with the camera following, is played twice on the real
+ *          driver and lcd_model.c: once through the compositor, as
+ *          base_task does with USE_BACKBUFFER, and once the way the tasks
+ *          draw without it, restoring the tiles under every sprite and
+ *          blitting it again. Every frame of the compositor run is compared
+ *          with the scene drawn in RAM, and the SPI bytes of both runs are
+ *          counted by the model.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#include "RTL.h"
+#include "GLCD.h"
+#include "camera.h"
+#include "tilemap.h"
+#include "compose.h"
+#include "lcd_model.h"
+
+#define FRAMES      400
+#define ZOMBIES     15                  /* MAX_ZOMBIES in Blinky.c            */
+#define PICKUPS     4
+#define ITEMS       (ZOMBIES * 3 + 2 + PICKUPS)
+
+typedef struct {
+	int x, y, w, h;
+	const unsigned short *bitmap;
+} item_t;
+
+/* Sprites of the sizes Blinky.c uses, every pixel different                  */
+static unsigned short body[10 * 10], arm[5 * 5], human[10 * 10], gun[5 * 5], pickup[7 * 7];
+
+static int zx[ZOMBIES], zy[ZOMBIES];
+static unsigned short view[LCD_H][LCD_W];
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static void sprite (unsigned short *bitmap, int n, int seed) {
+	int i;
+
+	for (i = 0; i < n; i++)
+		bitmap[i] = (unsigned short)(seed + i * 97);
+}
+
+/*----------------------------------------------------------------------------
+  Display list of frame f, drawn in this order: pickups, zombies (body and
+  two arms), the human and the gun
+ *----------------------------------------------------------------------------*/
+static void add (item_t *it, int *n, int x, int y, int w, int h, const unsigned short *bitmap) {
+	it[*n].x = x;  it[*n].y = y;  it[*n].w = w;  it[*n].h = h;
+	it[*n].bitmap = bitmap;
+	(*n)++;
+}
+
+static int scene (int f, item_t *it) {
+	int i, n = 0, hx, hy, swing;
+
+	//Back and forth over the world, 4 pixels a frame
+	hx = (f * 4) % 1160;
+	hx = 20 + (hx < 580 ? hx : 1160 - hx);
+	hy = 100 + (f / 3) % 40;
+
+	for (i = 0; i < PICKUPS; i++)
+		add(it, &n, 60 + i * 150, 30 + i * 50, 7, 7, pickup);
+
+	for (i = 0; i < ZOMBIES; i++) {
+		if (f == 0) {
+			zx[i] = 30 + i * 40;
+			zy[i] = 10 + (i * 53) % 200;
+		}
+		else {
+			zx[i] += (zx[i] < hx) - (zx[i] > hx);
+			zy[i] += (zy[i] < hy) - (zy[i] > hy);
+		}
+		swing = (f / 4 + i) % 2 * 5;
+		add(it, &n, zx[i] + 5, zy[i] + 5, 10, 10, body);
+		add(it, &n, zx[i], zy[i] + swing, 5, 5, arm);
+		add(it, &n, zx[i] + 15, zy[i] + 10 - swing, 5, 5, arm);
+	}
+
+	add(it, &n, hx, hy, 10, 10, human);
+	add(it, &n, hx + 10, hy + 3, 5, 5, gun);
+	return n;
+}
+
+/*----------------------------------------------------------------------------
+  The view drawn in RAM: background tiles, then the list in order. The
+  GRAM must show it at the columns the camera maps it to.
+ *----------------------------------------------------------------------------*/
+static int screen_ok (const item_t *it, int n) {
+	int cam = CAM_Get();
+	int k, x, y, r, c;
+
+	for (y = 0; y < LCD_H; y++)
+		TM_Row(cam, y, LCD_W, view[y]);
+	for (k = 0; k < n; k++)
+		for (r = 0; r < it[k].h; r++)
+			for (c = 0; c < it[k].w; c++) {
+				x = it[k].x + c - cam;
+				y = it[k].y + r;
+				if (x >= 0 && x < LCD_W && y >= 0 && y < LCD_H)
+					view[y][x] = it[k].bitmap[(it[k].h - 1 - r) * it[k].w + c];
+			}
+	for (y = 0; y < LCD_H; y++)
+		for (x = 0; x < LCD_W; x++)
+			if (LCD_Gram[y][CAM_Gram(cam + x)] != view[y][x])
+				return 0;
+	return 1;
+}
+
+/*----------------------------------------------------------------------------
+  Boot the model and show the level, as the menu leaves the playfield
+ *----------------------------------------------------------------------------*/
+static void start (int step) {
+	LCD_Reset(LCD_ILI, 0x9325);
+	GLCD_Init();
+	GLCD_ClipMax();
+	CAM_Init(step);
+	TM_Init();
+	TM_DrawAll();
+}
+
+static int follow (const item_t *it, int n, int *strip_x, int *strip_w) {
+	//The human is the second to last entry
+	return CAM_Move(CAM_Target(it[n - 2].x + 10 / 2), strip_x, strip_w);
+}
+
+int main (void) {
+	static item_t it[ITEMS], old[ITEMS];
+	int f, k, n = 0, n_old, strip_x, strip_w, bad = 0;
+	U32 bytes, cmp_total = 0, cmp_max = 0, dir_total = 0, dir_max = 0;
+	U32 estimate;
+
+	sprite(body, 100, 0x1000);
+	sprite(arm, 25, 0x2000);
+	sprite(human, 100, 0x3000);
+	sprite(gun, 25, 0x4000);
+	sprite(pickup, 49, 0x5000);
+
+	//Compositor, the camera moves by whole tiles
+	start(CMP_TILE);
+	CMP_Init(0x8C71);
+	CMP_Background(TM_Row);
+	for (f = 0; f < FRAMES; f++) {
+		n = scene(f, it);
+		bytes = LCD_Count.bytes;
+		follow(it, n, &strip_x, &strip_w);
+		CMP_Begin();
+		for (k = 0; k < n; k++)
+			CMP_Bitmap(it[k].x, it[k].y, it[k].w, it[k].h, it[k].bitmap);
+		CMP_Flush();
+		bytes = LCD_Count.bytes - bytes;
+		cmp_total += bytes;
+		if (bytes > cmp_max) cmp_max = bytes;
+		bad += !screen_ok(it, n);
+	}
+	CHECK(bad == 0);
+	CHECK(CMP_Stats()->frames == FRAMES && CMP_Stats()->dropped == 0);
+	//The camera scroll writes are not the compositor's
+	CHECK(CMP_Stats()->bytes <= cmp_total);
+	CHECK(LCD_Count.errors == 0);
+	estimate = CMP_Stats()->direct_bytes / FRAMES;
+
+	//Direct, as the tasks draw: restore the tiles under the old sprites
+	//(all moved before any is drawn), then blit the new ones
+	start(1);
+	n_old = 0;
+	for (f = 0; f < FRAMES; f++) {
+		n = scene(f, it);
+		bytes = LCD_Count.bytes;
+		if (follow(it, n, &strip_x, &strip_w) != 0)
+			TM_Restore(strip_x, 0, strip_w, CAM_VIEW_H);
+		for (k = 0; k < n_old; k++)
+			TM_Restore(old[k].x, old[k].y, old[k].w, old[k].h);
+		for (k = 0; k < n; k++)
+			CAM_Bitmap(it[k].x, it[k].y, it[k].w, it[k].h, it[k].bitmap);
+		bytes = LCD_Count.bytes - bytes;
+		dir_total += bytes;
+		if (bytes > dir_max) dir_max = bytes;
+		memcpy(old, it, sizeof(it));
+		n_old = n;
+	}
+	CHECK(screen_ok(it, n));
+	CHECK(LCD_Count.errors == 0);
+
+	printf("compose: %d frames of %d sprites, bytes/frame (max)\n", FRAMES, ITEMS);
+	printf("compose: tiled  %6u (%6u), %u tiles/frame\n", cmp_total / FRAMES, cmp_max, CMP_Stats()->tiles / FRAMES);
+	printf("compose: direct %6u (%6u), erases included\n", dir_total / FRAMES, dir_max);
+	printf("compose: CMP_Report estimate %u without erases\n", estimate);
+	CHECK(cmp_total < dir_total);
+
+	printf("compose_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
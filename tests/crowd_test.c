@@ -0,0 +1,192 @@
+/*----------------------------------------------------------------------------
+ * Name:    crowd_test.c
+ * Purpose: host test and benchmark of the crowd grid
+ * Note(s): Built with CROWD_MAX_AGENTS raised to BENCH_AGENTS, so the grid
+ *          is checked and timed at a horde far beyond MAX_ZOMBIES. Queries
+ *          and separation are compared with a scan of every pair.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "RTL.h"
+#include "crowd.h"
+
+#define BENCH_AGENTS CROWD_MAX_AGENTS
+#define BENCH_FRAMES 200
+#define RADIUS       20                 /* Zombie sprite width                */
+
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static S16 ax[BENCH_AGENTS], ay[BENCH_AGENTS];
+
+static double now_ns (void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void scatter (int n, unsigned seed) {
+	int i;
+
+	srand(seed);
+	for (i = 0; i < n; i++) {
+		ax[i] = rand() % CAM_WORLD_W;
+		ay[i] = rand() % CAM_WORLD_H;
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Separation of every agent against every other one, clamped like the grid
+ *----------------------------------------------------------------------------*/
+static void separate_all (int n, int radius, const U8 *limit, S8 *push_x, S8 *push_y) {
+	int r2 = radius * radius;
+	int s, t, dx, dy, d2, max_push;
+	S32 fx, fy;
+
+	for (s = 0; s < n; s++) {
+		fx = fy = 0;
+		for (t = 0; t < n; t++) {
+			dx = ax[s] - ax[t];
+			dy = ay[s] - ay[t];
+			d2 = dx * dx + dy * dy;
+			if (t == s || d2 >= r2 || d2 == 0)
+				continue;
+			fx += dx * (r2 - d2);
+			fy += dy * (r2 - d2);
+		}
+		fx /= r2;
+		fy /= r2;
+		max_push = limit ? limit[s] : CROWD_MIN_PUSH;
+		push_x[s] = (S8)(fx > max_push ? max_push : fx < -max_push ? -max_push : fx);
+		push_y[s] = (S8)(fy > max_push ? max_push : fy < -max_push ? -max_push : fy);
+	}
+}
+
+/*----------------------------------------------------------------------------
+  TRUE if another agent sits exactly on agent i. The grid splits such a pair
+  by sorted slot order, which the pair scan does not know.
+ *----------------------------------------------------------------------------*/
+static int stacked (int i, int n) {
+	int t;
+
+	for (t = 0; t < n; t++)
+		if (t != i && ax[t] == ax[i] && ay[t] == ay[i])
+			return 1;
+	return 0;
+}
+
+/*----------------------------------------------------------------------------
+  Radius queries find exactly the agents a full scan finds
+ *----------------------------------------------------------------------------*/
+static void test_query (void) {
+	static crowd_id_t found[BENCH_AGENTS];
+	static U8 hit[BENCH_AGENTS];
+	static const int radii[] = { 5, RADIUS, 32, 50, 90 };
+	int q, r, i, n, expect, bad = 0;
+	int x, y, dx, dy;
+
+	scatter(BENCH_AGENTS, 2);
+	CROWD_Build(ax, ay, BENCH_AGENTS);
+
+	for (q = 0; q < 200; q++) {
+		x = rand() % CAM_WORLD_W;
+		y = rand() % CAM_WORLD_H;
+		for (r = 0; r < (int)(sizeof(radii) / sizeof(radii[0])); r++) {
+			n = CROWD_Query(x, y, radii[r], found, BENCH_AGENTS);
+			memset(hit, 0, sizeof(hit));
+			for (i = 0; i < n; i++)
+				hit[found[i]]++;
+			expect = 0;
+			for (i = 0; i < BENCH_AGENTS; i++) {
+				dx = ax[i] - x;
+				dy = ay[i] - y;
+				if (dx * dx + dy * dy < radii[r] * radii[r]) {
+					expect++;
+					if (hit[i] != 1)
+						bad++;
+				}
+			}
+			if (n != expect)
+				bad++;
+		}
+	}
+	CHECK(bad == 0);
+}
+
+/*----------------------------------------------------------------------------
+  The grid pass matches the pair scan, and fast agents get larger steps
+ *----------------------------------------------------------------------------*/
+static void test_separate (void) {
+	static S8 px[BENCH_AGENTS], py[BENCH_AGENTS], ex[BENCH_AGENTS], ey[BENCH_AGENTS];
+	static U8 limit[BENCH_AGENTS];
+	int i, bad = 0, beyond = 0;
+
+	scatter(BENCH_AGENTS, 3);
+	for (i = 0; i < BENCH_AGENTS; i++)
+		ay[i] = ay[i] / 4 + 100;              /* Packed, so most agents overlap    */
+	for (i = 0; i < BENCH_AGENTS; i++)
+		limit[i] = (i % 2) ? 8 : CROWD_MIN_PUSH;
+
+	CROWD_Build(ax, ay, BENCH_AGENTS);
+	CROWD_Separate(RADIUS, limit, px, py);
+	separate_all(BENCH_AGENTS, RADIUS, limit, ex, ey);
+	for (i = 0; i < BENCH_AGENTS; i++) {
+		if ((px[i] != ex[i] || py[i] != ey[i]) && !stacked(i, BENCH_AGENTS))
+			bad++;
+		if (abs(px[i]) > limit[i] || abs(py[i]) > limit[i])
+			bad++;
+		if (abs(px[i]) > CROWD_MIN_PUSH || abs(py[i]) > CROWD_MIN_PUSH)
+			beyond++;
+	}
+	CHECK(bad == 0);
+	CHECK(beyond > 0);
+
+	//Two agents on the same spot are split apart along x
+	ax[0] = ax[1] = 100;
+	ay[0] = ay[1] = 100;
+	CROWD_Build(ax, ay, 2);
+	CROWD_Separate(RADIUS, NULL, px, py);
+	CHECK(px[0] == -px[1] && px[0] != 0 && py[0] == 0);
+}
+
+/*----------------------------------------------------------------------------
+  Build plus separation per frame for the grid and for the pair scan
+ *----------------------------------------------------------------------------*/
+static void bench_horde (void) {
+	static S8 px[BENCH_AGENTS], py[BENCH_AGENTS];
+	double t0, t_grid = 0, t_scan = 0;
+	int f, i;
+
+	scatter(BENCH_AGENTS, 4);
+	for (f = 0; f < BENCH_FRAMES; f++) {
+		for (i = 0; i < BENCH_AGENTS; i++)
+			ax[i] = (ax[i] + 1) % CAM_WORLD_W;
+
+		t0 = now_ns();
+		CROWD_Build(ax, ay, BENCH_AGENTS);
+		CROWD_Separate(RADIUS, NULL, px, py);
+		t_grid += now_ns() - t0;
+
+		t0 = now_ns();
+		separate_all(BENCH_AGENTS, RADIUS, NULL, px, py);
+		t_scan += now_ns() - t0;
+	}
+	printf("horde: %d agents, grid %.0f ns, pair scan %.0f ns per frame\n", BENCH_AGENTS,
+		t_grid / BENCH_FRAMES, t_scan / BENCH_FRAMES);
+}
+
+int main (void) {
+	test_query();
+	test_separate();
+	bench_horde();
+
+	printf("crowd_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
@@ -0,0 +1,125 @@
+/*----------------------------------------------------------------------------
+ * Name:    deadline_test.c
+ * Purpose: host simulation of the deadline counters
+ * Note(s): TIMER0 is replaced by a clock the test moves by hand. The frame
+ *          loop below follows base_task: the frame, input and sim jobs
+ *          are released together, sim is done when the horde and pickups
+ *          are, frame once collision has run, and the rest of the period
+ *          is slept outside of any job.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include "RTL.h"
+#include "TIMER0.h"
+#include "deadline.h"
+
+#define FRAME_US   100000
+#define SIM_US      60000
+
+static U32 now_us;
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+uint32_t TIMER0_Us (void) {
+	return now_us;
+}
+
+/*----------------------------------------------------------------------------
+  Responses at and below the budget are runs, above it misses
+ *----------------------------------------------------------------------------*/
+static void test_budget (void) {
+	dl_job_t job = DL_JOB("job", 1000);
+
+	now_us = 5000;
+	DL_Release(&job);
+	now_us += 1000;
+	DL_Done(&job);
+	CHECK(job.runs == 1 && job.misses == 0 && job.worst_us == 1000);
+
+	DL_Release(&job);
+	now_us += 1001;
+	DL_Done(&job);
+	CHECK(job.runs == 2 && job.misses == 1 && job.worst_us == 1001);
+	CHECK(job.last_miss_us == now_us);
+}
+
+/*----------------------------------------------------------------------------
+  The microsecond clock wraps after 71 minutes, responses across it count
+ *----------------------------------------------------------------------------*/
+static void test_wrap (void) {
+	dl_job_t job = DL_JOB("wrap", 1000);
+
+	now_us = 0xFFFFFF00;
+	DL_Release(&job);
+	now_us += 600;
+	DL_Done(&job);
+	CHECK(job.misses == 0 && job.worst_us == 600);
+}
+
+/*----------------------------------------------------------------------------
+  A periodic job that wakes late is charged from its nominal release, one
+  late wake up is one miss and does not shift the following periods
+ *----------------------------------------------------------------------------*/
+static void test_periodic (void) {
+	dl_job_t job = DL_JOB("led", 50000);
+	int i;
+
+	now_us = 1000;
+	for (i = 0; i < 10; i++) {
+		DL_Next(&job, 50000);
+		now_us += (i == 4) ? 60000 : 100;  /* The fifth wake up is late      */
+		DL_Done(&job);
+		now_us = 1000 + (i + 1) * 50000;
+	}
+	CHECK(job.runs == 10);
+	CHECK(job.misses == 1);
+	CHECK(job.release_us == 1000 + 9 * 50000);
+}
+
+/*----------------------------------------------------------------------------
+  Frames with a growing horde: only the frames whose work overruns count,
+  the sleep that pads a short frame to the period is never charged
+ *----------------------------------------------------------------------------*/
+static void test_frames (void) {
+	dl_job_t frame = DL_JOB("frame", FRAME_US);
+	dl_job_t sim = DL_JOB("sim", SIM_US);
+	U32 start, sim_us, rest_us, overruns = 0, sim_overruns = 0;
+	int zombies;
+
+	now_us = 0;
+	for (zombies = 0; zombies <= 200; zombies++) {
+		sim_us = 2000 + zombies * 500;     /* Moving and drawing one zombie    */
+		rest_us = 3000;                    /* Collision after the barrier      */
+		if (sim_us > SIM_US) sim_overruns++;
+		if (sim_us + rest_us > FRAME_US) overruns++;
+
+		start = now_us;
+		DL_Release(&frame);
+		DL_Release(&sim);
+		now_us += sim_us;
+		DL_Done(&sim);
+		now_us += rest_us;
+		DL_Done(&frame);
+		if (now_us - start < FRAME_US)
+			now_us = start + FRAME_US;     /* Sleep out the period             */
+		now_us += 4000;                    /* Render in base_task              */
+	}
+	CHECK(frame.runs == 201 && sim.runs == 201);
+	CHECK(frame.misses == overruns);
+	CHECK(sim.misses == sim_overruns);
+	CHECK(frame.worst_us == 2000 + 200 * 500 + 3000);
+	printf("deadline_test: %u of 201 frames over budget, %u sim overruns\n", frame.misses, sim.misses);
+}
+
+int main (void) {
+	test_budget();
+	test_wrap();
+	test_periodic();
+	test_frames();
+
+	printf("deadline_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
@@ -0,0 +1,301 @@
+/*----------------------------------------------------------------------------
+ * Name:    draw_test.c
+ * Purpose: host test and SPI cost benchmark of the draw.c primitives
+ * Note(s): GLCD_Fill and GLCD_PutPixel are replaced by a raster plus a byte
+ *          model of the driver: the register shadow of both backends, the
+ *          GRAM index command dropping the position slots, and the start
+ *          byte and two bytes a pixel of a data burst. Each shape is drawn
+ *          once through draw.c and once as a GLCD_PutPixel loop over the
+ *          same pixels, which is what the game did before draw.c.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "RTL.h"
+#include "draw.h"
+
+#define WIDTH   320                     /* Landscape, as the game runs        */
+#define HEIGHT  240
+
+#define ILI     0
+#define HIMAX   1
+
+static U8  fb[HEIGHT][WIDTH];
+static U8  ref[HEIGHT][WIDTH];
+static int backend;
+static U16 shadow[8];
+static U8  shadow_ok;
+static U32 bytes, fills;
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*----------------------------------------------------------------------------
+  Register write through the shadow: index and value, 3 bytes each
+ *----------------------------------------------------------------------------*/
+static void reg (int slot, U16 val) {
+	if ((shadow_ok & (1 << slot)) && shadow[slot] == val)
+		return;
+	shadow[slot] = val;
+	shadow_ok |= 1 << slot;
+	bytes += 6;
+}
+
+static void ili_bounds (int x, int y, int w, int h) {
+	reg(0, y);
+	reg(1, y + h - 1);
+	reg(2, x);
+	reg(3, x + w - 1);
+}
+
+static void window (int x, int y, int w, int h) {
+	if (backend == ILI) {
+		ili_bounds(x, y, w, h);
+		reg(4, y);
+		reg(5, x);
+	} else {
+		reg(0, x >> 8);
+		reg(1, x & 0xFF);
+		reg(2, (x + w - 1) >> 8);
+		reg(3, (x + w - 1) & 0xFF);
+		reg(4, y >> 8);
+		reg(5, y & 0xFF);
+		reg(6, (y + h - 1) >> 8);
+		reg(7, (y + h - 1) & 0xFF);
+	}
+}
+
+/* GRAM index command, the controller moves its position registers          */
+static void wr_gram (void) {
+	shadow_ok &= (backend == ILI) ? ~0x30 : ~0x33;
+	bytes += 3;
+}
+
+/*----------------------------------------------------------------------------
+  Stand-ins for the driver, clipped to the screen like it
+ *----------------------------------------------------------------------------*/
+void GLCD_Fill (int x, int y, int w, int h, unsigned short color) {
+	int x0 = (x > 0) ? x : 0, y0 = (y > 0) ? y : 0;
+	int x1 = (x + w < WIDTH) ? x + w : WIDTH, y1 = (y + h < HEIGHT) ? y + h : HEIGHT;
+	int r, c;
+
+	(void)color;
+	if (x0 >= x1 || y0 >= y1)
+		return;
+	for (r = y0; r < y1; r++)
+		for (c = x0; c < x1; c++)
+			fb[r][c]++;
+
+	if (y1 - y0 == 1) {
+		//Span: whole screen window, only the start moves
+		if (backend == ILI) {
+			ili_bounds(0, 0, WIDTH, HEIGHT);
+			reg(4, y0);
+			reg(5, x0);
+		} else {
+			window(x0, y0, WIDTH - x0, HEIGHT - y0);
+		}
+	} else {
+		window(x0, y0, x1 - x0, y1 - y0);
+	}
+	wr_gram();
+	bytes += 1 + 2 * (x1 - x0) * (y1 - y0);
+	fills++;
+}
+
+void GLCD_PutPixel (unsigned int x, unsigned int y) {
+	if (backend == ILI) {
+		reg(4, y);
+		reg(5, x);
+	} else {
+		window(x, y, 1, 1);
+	}
+	wr_gram();
+	bytes += 3;
+}
+
+/*----------------------------------------------------------------------------
+  Pixels drawn that the reference does not have or misses, and pixels drawn
+  more than once
+ *----------------------------------------------------------------------------*/
+static int coverage_diff (int *twice) {
+	int r, c, diff = 0;
+
+	*twice = 0;
+	for (r = 0; r < HEIGHT; r++)
+		for (c = 0; c < WIDTH; c++) {
+			diff += (fb[r][c] != 0) != ref[r][c];
+			*twice += fb[r][c] > 1;
+		}
+	return diff;
+}
+
+static void plot (int x, int y) {
+	if (x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT)
+		ref[y][x] = 1;
+}
+
+/*----------------------------------------------------------------------------
+  Lines cover exactly the pixels of a per pixel Bresenham, and only once
+ *----------------------------------------------------------------------------*/
+static void test_line (void) {
+	int t, i, x0, y0, x1, y1, dx, dy, sx, sy, x, y, e, bad = 0;
+
+	srand(1);
+	for (t = 0; t < 5000; t++) {
+		x0 = rand() % WIDTH;  y0 = rand() % HEIGHT;
+		x1 = rand() % WIDTH;  y1 = rand() % HEIGHT;
+		if (t < 49) {
+			x1 = x0 + t % 7 - 3;                /* Short lines in every direction    */
+			y1 = y0 + t / 7 - 3;
+		}
+		memset(fb, 0, sizeof(fb));
+		memset(ref, 0, sizeof(ref));
+		DRAW_Line(x0, y0, x1, y1, 1);
+
+		dx = abs(x1 - x0);  sx = (x1 > x0) ? 1 : -1;
+		dy = abs(y1 - y0);  sy = (y1 > y0) ? 1 : -1;
+		x = x0;  y = y0;
+		plot(x, y);
+		if (dx >= dy) {
+			for (e = dx / 2, i = 0; i < dx; i++) {
+				x += sx;  e -= dy;
+				if (e < 0) { e += dx;  y += sy; }
+				plot(x, y);
+			}
+		} else {
+			for (e = dy / 2, i = 0; i < dy; i++) {
+				y += sy;  e -= dx;
+				if (e < 0) { e += dy;  x += sx; }
+				plot(x, y);
+			}
+		}
+		if (memcmp(fb, ref, sizeof(fb)) != 0)
+			bad++;
+	}
+	CHECK(bad == 0);
+}
+
+/*----------------------------------------------------------------------------
+  Circles match a per pixel midpoint walk, filled ones the span between the
+  outline ends of each row. The outline writes the few pixels where its
+  octants meet twice, a filled circle every pixel once.
+ *----------------------------------------------------------------------------*/
+static void test_circle (void) {
+	int r, x, y, d, row, c, left, right, cx = 160, cy = 120, bad = 0;
+	int twice, outline_twice = 0;
+
+	for (r = 0; r < 110; r++) {
+		memset(fb, 0, sizeof(fb));
+		memset(ref, 0, sizeof(ref));
+		DRAW_Circle(cx, cy, r, 1);
+
+		x = 0;  y = r;  d = 1 - r;
+		plot(cx, cy + r);
+		while (x <= y) {
+			plot(cx + x, cy + y);  plot(cx - x, cy + y);
+			plot(cx + x, cy - y);  plot(cx - x, cy - y);
+			plot(cx + y, cy + x);  plot(cx - y, cy + x);
+			plot(cx + y, cy - x);  plot(cx - y, cy - x);
+			if (d < 0) {
+				d += 2 * x + 3;
+			} else {
+				d += 2 * (x - y) + 5;
+				y--;
+			}
+			x++;
+		}
+		if (coverage_diff(&twice) != 0)
+			bad++;
+		outline_twice += twice;
+
+		for (row = 0; row < HEIGHT; row++) {
+			left = -1;  right = -1;
+			for (c = 0; c < WIDTH; c++)
+				if (ref[row][c]) {
+					if (left < 0) left = c;
+					right = c;
+				}
+			for (c = left; left >= 0 && c <= right; c++)
+				ref[row][c] = 1;
+		}
+		memset(fb, 0, sizeof(fb));
+		DRAW_FillCircle(cx, cy, r, 1);
+		if (coverage_diff(&twice) != 0 || twice != 0)
+			bad++;
+	}
+	CHECK(bad == 0);
+	printf("circle: outlines r 0..109 wrote %d pixels twice\n", outline_twice);
+}
+
+/*----------------------------------------------------------------------------
+  A right triangle with 21 pixel legs covers 231 pixels
+ *----------------------------------------------------------------------------*/
+static void test_poly (void) {
+	static const S16 x[3] = { 0, 20, 20 };
+	static const S16 y[3] = { 0,  0, 20 };
+	int r, c, twice;
+
+	memset(fb, 0, sizeof(fb));
+	memset(ref, 0, sizeof(ref));
+	DRAW_FillPoly(x, y, 3, 1);
+	for (r = 0; r <= 20; r++)
+		for (c = r; c <= 20; c++)
+			ref[r][c] = 1;
+	CHECK(coverage_diff(&twice) == 0 && twice == 0);
+}
+
+/*----------------------------------------------------------------------------
+  SPI bytes of one shape through draw.c and as a GLCD_PutPixel loop
+ *----------------------------------------------------------------------------*/
+static void bench_shape (const char *name, int shape) {
+	static const S16 px[4] = { 40, 200, 180, 20 };
+	static const S16 py[4] = { 20,  60, 200, 160 };
+	U32 span_bytes, span_fills, pixel_bytes, pixels;
+	int r, c;
+
+	for (backend = ILI; backend <= HIMAX; backend++) {
+		memset(fb, 0, sizeof(fb));
+		shadow_ok = 0;
+		bytes = fills = 0;
+		switch (shape) {
+			case 0: DRAW_Line(10, 10, 300, 200, 1);  break;
+			case 1: DRAW_Circle(160, 120, 60, 1);    break;
+			case 2: DRAW_FillCircle(160, 120, 60, 1); break;
+			case 3: DRAW_FillPoly(px, py, 4, 1);     break;
+		}
+		span_bytes = bytes;
+		span_fills = fills;
+
+		shadow_ok = 0;
+		bytes = pixels = 0;
+		for (r = 0; r < HEIGHT; r++)
+			for (c = 0; c < WIDTH; c++)
+				if (fb[r][c]) {
+					GLCD_PutPixel(c, r);
+					pixels++;
+				}
+		pixel_bytes = bytes;
+
+		printf("%-12s %-5s %5u px: %4u fills %7u bytes, pixel loop %7u bytes\n", name,
+			backend == ILI ? "ili" : "himax", pixels, span_fills, span_bytes, pixel_bytes);
+		CHECK(span_bytes < pixel_bytes);
+	}
+}
+
+int main (void) {
+	test_line();
+	test_circle();
+	test_poly();
+
+	bench_shape("line", 0);
+	bench_shape("circle", 1);
+	bench_shape("fill circle", 2);
+	bench_shape("fill poly", 3);
+
+	printf("draw_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
@@ -0,0 +1,180 @@
+/*----------------------------------------------------------------------------
+ * Name:    filter_replay.c
+ * Purpose: replay a recorded ADC stream through filter.c on the host
+ * Note(s): Reads the text the 'a' serial command prints, the raw samples
+ *          of the ADC ring and the filtered value, from the file named on
+ *          the command line. Without one it builds a dump of a noisy step
+ *          in the same format, so the parser and the filter are checked
+ *          on every run. The stream is then looped for the throughput.
+ *          Dumps are joined end to end; what the ADC took between two 'a'
+ *          commands is not in the capture.
+ *
+ *          bin/filter_replay capture.txt   replay a terminal capture
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "RTL.h"
+#include "filter.h"
+
+#define ADC_RING      64                /* As ADC.h, the samples one dump has */
+#define MAX_SAMPLES   4096              /* Several dumps in one capture       */
+#define BENCH_SAMPLES 100000000UL
+#define STEP_DUMPS    16                /* Dumps in the built in capture      */
+
+static U16 samples[MAX_SAMPLES];
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static double now_ns (void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*----------------------------------------------------------------------------
+  Samples of every "--- ADC" block in the text, in order. The device's last
+  filtered value goes to *filtered, -1 if the text has none.
+  Returns the number of samples read.
+ *----------------------------------------------------------------------------*/
+static int parse_dump (FILE *in, int *filtered) {
+	char line[256], *p, *end;
+	unsigned long val;
+	int n = 0, in_block = 0;
+	unsigned int f, max;
+
+	*filtered = -1;
+	while (fgets(line, sizeof(line), in) != NULL) {
+		if (strncmp(line, "--- ADC", 7) == 0) {
+			in_block = 1;
+			continue;
+		}
+		if (sscanf(line, "filtered %u of %u", &f, &max) == 2) {
+			*filtered = (int)f;
+			in_block = 0;
+			continue;
+		}
+		if (!in_block)
+			continue;
+		for (p = line; ; p = end) {
+			val = strtoul(p, &end, 10);
+			if (end == p)
+				break;
+			if (val <= 0xFFF && n < MAX_SAMPLES)
+				samples[n++] = (U16)val;
+		}
+	}
+	return n;
+}
+
+/*----------------------------------------------------------------------------
+  STEP_DUMPS dumps of a step from 1000 to 3000 after the second one, with
+  +-64 of noise, printed the way adc_report does
+ *----------------------------------------------------------------------------*/
+static FILE *synthetic_dump (void) {
+	FILE *f = tmpfile();
+	int d, i, v;
+
+	srand(7);
+	for (d = 0; d < STEP_DUMPS; d++) {
+		fprintf(f, "--- ADC (%d samples) ---\n", (d + 1) * ADC_RING);
+		for (i = 0; i < ADC_RING; i++) {
+			v = ((d * ADC_RING + i) < 2 * ADC_RING ? 1000 : 3000) + rand() % 129 - 64;
+			fprintf(f, "%d%c", v, (i % 16 == 15 || i == ADC_RING - 1) ? '\n' : ' ');
+		}
+		fprintf(f, "filtered      %u of %u\n", 0u, FILTER_MAX);
+	}
+	rewind(f);
+	return f;
+}
+
+/*----------------------------------------------------------------------------
+  Replay the stream once, printing each block against the filter output.
+  *lo and *hi get the output range over the last quarter.
+  Returns the last output
+ *----------------------------------------------------------------------------*/
+static U16 replay (int n, int verbose, U32 *lo, U32 *hi) {
+	filter_t filter;
+	U32 block = 0;
+	int i;
+
+	FILTER_Init(&filter);
+	*lo = FILTER_MAX;
+	*hi = 0;
+	for (i = 0; i < n; i++) {
+		block += samples[i];
+		if (!FILTER_Add(&filter, samples[i]))
+			continue;
+		if (verbose)
+			printf("block %3d raw %5u filtered %5u\n", i / FILTER_OVERSAMPLE, block, FILTER_Get(&filter));
+		if (i >= n - n / 4 && FILTER_Get(&filter) < *lo) *lo = FILTER_Get(&filter);
+		if (i >= n - n / 4 && FILTER_Get(&filter) > *hi) *hi = FILTER_Get(&filter);
+		block = 0;
+	}
+	return FILTER_Get(&filter);
+}
+
+/*----------------------------------------------------------------------------
+  Samples per second through FILTER_Add, the stream looped
+ *----------------------------------------------------------------------------*/
+static void bench (int n) {
+	filter_t filter;
+	volatile U16 sink;
+	double t0, t;
+	U32 i;
+	int j = 0;
+
+	FILTER_Init(&filter);
+	t0 = now_ns();
+	for (i = 0; i < BENCH_SAMPLES; i++) {
+		if (FILTER_Add(&filter, samples[j]))
+			sink = FILTER_Get(&filter);
+		if (++j == n)
+			j = 0;
+	}
+	t = now_ns() - t0;
+	(void)sink;
+	printf("throughput: %.0f Msamples/s, %.2f ns a sample\n", BENCH_SAMPLES / t * 1e3, t / BENCH_SAMPLES);
+}
+
+int main (int argc, char **argv) {
+	FILE *in;
+	int n, filtered;
+	U32 lo, hi;
+	U16 out;
+
+	in = (argc > 1) ? fopen(argv[1], "r") : synthetic_dump();
+	if (in == NULL) {
+		perror(argv[1]);
+		return 2;
+	}
+	n = parse_dump(in, &filtered);
+	fclose(in);
+	printf("%d samples, %d blocks\n", n, n / FILTER_OVERSAMPLE);
+	if (n < FILTER_OVERSAMPLE) {
+		printf("filter_replay: no complete block in the dump\n");
+		return 2;
+	}
+
+	out = replay(n, argc > 1, &lo, &hi);
+	if (argc > 1) {
+		//The device filter also saw the samples before the ring, expect it close, not equal
+		printf("replayed %u, device printed %d (of %u)\n", out, filtered, FILTER_MAX);
+	} else {
+		CHECK(n == STEP_DUMPS * ADC_RING);
+		//Settled on the second step within the noise, blocks of 3000 +- 64
+		CHECK(lo >= FILTER_OVERSAMPLE * (3000 - 64) && hi <= FILTER_OVERSAMPLE * (3000 + 64));
+		CHECK(out > FILTER_OVERSAMPLE * 2950 && out < FILTER_OVERSAMPLE * 3050);
+		printf("step: settled at %u, %u..%u over the last quarter\n", out, lo, hi);
+	}
+
+	bench(n);
+	printf("filter_replay: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
@@ -0,0 +1,153 @@
+/*----------------------------------------------------------------------------
+ * Name:    flowfield_test.c
+ * Purpose: host test and benchmark of the flow field
+ * Note(s): Every reachable cell must lead to the target by following its
+ *          direction. The maze test walls the field into a single lane of
+ *          more than 255 cells, longer than a U8 distance can hold. The
+ *          benchmark times a rebuild and the lookups of a large horde.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "RTL.h"
+#include "flowfield.h"
+
+#define BENCH_AGENTS 1024
+#define BENCH_FRAMES 1000
+
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static double now_ns (void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void clear_blocked (void) {
+	int col, row;
+
+	for (row = 0; row < FF_ROWS; row++)
+		for (col = 0; col < FF_COLS; col++)
+			FF_SetBlocked(col, row, 0);
+}
+
+/*----------------------------------------------------------------------------
+  Steps from cell (col, row) to the target following the field, -1 if the
+  walk hits a wall, leaves the field or loops
+ *----------------------------------------------------------------------------*/
+static int walk (int col, int row, int t_col, int t_row, const U8 *blocked) {
+	int steps = 0;
+	U8 d;
+
+	while (col != t_col || row != t_row) {
+		d = FF_Direction(col * FF_CELL + FF_CELL / 2, row * FF_CELL + FF_CELL / 2);
+		if (d == FF_NONE || steps > FF_CELLS)
+			return -1;
+		col += FF_DX[d] / 181;
+		row += FF_DY[d] / 181;
+		if (col < 0 || col >= FF_COLS || row < 0 || row >= FF_ROWS || blocked[row * FF_COLS + col])
+			return -1;
+		steps++;
+	}
+	return steps;
+}
+
+/*----------------------------------------------------------------------------
+  Open field: every cell reaches the target in its Chebyshev distance
+ *----------------------------------------------------------------------------*/
+static void test_open (void) {
+	static U8 blocked[FF_CELLS];
+	int col, row, dx, dy, bad = 0;
+	int t_col = 7, t_row = 9;
+
+	clear_blocked();
+	CHECK(FF_Update(t_col * FF_CELL + 3, t_row * FF_CELL + 3) == 1);
+	CHECK(FF_Update(t_col * FF_CELL + 12, t_row * FF_CELL + 12) == 0);
+
+	for (row = 0; row < FF_ROWS; row++)
+		for (col = 0; col < FF_COLS; col++) {
+			dx = abs(col - t_col);
+			dy = abs(row - t_row);
+			if (walk(col, row, t_col, t_row, blocked) != (dx > dy ? dx : dy))
+				bad++;
+		}
+	CHECK(bad == 0);
+}
+
+/*----------------------------------------------------------------------------
+  Serpentine lane: walls on every odd row with the gap at alternate ends
+ *----------------------------------------------------------------------------*/
+static void test_maze (void) {
+	static U8 blocked[FF_CELLS];
+	int col, row, steps, longest = 0, bad = 0;
+
+	clear_blocked();
+	for (row = 1; row < FF_ROWS; row += 2)
+		for (col = 0; col < FF_COLS; col++)
+			if (col != ((row / 2) % 2 ? 0 : FF_COLS - 1)) {
+				blocked[row * FF_COLS + col] = 1;
+				FF_SetBlocked(col, row, 1);
+			}
+
+	FF_Update(0, 0);
+	for (row = 0; row < FF_ROWS; row++)
+		for (col = 0; col < FF_COLS; col++) {
+			if (blocked[row * FF_COLS + col])
+				continue;
+			steps = walk(col, row, 0, 0, blocked);
+			if (steps < 0)
+				bad++;
+			if (steps > longest)
+				longest = steps;
+		}
+	CHECK(bad == 0);
+	CHECK(longest > 255);
+	printf("maze: longest path %d cells\n", longest);
+	clear_blocked();
+}
+
+/*----------------------------------------------------------------------------
+  One rebuild and BENCH_AGENTS lookups per frame, the target moving
+ *----------------------------------------------------------------------------*/
+static void bench_horde (void) {
+	static int ax[BENCH_AGENTS], ay[BENCH_AGENTS];
+	double t0, t_build = 0, t_look = 0;
+	U32 sum = 0;
+	int f, i;
+
+	srand(1);
+	for (i = 0; i < BENCH_AGENTS; i++) {
+		ax[i] = rand() % CAM_WORLD_W;
+		ay[i] = rand() % CAM_WORLD_H;
+	}
+
+	for (f = 0; f < BENCH_FRAMES; f++) {
+		t0 = now_ns();
+		FF_SetBlocked(0, 0, f & 1);           /* Force a rebuild every frame       */
+		FF_Update((f * 7) % CAM_WORLD_W, (f * 3) % CAM_WORLD_H);
+		t_build += now_ns() - t0;
+
+		t0 = now_ns();
+		for (i = 0; i < BENCH_AGENTS; i++)
+			sum += FF_Direction(ax[i], ay[i]);
+		t_look += now_ns() - t0;
+	}
+	CHECK(sum > 0);
+	printf("horde: %d cells, rebuild %.0f ns, %d lookups %.0f ns per frame\n", FF_CELLS,
+		t_build / BENCH_FRAMES, BENCH_AGENTS, t_look / BENCH_FRAMES);
+}
+
+int main (void) {
+	test_open();
+	test_maze();
+	bench_horde();
+
+	printf("flowfield_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
@@ -0,0 +1,180 @@
+/*----------------------------------------------------------------------------
+ * Name:    game_test.c
+ * Purpose: host run of the whole game, counting the kernel calls per frame
+ * Note(s): Blinky.c is built as it is for the board, its main() renamed,
+ *          on the real driver and lcd_model.c and the kernel calls of
+ *          rtx_model.c. The modules that only talk to pins are stand-ins
+ *          below: the joystick walks the human around a square, the button
+ *          starts the game and is not pressed again, the potentiometer is
+ *          at 0. The game runs until the horde gets the human. Checked are
+ *          the event calls of the frame barrier, which must not depend on
+ *          the zombies; the lock operations, which must all be on the LCD
+ *          and LED mutexes since the game state is double buffered; and
+ *          the game over: every job released is done and no task is
+ *          deleted holding a mutex.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "RTL.h"
+#include "GLCD.h"
+#include "LED.h"
+#include "ADC.h"
+#include "INT0.h"
+#include "JOYSTICK.h"
+#include "TIMER0.h"
+#include "load.h"
+#include "memstat.h"
+#include "score.h"
+#include "deadline.h"
+#include "lcd_model.h"
+#include "rtx_model.h"
+
+#undef main                             /* Built with -Dmain=blinky_main      */
+
+#define UNTIL_US    600000000           /* Model time the game may take       */
+#define WALK        40                  /* Frames along one side of the square*/
+
+extern int blinky_main (void);
+extern U32 frames_played;
+extern volatile bool game_playing;
+extern dl_job_t job_frame, job_input, job_sim, job_render, job_effect;
+extern OS_MUT GLCD_mut, LED_mut;
+
+typedef struct {
+	U32 frames;
+	U32 min, max, total;
+} spread_t;
+
+static rtx_count_t at_frame;
+static U32 at_glcd, at_led;
+static U32 last_frame;
+static U32 over_us;                     /* Model time the game ended          */
+static spread_t evt, calls, locks, glcd, other, blocked;
+static score_table_t table;
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*----------------------------------------------------------------------------
+  Stand-ins for the modules that drive pins
+ *----------------------------------------------------------------------------*/
+void SystemInit (void) {}
+void SystemCoreClockUpdate (void) {}
+void SER_Init (void) {}
+int checkkey (void) { return 0; }
+void LED_Init (void) {}
+void LED_Out (unsigned int value) { (void)value; }
+void ADC_Init (void) {}
+void ADC_BurstStart (void) {}
+uint16_t ADC_Value (void) { return 0; }
+uint32_t ADC_Record (uint16_t *samples, uint32_t n) { (void)samples; (void)n; return 0; }
+void INT0_HwInit (void) {}
+void INT0_Start (void) {}
+U32 LOAD_Get (void) { return 0; }
+void MEM_StackPaint (const char *name, U64 *stk, U16 size) { (void)name; (void)stk; (void)size; }
+void MEM_AddStatic (const char *name, U32 size) { (void)name; (void)size; }
+void MEM_Report (void) {}
+void SCORE_Init (void) {}
+int SCORE_Add (int kills) { table.kills[0] = (U16)kills; return 0; }
+int SCORE_Save (void) { return 1; }
+const score_table_t *SCORE_Table (void) { return &table; }
+void SCORE_Report (void) {}
+void TIMER0_Tick (void (*tick)(uint32_t us)) { (void)tick; }
+uint32_t TIMER0_Missed (void) { return 0; }
+
+static const int0_stats_t int0_stats;
+static const joy_stats_t joy_stats;
+
+const int0_stats_t *INT0_Stats (void) { return &int0_stats; }
+const joy_stats_t *JOYSTICK_Stats (void) { return &joy_stats; }
+void JOYSTICK_Init (void) {}
+
+/* The menu waits for the press, base_task polls for bombs                   */
+OS_RESULT INT0_Wait (U16 timeout, uint32_t *us) {
+	*us = TIMER0_Us();
+	return timeout != 0 ? OS_R_OK : OS_R_TMO;
+}
+
+/* Right, down, left, up, WALK frames each                                   */
+void JOYSTICK_Collect (uint16_t share[JOY_DIRS]) {
+	static const int dirs[] = { RIGHT_POS, DOWN_POS, LEFT_POS, UP_POS };
+	int dir;
+
+	for (dir = 0; dir < JOY_DIRS; dir++)
+		share[dir] = 0;
+	share[dirs[frames_played / WALK % 4]] = JOY_SHARE;
+}
+
+/*----------------------------------------------------------------------------
+  Kernel calls from one frame to the next
+ *----------------------------------------------------------------------------*/
+static void spread (spread_t *s, U32 n) {
+	if (s->frames == 0 || n < s->min) s->min = n;
+	if (s->frames == 0 || n > s->max) s->max = n;
+	s->total += n;
+	s->frames++;
+}
+
+static void hook (void) {
+	const rtx_count_t *c = &RTX_Count;
+
+	if (!game_playing && over_us == 0)
+		over_us = LCD_Now();
+	if (frames_played == last_frame)
+		return;
+	//The first two frames also hold the task creation and start
+	if (last_frame > 1) {
+		spread(&evt, c->evt_set + c->evt_wait - at_frame.evt_set - at_frame.evt_wait);
+		spread(&calls, RTX_Calls(c) - RTX_Calls(&at_frame));
+		spread(&locks, c->mut_wait + c->mut_release - at_frame.mut_wait - at_frame.mut_release);
+		spread(&glcd, RTX_MutOps(&GLCD_mut) - at_glcd);
+		spread(&other, c->mut_wait + c->mut_release - at_frame.mut_wait - at_frame.mut_release -
+			(RTX_MutOps(&GLCD_mut) - at_glcd) - (RTX_MutOps(&LED_mut) - at_led));
+		spread(&blocked, c->mut_blocked - at_frame.mut_blocked);
+	}
+	at_frame = *c;
+	at_glcd = RTX_MutOps(&GLCD_mut);
+	at_led = RTX_MutOps(&LED_mut);
+	last_frame = frames_played;
+}
+
+static void print (const char *name, const spread_t *s) {
+	printf("game: %-12s %4u frames, %u to %u per frame, %u.%u avg\n", name, s->frames, s->min, s->max,
+		s->total / (s->frames ? s->frames : 1), s->total * 10 / (s->frames ? s->frames : 1) % 10);
+}
+
+static void boot (void) {
+	blinky_main();
+}
+
+int main (void) {
+	LCD_Reset(LCD_ILI, 0x9325);
+	RTX_Hook = hook;
+	RTX_Run(boot, UNTIL_US);
+
+	printf("game: over after %u frames, %u.%u s model time\n", frames_played,
+		over_us / 1000000, over_us / 100000 % 10);
+	print("event calls", &evt);
+	print("all calls", &calls);
+	print("lock ops", &locks);
+	print("GLCD_mut ops", &glcd);
+	print("other locks", &other);
+	print("blocked", &blocked);
+	CHECK(!game_playing);
+	CHECK(RTX_Count.deadlock == 0);
+	CHECK(evt.frames > 100 && evt.min == evt.max);
+	CHECK(other.max == 0);
+
+	//Every frame released was finished before the workers were deleted
+	CHECK(RTX_Count.deleted_owner == 0);
+	CHECK(job_render.runs == frames_played);
+	CHECK(job_frame.runs == frames_played && job_input.runs == frames_played);
+	CHECK(job_sim.runs == frames_played && job_effect.runs == frames_played);
+	CHECK(LCD_Count.errors == 0);
+
+	printf("game_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
@@ -0,0 +1,439 @@
+/*----------------------------------------------------------------------------
+ * Name:    glcd_test.c
+ * Purpose: host test of GLCD_SPI_LPC1700.c against the controller model
+ * Note(s): The real driver runs its init sequence and draws into the GRAM
+ *          of lcd_model.c. Every case is compared pixel for pixel with a
+ *          reference drawn in RAM. The whole sequence runs once on each
+ *          controller the driver has a backend for.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "RTL.h"
+#include "GLCD.h"
+#include "lcd_model.h"
+
+#define SPR_W       20
+#define SPR_H       12
+#define MARK        0x5555              /* GRAM before each case              */
+
+/* A controller and the register writes its backend needs per call          */
+typedef struct {
+	const char *name;
+	int   kind;
+	U16   id;                               /* Register 0x00                      */
+	U8    wr_reg;                           /* A register GLCD_WrReg may touch     */
+	U16   wr_val;
+	U32   cold, same, same_skip;            /* Bitmap: cold, same place again     */
+	U32   moved, moved_skip;                /* Bitmap one pixel right             */
+	U32   span, pixel;                      /* Row of 40, one pixel               */
+} BACKEND;
+
+static const BACKEND backends[] = {
+	//Window and cursor registers, GRAM access moves only the cursor
+	{ "ili",   LCD_ILI,   0x9325, 0x03, 0x1038, 6, 2, 4, 4, 2, 2, 2 },
+	//Start and end, MSB and LSB: GRAM access moves the four start registers
+	{ "himax", LCD_HIMAX, 0x0047, 0x16, 0x00A8, 8, 4, 4, 5, 3, 4, 7 },
+};
+
+static const BACKEND *be;
+static unsigned short ref[LCD_H][LCD_W];
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*----------------------------------------------------------------------------
+  Power on the model and run the driver's init on it
+ *----------------------------------------------------------------------------*/
+static void boot (const BACKEND *b) {
+	be = b;
+	LCD_Reset(b->kind, b->id);
+	GLCD_Init();
+	GLCD_ClipMax();
+	CHECK(LCD_Count.errors == 0);
+	//The backend the init picked: landscape memory access or entry mode
+	if (b->kind == LCD_HIMAX)
+		CHECK(LCD_Reg(0x16) == 0xA8 && LCD_Reg(0x03) == 0);
+	else
+		CHECK(LCD_Reg(0x03) == 0x1038);
+}
+
+static void clear_both (void) {
+	int x, y;
+
+	for (y = 0; y < LCD_H; y++)
+		for (x = 0; x < LCD_W; x++)
+			LCD_Gram[y][x] = ref[y][x] = MARK;
+}
+
+/*----------------------------------------------------------------------------
+  Sprite pixel at column c, row r from the top: unique and never MARK
+ *----------------------------------------------------------------------------*/
+static unsigned short pixel (int c, int r) {
+	return (unsigned short)((c << 8 | r) + 1);
+}
+
+/*----------------------------------------------------------------------------
+  Reference of a w x h rectangle at x, y inside the clip rectangle c, drawn
+  from a bitmap (rows stored bottom up) or with one color
+ *----------------------------------------------------------------------------*/
+static int ref_rect (int x, int y, int w, int h, const int *c, const unsigned short *bitmap, unsigned short color) {
+	int r, col, n = 0;
+
+	for (r = 0; r < h; r++)
+		for (col = 0; col < w; col++) {
+			if (x + col < c[0] || x + col >= c[2] || y + r < c[1] || y + r >= c[3])
+				continue;
+			ref[y + r][x + col] = bitmap ? bitmap[(h - 1 - r) * w + col] : color;
+			n++;
+		}
+	return n;
+}
+
+/*----------------------------------------------------------------------------
+  Positions around the edges e of the screen and the clip rectangle, from
+  fully off before the edge to fully past it
+ *----------------------------------------------------------------------------*/
+static int positions (const int *edges, int n_edges, int size, int *pos) {
+	int i, d, n = 0;
+	static const int deltas[] = { -1, 0, 1 };
+
+	for (i = 0; i < n_edges; i++)
+		for (d = 0; d < 3; d++) {
+			pos[n++] = edges[i] - size + deltas[d];
+			pos[n++] = edges[i] + deltas[d];
+		}
+	return n;
+}
+
+/*----------------------------------------------------------------------------
+  Bitmaps and fills at every position around the screen and clip edges,
+  with the clip rectangle on screen, across its edges and empty. Nothing
+  outside the clip is written, and only the visible pixels are sent.
+ *----------------------------------------------------------------------------*/
+static void test_clip (void) {
+	static const int clips[][4] = {
+		{   0,   0, LCD_W, LCD_H },            /* Whole screen                     */
+		{  50,  40, 100,  80 },               /* Inside                           */
+		{ -10, -10,  30,  30 },               /* Across the top left corner       */
+		{ 300, 220,  50,  50 },               /* Across the bottom right corner   */
+		{  10,  10,   0,   5 },               /* Empty: no width                  */
+		{  10,  10,   5,  -3 },               /* Empty: negative height           */
+		{ 400,  10,  20,  20 },               /* Off screen                       */
+	};
+	static unsigned short bitmap[SPR_W * SPR_H];
+	int xs[24], ys[24], edges[4], c[4];
+	int k, i, j, n_x, n_y, visible, bad = 0, cases = 0;
+	U32 bytes, pixels;
+
+	for (j = 0; j < SPR_H; j++)
+		for (i = 0; i < SPR_W; i++)
+			bitmap[(SPR_H - 1 - j) * SPR_W + i] = pixel(i, j);
+
+	for (k = 0; k < (int)(sizeof(clips) / sizeof(clips[0])); k++) {
+		GLCD_SetClip(clips[k][0], clips[k][1], clips[k][2], clips[k][3]);
+		//The clip rectangle as the driver keeps it, trimmed to the screen
+		c[0] = clips[k][0] > 0 ? clips[k][0] : 0;
+		c[1] = clips[k][1] > 0 ? clips[k][1] : 0;
+		c[2] = clips[k][0] + clips[k][2] < LCD_W ? clips[k][0] + clips[k][2] : LCD_W;
+		c[3] = clips[k][1] + clips[k][3] < LCD_H ? clips[k][1] + clips[k][3] : LCD_H;
+
+		edges[0] = 0;  edges[1] = LCD_W;  edges[2] = clips[k][0];  edges[3] = clips[k][0] + clips[k][2];
+		n_x = positions(edges, 4, SPR_W, xs);
+		edges[0] = 0;  edges[1] = LCD_H;  edges[2] = clips[k][1];  edges[3] = clips[k][1] + clips[k][3];
+		n_y = positions(edges, 4, SPR_H, ys);
+
+		for (i = 0; i < n_x; i++)
+			for (j = 0; j < n_y; j++, cases += 3) {
+				//Bitmap, rows bottom up
+				clear_both();
+				bytes = LCD_Count.bytes;
+				pixels = LCD_Count.pixels;
+				visible = ref_rect(xs[i], ys[j], SPR_W, SPR_H, c, bitmap, 0);
+				GLCD_Bitmap(xs[i], ys[j], SPR_W, SPR_H, (unsigned char *)bitmap);
+				if (memcmp(LCD_Gram, ref, sizeof(ref)) != 0 || LCD_Count.pixels - pixels != (U32)visible)
+					bad++;
+				if (visible == 0 && LCD_Count.bytes != bytes)
+					bad++;
+
+				//Rectangle fill, and a one row fill that takes the span path
+				clear_both();
+				bytes = LCD_Count.bytes;
+				visible = ref_rect(xs[i], ys[j], SPR_W, SPR_H, c, NULL, Red);
+				GLCD_Fill(xs[i], ys[j], SPR_W, SPR_H, Red);
+				if (memcmp(LCD_Gram, ref, sizeof(ref)) != 0 || (visible == 0 && LCD_Count.bytes != bytes))
+					bad++;
+
+				clear_both();
+				ref_rect(xs[i], ys[j], SPR_W, 1, c, NULL, Blue);
+				GLCD_Fill(xs[i], ys[j], SPR_W, 1, Blue);
+				if (memcmp(LCD_Gram, ref, sizeof(ref)) != 0)
+					bad++;
+			}
+	}
+	GLCD_ClipMax();
+	CHECK(bad == 0);
+	CHECK(LCD_Count.errors == 0);
+	printf("%s clip: %d cases\n", be->name, cases);
+}
+
+/*----------------------------------------------------------------------------
+  Run one driver call, the bytes the model saw must match GLCD_Stats
+ *----------------------------------------------------------------------------*/
+static U32 call_bytes, call_stats, call_regs, call_skipped;
+static int stats_bad;
+
+static void call_start (void) {
+	call_bytes = LCD_Count.bytes;
+	call_stats = GLCD_Stats()->bytes;
+	call_regs = LCD_Count.reg_writes;
+	call_skipped = GLCD_Stats()->reg_skipped;
+}
+
+static U32 call_end (void) {
+	call_bytes = LCD_Count.bytes - call_bytes;
+	stats_bad += GLCD_Stats()->bytes - call_stats != call_bytes;
+	call_regs = LCD_Count.reg_writes - call_regs;
+	call_skipped = GLCD_Stats()->reg_skipped - call_skipped;
+	return call_bytes;
+}
+
+/*----------------------------------------------------------------------------
+  Register writes the shadow saves, and the bytes of each call
+ *----------------------------------------------------------------------------*/
+static void test_shadow (void) {
+	static unsigned short bitmap[SPR_W * SPR_H];
+	const U32 data = 1 + 2 * SPR_W * SPR_H;      /* Start byte and the pixels   */
+	U32 bytes;
+
+	//GLCD_WrReg may hit a shadowed register, the next window is sent whole
+	GLCD_WrReg(be->wr_reg, be->wr_val);
+	call_start();
+	GLCD_Bitmap(100, 50, SPR_W, SPR_H, (unsigned char *)bitmap);
+	bytes = call_end();
+	CHECK(call_regs == be->cold && call_skipped == 0);
+	CHECK(bytes == be->cold * 6 + 3 + data);
+	printf("%s shadow: cold bitmap %u bytes", be->name, bytes);
+
+	//Same place: only the registers the GRAM access moved
+	call_start();
+	GLCD_Bitmap(100, 50, SPR_W, SPR_H, (unsigned char *)bitmap);
+	bytes = call_end();
+	CHECK(call_regs == be->same && call_skipped == be->same_skip);
+	CHECK(bytes == be->same * 6 + 3 + data);
+	printf(", same window %u", bytes);
+
+	//One pixel right: the columns that changed and the moved registers
+	call_start();
+	GLCD_Bitmap(101, 50, SPR_W, SPR_H, (unsigned char *)bitmap);
+	bytes = call_end();
+	CHECK(call_regs == be->moved && call_skipped == be->moved_skip);
+	CHECK(bytes == be->moved * 6 + 3 + data);
+	printf(", moved %u\n", bytes);
+
+	//Row spans keep the end of the window, only the start moves
+	GLCD_Fill(0, 0, LCD_W, 1, Black);
+	call_start();
+	GLCD_Fill(30, 77, 40, 1, Black);
+	bytes = call_end();
+	CHECK(call_regs == be->span && bytes == be->span * 6 + 3 + 1 + 2 * 40);
+	printf("%s shadow: span of 40 %u bytes", be->name, bytes);
+
+	//A pixel: its window, GRAM index, one data transfer
+	GLCD_SetTextColor(Red);
+	call_start();
+	GLCD_PutPixel(5, 6);
+	bytes = call_end();
+	CHECK(call_regs == be->pixel && bytes == be->pixel * 6 + 3 + 3);
+	CHECK(LCD_Gram[6][5] == Red);
+	printf(", pixel %u\n", bytes);
+
+	CHECK(stats_bad == 0);
+	CHECK(LCD_Count.errors == 0);
+}
+
+/*----------------------------------------------------------------------------
+  Random bitmaps, fills, spans, pixels and characters: the screen matches
+  a reference, so no skipped write left a register stale, and GLCD_Stats
+  counts every byte the model saw
+ *----------------------------------------------------------------------------*/
+static void test_random (void) {
+	static unsigned short bitmap[SPR_W * SPR_H];
+	static const int full[4] = { 0, 0, LCD_W, LCD_H };
+	int i, x, y, w, h, op, bad = 0;
+	U32 skipped = GLCD_Stats()->reg_skipped, regs = LCD_Count.reg_writes;
+
+	for (y = 0; y < SPR_H; y++)
+		for (x = 0; x < SPR_W; x++)
+			bitmap[(SPR_H - 1 - y) * SPR_W + x] = pixel(x, y);
+	clear_both();
+	srand(5);
+	for (i = 0; i < 5000; i++) {
+		op = rand() % 4;
+		x = rand() % (LCD_W + 40) - 20;
+		y = rand() % (LCD_H + 40) - 20;
+		//Moves of a few pixels, as sprites do, keep some registers equal
+		if (i % 2) {
+			x = (x % 8) + 100;
+			y = (y % 8) + 100;
+		}
+		call_start();
+		switch (op) {
+			case 0:
+				GLCD_Bitmap(x, y, SPR_W, SPR_H, (unsigned char *)bitmap);
+				ref_rect(x, y, SPR_W, SPR_H, full, bitmap, 0);
+				break;
+			case 1:
+				w = rand() % 30 + 1;
+				h = rand() % 3 ? rand() % 30 + 1 : 1;
+				GLCD_Fill(x, y, w, h, (unsigned short)i);
+				ref_rect(x, y, w, h, full, NULL, (unsigned short)i);
+				break;
+			case 2:
+				if (x < 0 || y < 0 || x >= LCD_W || y >= LCD_H)
+					break;
+				GLCD_SetTextColor((unsigned short)(i * 3));
+				GLCD_PutPixel(x, y);
+				ref[y][x] = (unsigned short)(i * 3);
+				break;
+			case 3:
+				GLCD_SetTextColor(White);
+				GLCD_SetBackColor(Black);
+				GLCD_DisplayChar(rand() % 10, rand() % 20, 1, '0' + rand() % 10);
+				//Characters are checked by the glyph test, keep the reference
+				memcpy(ref, LCD_Gram, sizeof(ref));
+				break;
+		}
+		call_end();
+		if (op != 3 && memcmp(LCD_Gram, ref, sizeof(ref)) != 0) {
+			bad++;
+			memcpy(ref, LCD_Gram, sizeof(ref));
+		}
+	}
+	CHECK(bad == 0);
+	CHECK(stats_bad == 0);
+	CHECK(LCD_Count.errors == 0);
+	printf("%s shadow: %u register writes sent, %u skipped over 5000 random calls\n",
+		be->name, LCD_Count.reg_writes - regs, GLCD_Stats()->reg_skipped - skipped);
+}
+
+/*----------------------------------------------------------------------------
+  GLCD_Blend of a source pixel over d, one color channel at a time
+ *----------------------------------------------------------------------------*/
+static unsigned short mix (unsigned short s, unsigned short d, unsigned int alpha) {
+	static const unsigned short field[3] = { 0xF800, 0x07E0, 0x001F };
+	unsigned int k, cs, cd, c, out = 0;
+
+	for (k = 0; k < 3; k++) {
+		cs = s & field[k];
+		cd = d & field[k];
+		if (alpha == GLCD_BLEND_ADD)
+			c = cs + cd > field[k] ? field[k] : cs + cd;
+		else
+			c = ((cs * alpha + cd * (GLCD_ALPHA_MAX - alpha)) / GLCD_ALPHA_MAX) & field[k];
+		out |= c;
+	}
+	return (unsigned short)out;
+}
+
+static void ref_blend (int x, int y, int w, int h, const unsigned short *bitmap, unsigned int alpha) {
+	int r, c;
+
+	for (r = 0; r < h; r++)
+		for (c = 0; c < w; c++)
+			if (x + c >= 0 && x + c < LCD_W && y + r >= 0 && y + r < LCD_H)
+				ref[y + r][x + c] = mix(bitmap[(h - 1 - r) * w + c], ref[y + r][x + c], alpha);
+}
+
+/* Something to read back and blend over, every pixel different             */
+static void background (void) {
+	int x, y;
+
+	for (y = 0; y < LCD_H; y++)
+		for (x = 0; x < LCD_W; x++)
+			LCD_Gram[y][x] = ref[y][x] = (unsigned short)(x * 2017 + y * 331);
+}
+
+/*----------------------------------------------------------------------------
+  GRAM readback through the controller's read format, blends against the
+  per channel reference, and what a blend costs next to an opaque blit
+ *----------------------------------------------------------------------------*/
+static void test_blend (void) {
+	static unsigned short bitmap[200 * 40], pix[SPR_W * SPR_H];
+	static const int full[4] = { 0, 0, LCD_W, LCD_H };
+	const U32 size = be->kind == LCD_HIMAX ? 3 : 2;   /* Bytes per pixel read  */
+	U32 bytes, opaque, blend, t;
+	int i, j;
+
+	for (i = 0; i < 200 * 40; i++)
+		bitmap[i] = (unsigned short)(i * 4099 + 7);
+
+	//Read: one dummy byte and one dummy pixel, then the pixels
+	background();
+	GLCD_Read(33, 21, SPR_W, SPR_H, pix);
+	call_start();
+	GLCD_Read(33, 21, SPR_W, SPR_H, pix);
+	bytes = call_end();
+	for (j = 0, i = 0; j < SPR_H * SPR_W; j++)
+		i += pix[j] != ref[21 + j / SPR_W][33 + j % SPR_W];
+	CHECK(i == 0);
+	CHECK(LCD_Count.pixels_read == 2 * SPR_W * SPR_H);
+	CHECK(bytes == call_regs * 6 + 3 + 2 + size * (1 + SPR_W * SPR_H));
+
+	//Weighted, added, opaque, invisible, and clipped across a corner
+	background();
+	GLCD_Blend(30, 20, SPR_W, SPR_H, (unsigned char *)bitmap, 16);
+	ref_blend(30, 20, SPR_W, SPR_H, bitmap, 16);
+	GLCD_Blend(60, 20, SPR_W, SPR_H, (unsigned char *)bitmap, 5);
+	ref_blend(60, 20, SPR_W, SPR_H, bitmap, 5);
+	GLCD_Blend(90, 20, SPR_W, SPR_H, (unsigned char *)bitmap, GLCD_BLEND_ADD);
+	ref_blend(90, 20, SPR_W, SPR_H, bitmap, GLCD_BLEND_ADD);
+	//Out of range alpha is opaque, not a wrapped mix
+	GLCD_Blend(120, 20, SPR_W, SPR_H, (unsigned char *)bitmap, 200);
+	ref_rect(120, 20, SPR_W, SPR_H, full, bitmap, 0);
+	GLCD_Blend(150, 20, SPR_W, SPR_H, (unsigned char *)bitmap, GLCD_BLEND_ADD - 1);
+	ref_rect(150, 20, SPR_W, SPR_H, full, bitmap, 0);
+	call_start();
+	GLCD_Blend(180, 20, SPR_W, SPR_H, (unsigned char *)bitmap, 0);
+	CHECK(call_end() == 0);
+	GLCD_Blend(-7, LCD_H - 5, SPR_W, SPR_H, (unsigned char *)bitmap, 16);
+	ref_blend(-7, LCD_H - 5, SPR_W, SPR_H, bitmap, 16);
+	//Wider than a third of the buffer: read and written a row at a time
+	GLCD_Blend(100, 150, 200, 40, (unsigned char *)bitmap, 9);
+	ref_blend(100, 150, 200, 40, bitmap, 9);
+	CHECK(memcmp(LCD_Gram, ref, sizeof(ref)) == 0);
+
+	//Cost of a sprite sized blend against the opaque blit it replaces
+	call_start();
+	GLCD_Bitmap(200, 100, SPR_W, SPR_H, (unsigned char *)bitmap);
+	opaque = call_end();
+	call_start();
+	t = LCD_Now();
+	GLCD_Blend(200, 100, SPR_W, SPR_H, (unsigned char *)bitmap, 16);
+	t = LCD_Now() - t;
+	blend = call_end();
+	CHECK(blend > opaque);
+	printf("%s blend: %dx%d %u bytes, %u us of SPI, opaque %u bytes, x%u.%02u\n",
+		be->name, SPR_W, SPR_H, blend, t, opaque, blend / opaque, blend * 100 / opaque % 100);
+
+	CHECK(stats_bad == 0);
+	CHECK(LCD_Count.errors == 0);
+}
+
+int main (void) {
+	int i;
+
+	for (i = 0; i < (int)(sizeof(backends) / sizeof(backends[0])); i++) {
+		boot(&backends[i]);
+		test_clip();
+		test_shadow();
+		test_random();
+		test_blend();
+	}
+
+	printf("glcd_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
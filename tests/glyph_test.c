@@ -0,0 +1,189 @@
+/*----------------------------------------------------------------------------
+ * Name:    glyph_test.c
+ * Purpose: host test and benchmark of the 16x24 glyph cache of the driver
+ * Note(s): Characters drawn with GLCD_DisplayChar go through the cache;
+ *          GLCD_DrawChar with the font is the path without it. Both draw
+ *          into lcd_model.c and are compared with the font expanded here,
+ *          also across color changes. Reported are the hit rate of three
+ *          kinds of text, the SPI bound rate on the model, and the host
+ *          rate of both paths with the link dropping the bytes.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include "RTL.h"
+#include "GLCD.h"
+#include "lcd_model.h"
+
+#define REPEAT      2000
+#define TRIALS      5
+
+extern const unsigned short Font_16x24_h[];
+
+static int to_model = 1;                /* 0: SSP bytes go nowhere            */
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/* The driver's SSP, built with -DGLCD_SSP=test_ssp                          */
+unsigned char test_ssp (unsigned char byte) {
+	return to_model ? LCD_Ssp(byte) : 0;
+}
+
+/*----------------------------------------------------------------------------
+  Character c at text line ln, column col shows in colors fg on bg
+ *----------------------------------------------------------------------------*/
+static int char_ok (int ln, int col, unsigned char c, unsigned short fg, unsigned short bg) {
+	const unsigned short *bits = &Font_16x24_h[(c - 32) * 24];
+	int x, y;
+
+	for (y = 0; y < 24; y++)
+		for (x = 0; x < 16; x++)
+			if (LCD_Gram[ln * 24 + y][col * 16 + x] != (((bits[y] >> x) & 1) ? fg : bg))
+				return 0;
+	return 1;
+}
+
+/*----------------------------------------------------------------------------
+  Random characters and colors on both paths, every one as the font says
+ *----------------------------------------------------------------------------*/
+static void test_draw (void) {
+	unsigned short fg = White, bg = Black;
+	int i, ln, col, bad = 0;
+	unsigned char c;
+
+	GLCD_SetTextColor(fg);
+	GLCD_SetBackColor(bg);
+	srand(40);
+	for (i = 0; i < 3000; i++) {
+		//Colors change now and then, a stale cached glyph would keep the old
+		if (rand() % 8 == 0) {
+			fg = (unsigned short)rand();
+			GLCD_SetTextColor(fg);
+		}
+		if (rand() % 8 == 0) {
+			bg = (unsigned short)rand();
+			GLCD_SetBackColor(bg);
+		}
+		c = (unsigned char)(32 + rand() % 95);
+		ln = rand() % 10;
+		col = rand() % 20;
+		if (i % 2)
+			GLCD_DisplayChar(ln, col, 1, c);
+		else
+			GLCD_DrawChar(col * 16, ln * 24, 16, 24, (unsigned char *)&Font_16x24_h[(c - 32) * 24]);
+		bad += !char_ok(ln, col, c, fg, bg);
+	}
+	CHECK(bad == 0);
+	CHECK(LCD_Count.errors == 0);
+}
+
+/*----------------------------------------------------------------------------
+  Hit rate of a text redrawn 'frames' times, line ln from column 0
+ *----------------------------------------------------------------------------*/
+static void hit_rate (const char *name, const char *const *text, int n_text, int frames) {
+	const GLCD_STATS *st = GLCD_Stats();
+	U32 hits = st->glyph_hits, misses = st->glyph_misses, total;
+	char line[24];
+	int f;
+
+	GLCD_SetTextColor(White);
+	GLCD_SetBackColor(Black);
+	for (f = 0; f < frames; f++) {
+		snprintf(line, sizeof(line), text[f % n_text], f);
+		GLCD_DisplayString(0, 0, 1, (unsigned char *)line);
+	}
+	hits = st->glyph_hits - hits;
+	misses = st->glyph_misses - misses;
+	total = hits + misses;
+	printf("glyphs: %-9s %5u chars, %3u.%u%% hits\n", name, total,
+		hits * 100 / total, hits * 1000 / total % 10);
+}
+
+static double seconds (void) {
+	return (double)clock() / CLOCKS_PER_SEC;
+}
+
+/*----------------------------------------------------------------------------
+  Best of TRIALS runs, characters per second of digits: expanded from the
+  font, from the cache with 4 digits (all hits), or through the cache with
+  10 digits in turn, which LRU over 8 slots never keeps (all misses)
+ *----------------------------------------------------------------------------*/
+#define EXPANDED    0
+#define HITS        1
+#define MISSES      2
+
+static double rate (int mode) {
+	double t, best = 1e9;
+	int i, j;
+	unsigned char c;
+
+	to_model = 0;
+	for (j = 0; j < TRIALS; j++) {
+		t = seconds();
+		for (i = 0; i < REPEAT; i++) {
+			c = (unsigned char)('0' + i % (mode == HITS ? 4 : 10));
+			if (mode == EXPANDED)
+				GLCD_DrawChar((i % 20) * 16, 0, 16, 24, (unsigned char *)&Font_16x24_h[(c - 32) * 24]);
+			else
+				GLCD_DisplayChar(0, i % 20, 1, c);
+		}
+		t = seconds() - t;
+		if (t < best)
+			best = t;
+	}
+	to_model = 1;
+	return REPEAT / best;
+}
+
+int main (void) {
+	//A score counter, a HUD line with it, the game over text, and every
+	//printable character
+	static const char *const score[] = { "%05d" };
+	static const char *const hud[] = { "SCORE %05d  WAVE 3" };
+	static const char *const over[] = {
+		"       zombies      ", "You have killed  %3d", "  New high score!   ",
+	};
+	static char all[95 * 4 / 20][24];
+	static const char *all_lines[95 * 4 / 20];
+	U32 bytes, us;
+	int i;
+
+	LCD_Reset(LCD_ILI, 0x9325);
+	GLCD_Init();
+	GLCD_ClipMax();
+
+	test_draw();
+
+	for (i = 0; i < 95 * 4; i++)
+		all[i / 20][i % 20] = (char)(32 + (i * 7) % 95);
+	for (i = 0; i < 95 * 4 / 20; i++)
+		all_lines[i] = all[i];
+	//No %, the lines go through snprintf
+	for (i = 0; i < 95 * 4; i++)
+		if (all[i / 20][i % 20] == '%')
+			all[i / 20][i % 20] = '#';
+
+	hit_rate("score", score, 1, 200);
+	hit_rate("hud", hud, 1, 200);
+	hit_rate("game over", over, 3, 30);
+	hit_rate("all", all_lines, 95 * 4 / 20, 19);
+
+	//On the link a character is its window and 768 pixel bytes either way
+	GLCD_DisplayChar(0, 0, 1, '7');
+	bytes = LCD_Count.bytes;
+	us = LCD_Now();
+	GLCD_DisplayChar(0, 1, 1, '7');
+	bytes = LCD_Count.bytes - bytes;
+	us = LCD_Now() - us;
+	printf("glyphs: %u SPI bytes a character, %u chars/s on the model\n", bytes, 1000000 / us);
+	printf("glyphs: host %.0f chars/s on hits, %.0f on misses, %.0f expanded\n",
+		rate(HITS), rate(MISSES), rate(EXPANDED));
+
+	printf("glyph_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
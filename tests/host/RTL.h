@@ -0,0 +1,70 @@
+/*----------------------------------------------------------------------------
+ * Name:    RTL.h
+ * Purpose: host stand-in for the RTX header, for the tests in tests/
+ * Note(s): Only the types and calls the host built modules use. There is
+ *          one thread on the host, so locking does nothing. The kernel
+ *          calls of the tasks are in rtx_model.c, for the tests that link
+ *          Blinky.c.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#ifndef __RTL_H
+#define __RTL_H
+
+#include <stdint.h>
+
+typedef signed char     S8;
+typedef unsigned char   U8;
+typedef short           S16;
+typedef unsigned short  U16;
+typedef int             S32;
+typedef unsigned int    U32;
+typedef long long       S64;
+typedef unsigned long long U64;
+typedef U32             OS_TID;
+typedef void           *OS_ID;
+typedef U32             OS_RESULT;
+
+typedef U32             OS_MUT[3];
+typedef U32             OS_SEM[2];
+
+#define __TRUE          1
+#define __FALSE         0
+
+#define OS_R_OK         0x00
+#define OS_R_TMO        0x01
+#define OS_R_EVT        0x02
+#define OS_R_SEM        0x03
+#define OS_R_MBX        0x04
+#define OS_R_MUT        0x05
+#define OS_R_NOK        0xff
+
+#define __task
+#define __irq
+
+static inline void tsk_lock (void) {}
+static inline void tsk_unlock (void) {}
+
+extern void      os_sys_init_user      (void (*task)(void), U8 prio, void *stk, U16 size);
+extern OS_TID    os_tsk_create_user_ex (void (*task)(void *), U8 prio, void *stk, U16 size, void *argv);
+extern OS_TID    os_tsk_self           (void);
+extern OS_RESULT os_tsk_prio_self      (U8 prio);
+extern OS_RESULT os_tsk_delete         (OS_TID task_id);
+extern void      os_tsk_delete_self    (void);
+extern void      os_evt_set            (U16 event_flags, OS_TID task_id);
+extern void      os_evt_clr            (U16 clear_flags, OS_TID task_id);
+extern OS_RESULT os_evt_wait_or        (U16 wait_flags, U16 timeout);
+extern OS_RESULT os_evt_wait_and       (U16 wait_flags, U16 timeout);
+extern void      os_mut_init           (OS_ID mutex);
+extern OS_RESULT os_mut_wait           (OS_ID mutex, U16 timeout);
+extern OS_RESULT os_mut_release        (OS_ID mutex);
+extern void      os_sem_init           (OS_ID semaphore, U16 token_count);
+extern OS_RESULT os_sem_send           (OS_ID semaphore);
+extern OS_RESULT os_sem_wait           (OS_ID semaphore, U16 timeout);
+extern void      os_dly_wait           (U16 delay_time);
+extern void      os_itv_set            (U16 interval_time);
+extern void      os_itv_wait           (void);
+extern U32       os_time_get           (void);
+
+#endif
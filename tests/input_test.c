@@ -0,0 +1,277 @@
+/*----------------------------------------------------------------------------
+ * Name:    input_test.c
+ * Purpose: host test of the joystick input path, from pin edge to the frame
+ * Note(s): TIMER0.c and JOYSTICK.c run as built for the board; the test is
+ *          the timer: TC counts microseconds, a match on MR0 calls
+ *          TIMER0_IRQHandler unless the interrupt is held off. Press and
+ *          release edges, each with contact bounce, are injected on the
+ *          direction pins at random times. Checked and reported are the
+ *          time from an edge to its event in the queue, the time stamp of
+ *          the event against the edge, the held share JOYSTICK_Collect
+ *          gives each frame against the real one, and that a tick held off
+ *          for several periods picks up again at once.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "RTL.h"
+#include "LPC17xx.H"
+#include "TIMER0.h"
+#include "JOYSTICK.h"
+
+#define T0          0xFFF00000          /* TC at the start, wraps in 1 s      */
+#define PERIOD      100000              /* FRAME_BUDGET_US in Blinky.c        */
+#define JITTER      5000                /* Human task start after FRAME_GO    */
+#define FRAMES      200
+#define EDGES       256                 /* Per direction                      */
+#define BOUNCE      900                 /* Longest bounce, under one sample   */
+#define TICK        1000
+
+typedef struct {
+	U32 at[EDGES];                        /* us from the start, down at even k  */
+	U32 bounce[EDGES];
+	int n;
+	int pin;                              /* Edges the pins are past            */
+} line_t;
+
+static line_t lines[JOY_DIRS];
+static U32 now;                         /* us from the start                  */
+static U32 held_until;                  /* Interrupt held off before this     */
+static int pending;
+static U32 ticks;
+static void (*drain)(void);
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*----------------------------------------------------------------------------
+  Alternating release and press times per direction, 20-300 ms up and
+  3-150 ms down, all up again before 'end'
+ *----------------------------------------------------------------------------*/
+static void script (U32 start, U32 end) {
+	line_t *l;
+	U32 t;
+	int dir;
+
+	for (dir = 0; dir < JOY_DIRS; dir++) {
+		l = &lines[dir];
+		l->n = 0;
+		l->pin = 0;
+		t = start + 20000 + rand() % 280000;
+		while (t + 153000 < end && l->n + 2 <= EDGES) {
+			l->at[l->n] = t;
+			l->bounce[l->n++] = rand() % BOUNCE;
+			t += 3000 + rand() % 147000;
+			l->at[l->n] = t;
+			l->bounce[l->n++] = rand() % BOUNCE;
+			t += 20000 + rand() % 280000;
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Drive the direction pins for time 'now', active low; in the bounce after
+  an edge they flip every 200 us
+ *----------------------------------------------------------------------------*/
+static void pins (void) {
+	U32 pin = LPC_GPIO1->FIOPIN | (POSITION_MASK << 23);
+	line_t *l;
+	int dir, down;
+
+	for (dir = 0; dir < JOY_DIRS; dir++) {
+		l = &lines[dir];
+		while (l->pin < l->n && l->at[l->pin] <= now)
+			l->pin++;
+		down = l->pin % 2;
+		if (l->pin > 0 && now - l->at[l->pin - 1] < l->bounce[l->pin - 1] && (now - l->at[l->pin - 1]) / 200 % 2 == 0)
+			down = !down;
+		if (down)
+			pin &= ~(1u << (23 + dir));
+	}
+	LPC_GPIO1->FIOPIN = pin;
+}
+
+/*----------------------------------------------------------------------------
+  Let 'us' microseconds pass: TC counts, MR0 matches raise the interrupt,
+  which runs once it is no longer held off
+ *----------------------------------------------------------------------------*/
+static void run (U32 us) {
+	while (us--) {
+		now++;
+		LPC_TIM0->TC++;
+		if ((LPC_TIM0->MCR & 1) && LPC_TIM0->TC == LPC_TIM0->MR0)
+			pending = 1;
+		if (pending && (S32)(now - held_until) >= 0) {
+			pending = 0;
+			ticks++;
+			pins();
+			TIMER0_IRQHandler();
+			if (drain != NULL)
+				drain();
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Edge to queue: every event is popped in the tick that queued it and
+  matched with its edge
+ *----------------------------------------------------------------------------*/
+static int seen[JOY_DIRS];
+static U32 queue_sum, queue_max, stamp_max, n_events;
+static int bad_events;
+
+static void pop (void) {
+	joy_event_t e;
+	line_t *l;
+	U32 edge, wait, stamp;
+
+	while (JOYSTICK_Event(&e)) {
+		l = &lines[e.dir];
+		if (seen[e.dir] >= l->n || e.down != (seen[e.dir] % 2 == 0)) {
+			bad_events++;
+			continue;
+		}
+		edge = l->at[seen[e.dir]++];
+		wait = now - edge;
+		stamp = e.us - T0 - edge;
+		//Stamped at the first sample past the bounce, queued at the next; the
+		//debounce is over all four pins, a change on another direction in
+		//between puts both off by one more sample
+		if (stamp > 3 * TICK || wait > 4 * TICK)
+			bad_events++;
+		queue_sum += wait;
+		if (wait > queue_max) queue_max = wait;
+		if (stamp > stamp_max) stamp_max = stamp;
+		n_events++;
+	}
+}
+
+static void test_queue (void) {
+	U32 start = now, edges = 0;
+	int dir;
+
+	script(start, start + FRAMES * PERIOD);
+	drain = pop;
+	run(FRAMES * PERIOD + 10000);
+	drain = NULL;
+	for (dir = 0; dir < JOY_DIRS; dir++) {
+		edges += lines[dir].n;
+		CHECK(seen[dir] == lines[dir].n);
+	}
+	CHECK(bad_events == 0);
+	CHECK(n_events == edges);
+	CHECK(JOYSTICK_Stats()->dropped == 0);
+	printf("input: %u edges, to the queue %u us avg, %u max; stamped %u us after the edge at most\n",
+		edges, queue_sum / (n_events ? n_events : 1), queue_max, stamp_max);
+}
+
+/*----------------------------------------------------------------------------
+  Time direction 'dir' was really down from a to b
+ *----------------------------------------------------------------------------*/
+static U32 held (int dir, U32 a, U32 b) {
+	const line_t *l = &lines[dir];
+	U32 sum = 0, s, e;
+	int k;
+
+	for (k = 0; k + 1 < l->n; k += 2) {
+		s = l->at[k] > a ? l->at[k] : a;
+		e = l->at[k + 1] < b ? l->at[k + 1] : b;
+		if (e > s)
+			sum += e - s;
+	}
+	return sum;
+}
+
+/*----------------------------------------------------------------------------
+  Frame to frame: JOYSTICK_Collect at the human task's times, the shares
+  against the pins; taps that start and end between two frames, which a
+  poll per frame never sees, must show
+ *----------------------------------------------------------------------------*/
+static void test_frames (void) {
+	const joy_stats_t *st = JOYSTICK_Stats();
+	U16 share[JOY_DIRS];
+	U32 start, prev, expect, tol, events = st->events;
+	U32 lat_sum = st->latency_sum, edges = 0, taps = 0, taps_seen = 0;
+	U32 share_err = 0, err;
+	int f, dir, k, bad = 0;
+
+	JOYSTICK_Collect(share);
+	start = prev = now;
+	script(start, start + FRAMES * PERIOD);
+	for (f = 0; f < FRAMES; f++) {
+		run(PERIOD - (now - start - f * PERIOD) + rand() % JITTER);
+		JOYSTICK_Collect(share);
+		for (dir = 0; dir < JOY_DIRS; dir++) {
+			//Each edge is stamped up to three samples late, see pop()
+			expect = held(dir, prev, now);
+			tol = 2 * 3 * TICK;
+			expect = expect * JOY_SHARE / (now - prev);
+			err = share[dir] > expect ? share[dir] - expect : expect - share[dir];
+			if (err > tol * JOY_SHARE / (now - prev) + 1)
+				bad++;
+			if (err > share_err) share_err = err;
+
+			for (k = 0; k + 1 < lines[dir].n; k += 2)
+				if (lines[dir].at[k] > prev && lines[dir].at[k + 1] + BOUNCE + 2 * TICK < now) {
+					taps++;
+					taps_seen += share[dir] > 0;
+				}
+		}
+		prev = now;
+	}
+	run(10000);
+	JOYSTICK_Collect(share);
+	for (dir = 0; dir < JOY_DIRS; dir++)
+		edges += lines[dir].n;
+	CHECK(bad == 0);
+	CHECK(taps_seen == taps);
+	CHECK(st->events - events == edges);
+	CHECK(st->dropped == 0);
+	CHECK(st->latency_max <= PERIOD + JITTER + 2 * TICK);
+	printf("input: %u taps inside a frame, %u seen (a poll per frame sees none)\n", taps, taps_seen);
+	printf("input: edge to frame %u us avg, %u max; share off by %u/%u at most\n",
+		(st->latency_sum - lat_sum) / (edges ? edges : 1), st->latency_max, share_err, JOY_SHARE);
+}
+
+/*----------------------------------------------------------------------------
+  The tick held off under and over a period: the first changes nothing,
+  the second loses whole ticks, counted, and the tick goes on from there
+ *----------------------------------------------------------------------------*/
+static void test_hold_off (void) {
+	U32 missed = TIMER0_Missed(), phase, count;
+
+	phase = LPC_TIM0->MR0 % TICK;
+	held_until = now + 900;
+	run(10000);
+	CHECK(TIMER0_Missed() == missed);
+	CHECK(LPC_TIM0->MR0 % TICK == phase);
+
+	//From a match, 3.5 periods: the next three matches are lost
+	run(LPC_TIM0->MR0 - LPC_TIM0->TC - 1);
+	held_until = now + 1 + 3 * TICK + TICK / 2;
+	run(1 + 3 * TICK + TICK / 2);
+	CHECK(TIMER0_Missed() - missed == 3);
+	count = ticks;
+	run(10 * TICK);
+	CHECK(ticks - count == 10);
+	printf("input: held off 3.5 ticks, %u missed, %u ticks in the next 10 ms\n",
+		TIMER0_Missed() - missed, ticks - count);
+}
+
+int main (void) {
+	srand(42);
+	LPC_GPIO1->FIOPIN = 0xFFFFFFFF;
+	JOYSTICK_Init();
+	//The counter starts close to the wrap, the first part crosses it
+	LPC_TIM0->TC = T0;
+	LPC_TIM0->MR0 = T0 + TICK;
+
+	test_queue();
+	test_frames();
+	test_hold_off();
+
+	printf("input_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
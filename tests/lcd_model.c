@@ -0,0 +1,241 @@
+/*----------------------------------------------------------------------------
+ * Name:    lcd_model.c
+ * Purpose: host model of the SSP1 link and the LCD controller behind it
+ * Note(s): A transfer starts with chip select going low, seen as the
+ *          driver's write to FIOCLR, and a start byte: 0x70 index write
+ *          (two bytes, the index in the second), 0x72 data write (16 bit
+ *          words, MSB first), 0x73 data read (one dummy byte, then the
+ *          register value MSB first). Anything else counts as an error.
+ *          A read of index 0x22 returns one dummy pixel and then the GRAM
+ *          from the address counter on, which moves as it does for writes:
+ *          16 bit words on the ILI932x, three bytes of 6 bit R, G and B,
+ *          left aligned, on the HX8347.
+ *
+ *          ILI932x in landscape: 0x50/0x51 are the first and last row of
+ *          the window, 0x52/0x53 the first and last column, 0x20/0x21 the
+ *          row and column of the GRAM cursor. Pixels go to the cursor,
+ *          which moves along the row and wraps inside the window.
+ *
+ *          HX8347 in landscape (0x16 = 0xA8): 0x02..0x05 are the first and
+ *          last column, 0x06..0x09 the first and last row, MSB and LSB in
+ *          separate registers. There is no cursor register, writing a
+ *          start register moves the address counter there. The datasheet
+ *          may also reset it on index 0x22; the model does not, so a start
+ *          register the driver wrongly skips leaves the pixels misplaced.
+ *
+ *          The bit banged ID read of the driver sees a floating pin and
+ *          reads 0, so the ID comes from register 0x00 over SSP.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "RTL.h"
+#include "LPC17xx.H"
+#include "TIMER0.h"
+#include "lcd_model.h"
+
+#define PIN_CS      (1 << 6)
+#define BYTE_NS     640                 /* 8 bits at 12.5 MHz                 */
+#define POLL_NS     1000                /* One TIMER0_Us call                 */
+
+unsigned short LCD_Gram[LCD_H][LCD_W];
+lcd_count_t    LCD_Count;
+
+static int  lcd_kind;
+static U16  lcd_reg[256];
+static U8   lcd_index;                  /* Last index written                 */
+static U8   lcd_start;                  /* Start byte of the transfer, 0 none */
+static U32  lcd_pos;                    /* Bytes since the start byte         */
+static U16  lcd_word;
+static U16  lcd_out;                    /* GRAM pixel being read              */
+static int  lcd_x, lcd_y;               /* GRAM address counter               */
+static U64  lcd_ns;
+
+/*----------------------------------------------------------------------------
+  Power on: every register 0, the GRAM black, the counters cleared
+ *----------------------------------------------------------------------------*/
+void LCD_Reset (int kind, U16 id) {
+	lcd_kind = kind;
+	memset(lcd_reg, 0, sizeof(lcd_reg));
+	memset(LCD_Gram, 0, sizeof(LCD_Gram));
+	memset(&LCD_Count, 0, sizeof(LCD_Count));
+	lcd_reg[0x00] = id;
+	lcd_index = 0;
+	lcd_start = 0;
+	lcd_x = lcd_y = 0;
+	LPC_GPIO0->FIOCLR = 0;
+}
+
+U16 LCD_Reg (int reg) {
+	return lcd_reg[reg & 0xFF];
+}
+
+/* Model time in microseconds                                                */
+U32 LCD_Now (void) {
+	return (U32)(lcd_ns / 1000);
+}
+
+/*----------------------------------------------------------------------------
+  A register write, the cursor registers move the address counter
+ *----------------------------------------------------------------------------*/
+static void lcd_write_reg (U8 reg, U16 val) {
+	lcd_reg[reg] = val;
+	LCD_Count.reg_writes++;
+	if (lcd_kind == LCD_HIMAX) {
+		if (reg == 0x02 || reg == 0x03)
+			lcd_x = (lcd_reg[0x02] & 0xFF) << 8 | (lcd_reg[0x03] & 0xFF);
+		if (reg == 0x06 || reg == 0x07)
+			lcd_y = (lcd_reg[0x06] & 0xFF) << 8 | (lcd_reg[0x07] & 0xFF);
+		return;
+	}
+	if (reg == 0x20)
+		lcd_y = val;
+	if (reg == 0x21)
+		lcd_x = val;
+}
+
+/*----------------------------------------------------------------------------
+  The window as x0, y0, x1, y1, last column and row included
+ *----------------------------------------------------------------------------*/
+static void lcd_window (int *w) {
+	if (lcd_kind == LCD_HIMAX) {
+		w[0] = (lcd_reg[0x02] & 0xFF) << 8 | (lcd_reg[0x03] & 0xFF);
+		w[2] = (lcd_reg[0x04] & 0xFF) << 8 | (lcd_reg[0x05] & 0xFF);
+		w[1] = (lcd_reg[0x06] & 0xFF) << 8 | (lcd_reg[0x07] & 0xFF);
+		w[3] = (lcd_reg[0x08] & 0xFF) << 8 | (lcd_reg[0x09] & 0xFF);
+	}
+	else {
+		w[0] = lcd_reg[0x52];
+		w[2] = lcd_reg[0x53];
+		w[1] = lcd_reg[0x50];
+		w[3] = lcd_reg[0x51];
+	}
+}
+
+/*----------------------------------------------------------------------------
+  The pixel at the address counter, which then moves on inside the window.
+  Returns 0 with an error counted if the counter or window is off the GRAM.
+ *----------------------------------------------------------------------------*/
+static unsigned short *lcd_next (void) {
+	unsigned short *p;
+	int w[4];
+
+	lcd_window(w);
+	if (lcd_x < 0 || lcd_x >= LCD_W || lcd_y < 0 || lcd_y >= LCD_H || w[2] >= LCD_W || w[3] >= LCD_H) {
+		LCD_Count.errors++;
+		return 0;
+	}
+	p = &LCD_Gram[lcd_y][lcd_x];
+	if (++lcd_x > w[2]) {
+		lcd_x = w[0];
+		if (++lcd_y > w[3])
+			lcd_y = w[1];
+	}
+	return p;
+}
+
+static void lcd_pixel (U16 color) {
+	unsigned short *p = lcd_next();
+
+	if (p) {
+		*p = color;
+		LCD_Count.pixels++;
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Byte n of a GRAM read, after the start byte and the dummy byte
+ *----------------------------------------------------------------------------*/
+static unsigned char lcd_read_gram (U32 n) {
+	unsigned short *p;
+	int size = lcd_kind == LCD_HIMAX ? 3 : 2;
+	int i = n % size;
+
+	if (n < (U32)size)
+		return 0xFF;                        /* Dummy pixel                        */
+	if (i == 0) {
+		p = lcd_next();
+		lcd_out = p ? *p : 0;
+		LCD_Count.pixels_read++;
+	}
+	if (size == 2)
+		return i == 0 ? lcd_out >> 8 : lcd_out & 0xFF;
+	//R and B widened to 6 bits as the controller stores them, left aligned
+	switch (i) {
+		case 0:  return ((lcd_out >> 11) << 1 | lcd_out >> 15) << 2;
+		case 1:  return ((lcd_out >> 5) & 0x3F) << 2;
+		default: return ((lcd_out & 0x1F) << 1 | (lcd_out >> 4 & 1)) << 2;
+	}
+}
+
+/*----------------------------------------------------------------------------
+  One byte each way on SSP1
+ *----------------------------------------------------------------------------*/
+unsigned char LCD_Ssp (unsigned char byte) {
+	unsigned char in = 0;
+
+	lcd_ns += BYTE_NS;
+	LCD_Count.bytes++;
+	if (LPC_GPIO0->FIOCLR & PIN_CS) {
+		//Chip select went low since the last byte, a new transfer
+		LPC_GPIO0->FIOCLR &= ~PIN_CS;
+		LCD_Count.frames++;
+		lcd_start = byte;
+		lcd_pos = 0;
+		if (byte != 0x70 && byte != 0x72 && byte != 0x73)
+			LCD_Count.errors++;
+		return 0;
+	}
+
+	lcd_pos++;
+	switch (lcd_start) {
+		case 0x70:
+			if (lcd_pos == 2)
+				lcd_index = byte;
+			else if (lcd_pos > 2 || byte != 0)
+				LCD_Count.errors++;
+			break;
+
+		case 0x72:
+			lcd_word = (lcd_word << 8) | byte;
+			if (lcd_pos % 2 != 0)
+				break;
+			if (lcd_index == 0x22)
+				lcd_pixel(lcd_word);
+			else if (lcd_pos == 2)
+				lcd_write_reg(lcd_index, lcd_word);
+			else
+				LCD_Count.errors++;
+			break;
+
+		case 0x73:
+			if (lcd_index == 0x22 && lcd_pos >= 2)
+				in = lcd_read_gram(lcd_pos - 2);
+			else if (lcd_pos == 2)
+				in = lcd_reg[lcd_index] >> 8;
+			else if (lcd_pos == 3)
+				in = lcd_reg[lcd_index] & 0xFF;
+			break;
+
+		default:
+			LCD_Count.errors++;
+			break;
+	}
+	return in;
+}
+
+/*----------------------------------------------------------------------------
+  TIMER0 on the model clock: polling costs a microsecond, waits pass time
+ *----------------------------------------------------------------------------*/
+void TIMER0_Init (void) {
+}
+
+uint32_t TIMER0_Us (void) {
+	lcd_ns += POLL_NS;
+	return LCD_Now();
+}
+
+void TIMER0_Wait (uint32_t us) {
+	lcd_ns += (U64)us * 1000 + POLL_NS;
+}
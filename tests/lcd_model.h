@@ -0,0 +1,42 @@
+/*----------------------------------------------------------------------------
+ * Name:    lcd_model.h
+ * Purpose: host model of the SSP1 link and the LCD controller behind it
+ * Note(s): GLCD_SPI_LPC1700.c is built with -DGLCD_SSP=LCD_Ssp, so every
+ *          byte the driver sends lands here. The model decodes the start
+ *          byte protocol, keeps the controller registers and a GRAM of
+ *          LCD_W x LCD_H pixels in the landscape layout the game uses, and
+ *          counts the traffic. TIMER0 is replaced by a clock driven by the
+ *          SPI bit rate.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __LCD_MODEL_H
+#define __LCD_MODEL_H
+
+#define LCD_W       320
+#define LCD_H       240
+
+#define LCD_ILI     0                   /* ILI932x, window and cursor registers */
+#define LCD_HIMAX   1                   /* HX8347, 8 bit window registers     */
+
+typedef struct {
+	U32 bytes;                            /* SPI bytes, start bytes included    */
+	U32 frames;                           /* Chip select cycles                 */
+	U32 reg_writes;                       /* Register writes, 0x22 excluded     */
+	U32 pixels;                           /* GRAM pixels written                */
+	U32 pixels_read;                      /* GRAM pixels read, dummy excluded   */
+	U32 errors;                           /* Protocol errors, see lcd_model.c   */
+} lcd_count_t;
+
+extern unsigned short LCD_Gram[LCD_H][LCD_W];
+extern lcd_count_t    LCD_Count;
+
+extern void          LCD_Reset   (int kind, U16 id);
+extern U16           LCD_Reg     (int reg);
+extern U32           LCD_Now     (void);
+extern unsigned char LCD_Ssp     (unsigned char byte);
+
+#endif
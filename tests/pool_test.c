@@ -0,0 +1,124 @@
+/*----------------------------------------------------------------------------
+ * Name:    pool_test.c
+ * Purpose: host test of the fixed-size object pool
+ * Note(s): Run with 'make -C tests'.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include "RTL.h"
+#include "pool.h"
+
+#define ITEMS 8
+
+typedef struct {
+	U16 x, y;
+	U8  kind;
+} item_t;
+
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*----------------------------------------------------------------------------
+  Slots come back in LIFO order and every slot is handed out once
+ *----------------------------------------------------------------------------*/
+static void test_order (void) {
+	item_t items[ITEMS];
+	pool_t pool;
+	item_t *a, *b, *c;
+
+	POOL_Init(&pool, items, sizeof(item_t), ITEMS);
+	a = POOL_Alloc(&pool);
+	b = POOL_Alloc(&pool);
+	CHECK(a == &items[0]);
+	CHECK(b == &items[1]);
+	CHECK(POOL_Used(&pool) == 2);
+	CHECK(POOL_Item(&pool, 0) == a);
+	CHECK(POOL_Item(&pool, 2) == NULL);
+
+	POOL_Free(&pool, a);
+	CHECK(POOL_Used(&pool) == 1);
+	CHECK(POOL_Item(&pool, 0) == NULL);
+	c = POOL_Alloc(&pool);
+	CHECK(c == a);                        /* The last freed slot is reused first */
+}
+
+/*----------------------------------------------------------------------------
+  A full pool returns NULL, freeing one slot makes room again
+ *----------------------------------------------------------------------------*/
+static void test_exhaustion (void) {
+	item_t items[ITEMS];
+	item_t *got[ITEMS];
+	pool_t pool;
+	int i, j;
+
+	POOL_Init(&pool, items, sizeof(item_t), ITEMS);
+	for (i = 0; i < ITEMS; i++) {
+		got[i] = POOL_Alloc(&pool);
+		CHECK(got[i] != NULL);
+		for (j = 0; j < i; j++)
+			CHECK(got[j] != got[i]);
+	}
+	CHECK(POOL_Full(&pool));
+	CHECK(POOL_Alloc(&pool) == NULL);
+	CHECK(POOL_Used(&pool) == ITEMS);
+
+	POOL_Free(&pool, got[5]);
+	CHECK(!POOL_Full(&pool));
+	CHECK(POOL_Alloc(&pool) == got[5]);
+	CHECK(POOL_Alloc(&pool) == NULL);
+}
+
+/*----------------------------------------------------------------------------
+  A second free of the same slot changes nothing
+ *----------------------------------------------------------------------------*/
+static void test_double_free (void) {
+	item_t items[ITEMS];
+	pool_t pool;
+	item_t *a, *b;
+
+	POOL_Init(&pool, items, sizeof(item_t), ITEMS);
+	a = POOL_Alloc(&pool);
+	b = POOL_Alloc(&pool);
+	POOL_Free(&pool, a);
+	POOL_Free(&pool, a);
+	CHECK(POOL_Used(&pool) == 1);
+	CHECK(POOL_Alloc(&pool) == a);
+	CHECK(POOL_Alloc(&pool) == &items[2]); /* a is not on the free list twice  */
+	CHECK(POOL_Item(&pool, 1) == b);
+}
+
+/*----------------------------------------------------------------------------
+  Pointers outside the slots, or inside one but not at its start, are
+  ignored, including one a multiple of 256 slots past the storage
+ *----------------------------------------------------------------------------*/
+static void test_foreign (void) {
+	static item_t items[ITEMS + 260];     /* Room for the far pointer         */
+	item_t other;
+	pool_t pool;
+	int i;
+
+	POOL_Init(&pool, items, sizeof(item_t), ITEMS);
+	for (i = 0; i < ITEMS; i++)
+		POOL_Alloc(&pool);
+
+	POOL_Free(&pool, &other);
+	POOL_Free(&pool, NULL);
+	POOL_Free(&pool, &items[ITEMS]);
+	POOL_Free(&pool, &items[259]);        /* Slot 3 if the index wraps at 256 */
+	POOL_Free(&pool, (unsigned char *)&items[1] + 1);
+	CHECK(POOL_Used(&pool) == ITEMS);
+	CHECK(POOL_Item(&pool, 3) == &items[3]);
+}
+
+int main (void) {
+	test_order();
+	test_exhaustion();
+	test_double_free();
+	test_foreign();
+
+	printf("pool_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
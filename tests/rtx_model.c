@@ -0,0 +1,442 @@
+/*----------------------------------------------------------------------------
+ * Name:    rtx_model.c
+ * Purpose: host model of the RTX kernel calls the game tasks make
+ * Note(s): See rtx_model.h. A mutex keeps its owner task id and lock count
+ *          in the first two words of OS_MUT and counts its waits and
+ *          releases in the third, a semaphore its tokens in the first word
+ *          of OS_SEM. Task ids are the slot plus one.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <ucontext.h>
+#include "RTL.h"
+#include "TIMER0.h"
+#include "lcd_model.h"
+#include "rtx_model.h"
+
+#define TASKS       16
+#define STACK       (256 * 1024)        /* Host frames are bigger than RTX's  */
+#define NEVER       0xFFFFFFFF
+
+#define FREE        0
+#define READY       1
+#define WAIT_EVT    2
+#define WAIT_MUT    3
+#define WAIT_SEM    4
+#define WAIT_DLY    5
+
+typedef struct {
+	ucontext_t ctx;
+	char      *stack;
+	void     (*task)(void *);
+	void      *argv;
+	U8         prio;
+	int        state;
+	U32        seq;                         /* Order it became ready in           */
+	U16        events;
+	U16        wait;                        /* Flags waited for                   */
+	int        all;                         /* os_evt_wait_and                    */
+	U32       *obj;                         /* Mutex or semaphore waited for      */
+	U32        wake;                        /* Tick a timed wait ends, or NEVER   */
+	U32        itv_next;
+	U16        itv;
+	int        owns;                        /* Mutexes held                       */
+	OS_RESULT  result;
+} task_t;
+
+rtx_count_t RTX_Count;
+void      (*RTX_Hook)(void);
+
+static task_t     tasks[TASKS];
+static int        cur = -1;
+static U32        seq;
+static U32        until;
+static ucontext_t run_ctx, boot_ctx;
+static volatile int stopped;
+
+static U32 tick (void) {
+	return LCD_Now() / RTX_TICK_US;
+}
+
+static void ready (task_t *t, OS_RESULT result) {
+	t->state = READY;
+	t->seq = ++seq;
+	t->wake = NEVER;
+	t->result = result;
+}
+
+/*----------------------------------------------------------------------------
+  Highest priority ready task, the one ready longest among equals; the
+  running task keeps the CPU against its equals
+ *----------------------------------------------------------------------------*/
+static int pick (void) {
+	int i, best = -1;
+
+	for (i = 0; i < TASKS; i++) {
+		if (tasks[i].state != READY)
+			continue;
+		if (best < 0 || tasks[i].prio > tasks[best].prio)
+			best = i;
+		else if (tasks[i].prio == tasks[best].prio && best != cur && (i == cur || tasks[i].seq < tasks[best].seq))
+			best = i;
+	}
+	return best;
+}
+
+static void timers (void) {
+	U32 now = tick();
+	int i;
+
+	for (i = 0; i < TASKS; i++)
+		if (tasks[i].state > READY && tasks[i].wake != NEVER && (S32)(now - tasks[i].wake) >= 0)
+			ready(&tasks[i], OS_R_TMO);
+}
+
+static void stop (void) {
+	stopped = 1;
+	setcontext(&run_ctx);
+}
+
+/*----------------------------------------------------------------------------
+  Nothing to run: pass the time to the next wake up
+ *----------------------------------------------------------------------------*/
+static void idle (void) {
+	U32 wake = NEVER;
+	int i;
+
+	for (i = 0; i < TASKS; i++)
+		if (tasks[i].state > READY && tasks[i].wake != NEVER && (wake == NEVER || (S32)(tasks[i].wake - wake) < 0))
+			wake = tasks[i].wake;
+	if (wake == NEVER) {
+		RTX_Count.deadlock++;
+		stop();
+	}
+	TIMER0_Wait(wake * RTX_TICK_US - LCD_Now());
+	if ((S32)(LCD_Now() - until) >= 0)
+		stop();
+	timers();
+}
+
+/*----------------------------------------------------------------------------
+  Run the task that should run now
+ *----------------------------------------------------------------------------*/
+static void dispatch (void) {
+	int next, prev = cur;
+
+	timers();
+	while ((next = pick()) < 0)
+		idle();
+	if (next == prev)
+		return;
+	cur = next;
+	RTX_Count.switches++;
+	if (tasks[prev].state == FREE)
+		setcontext(&tasks[next].ctx);
+	else
+		swapcontext(&tasks[prev].ctx, &tasks[next].ctx);
+}
+
+static void enter (void) {
+	if (RTX_Hook != NULL)
+		RTX_Hook();
+	if ((S32)(LCD_Now() - until) >= 0)
+		stop();
+}
+
+static void start (void) {
+	tasks[cur].task(tasks[cur].argv);
+	os_tsk_delete_self();
+}
+
+static OS_TID create (void (*task)(void *), U8 prio, void *argv) {
+	task_t *t;
+	int i;
+
+	for (i = 0; i < TASKS && tasks[i].state != FREE; i++);
+	if (i == TASKS)
+		return 0;
+	t = &tasks[i];
+	if (t->stack == NULL)
+		t->stack = malloc(STACK);
+	getcontext(&t->ctx);
+	t->ctx.uc_stack.ss_sp = t->stack;
+	t->ctx.uc_stack.ss_size = STACK;
+	t->ctx.uc_link = NULL;
+	makecontext(&t->ctx, start, 0);
+	t->task = task;
+	t->argv = argv;
+	t->prio = prio;
+	t->events = 0;
+	t->owns = 0;
+	t->itv = 0;
+	ready(t, OS_R_OK);
+	return (OS_TID)(i + 1);
+}
+
+/*----------------------------------------------------------------------------
+  Boot with the game's main(), which ends in os_sys_init_user; return when
+  the model clock reaches 'until_us' or the tasks deadlock
+ *----------------------------------------------------------------------------*/
+void RTX_Run (void (*boot)(void), U32 until_us) {
+	until = until_us;
+	stopped = 0;
+	getcontext(&run_ctx);
+	if (!stopped)
+		boot();
+}
+
+U32 RTX_Calls (const rtx_count_t *c) {
+	return c->evt_set + c->evt_wait + c->mut_wait + c->mut_release +
+	       c->sem_send + c->sem_wait + c->dly_wait + c->tsk;
+}
+
+/* Waits and releases of one mutex since os_mut_init                          */
+U32 RTX_MutOps (OS_ID mutex) {
+	return ((U32 *)mutex)[2];
+}
+
+void os_sys_init_user (void (*task)(void), U8 prio, void *stk, U16 size) {
+	(void)stk;
+	(void)size;
+	cur = create((void (*)(void *))task, prio, NULL) - 1;
+	swapcontext(&boot_ctx, &tasks[cur].ctx);
+}
+
+OS_TID os_tsk_create_user_ex (void (*task)(void *), U8 prio, void *stk, U16 size, void *argv) {
+	OS_TID id;
+
+	(void)stk;
+	(void)size;
+	enter();
+	RTX_Count.tsk++;
+	id = create(task, prio, argv);
+	dispatch();
+	return id;
+}
+
+OS_TID os_tsk_self (void) {
+	enter();
+	RTX_Count.tsk++;
+	return (OS_TID)(cur + 1);
+}
+
+OS_RESULT os_tsk_prio_self (U8 prio) {
+	enter();
+	RTX_Count.tsk++;
+	tasks[cur].prio = prio;
+	dispatch();
+	return OS_R_OK;
+}
+
+OS_RESULT os_tsk_delete (OS_TID task_id) {
+	task_t *t = &tasks[task_id - 1];
+
+	if (task_id == (OS_TID)(cur + 1)) {
+		os_tsk_delete_self();
+		return OS_R_OK;
+	}
+	enter();
+	RTX_Count.tsk++;
+	if (t->state == FREE)
+		return OS_R_NOK;
+	if (t->owns > 0)
+		RTX_Count.deleted_owner++;
+	t->state = FREE;
+	return OS_R_OK;
+}
+
+void os_tsk_delete_self (void) {
+	enter();
+	RTX_Count.tsk++;
+	if (tasks[cur].owns > 0)
+		RTX_Count.deleted_owner++;
+	tasks[cur].state = FREE;
+	dispatch();
+}
+
+void os_evt_set (U16 event_flags, OS_TID task_id) {
+	task_t *t = &tasks[task_id - 1];
+
+	enter();
+	RTX_Count.evt_set++;
+	t->events |= event_flags;
+	if (t->state == WAIT_EVT && (t->all ? (t->events & t->wait) == t->wait : (t->events & t->wait) != 0)) {
+		t->events &= ~t->wait;
+		ready(t, OS_R_EVT);
+	}
+	dispatch();
+}
+
+void os_evt_clr (U16 clear_flags, OS_TID task_id) {
+	enter();
+	RTX_Count.evt_set++;
+	tasks[task_id - 1].events &= ~clear_flags;
+}
+
+static OS_RESULT evt_wait (U16 wait_flags, U16 timeout, int all) {
+	task_t *t = &tasks[cur];
+
+	enter();
+	RTX_Count.evt_wait++;
+	if (all ? (t->events & wait_flags) == wait_flags : (t->events & wait_flags) != 0) {
+		t->events &= ~wait_flags;
+		return OS_R_EVT;
+	}
+	if (timeout == 0)
+		return OS_R_TMO;
+	t->state = WAIT_EVT;
+	t->wait = wait_flags;
+	t->all = all;
+	t->wake = timeout == 0xFFFF ? NEVER : tick() + timeout;
+	dispatch();
+	return t->result;
+}
+
+OS_RESULT os_evt_wait_or (U16 wait_flags, U16 timeout) {
+	return evt_wait(wait_flags, timeout, 0);
+}
+
+OS_RESULT os_evt_wait_and (U16 wait_flags, U16 timeout) {
+	return evt_wait(wait_flags, timeout, 1);
+}
+
+void os_mut_init (OS_ID mutex) {
+	U32 *m = mutex;
+
+	m[0] = 0;
+	m[1] = 0;
+	m[2] = 0;
+}
+
+OS_RESULT os_mut_wait (OS_ID mutex, U16 timeout) {
+	task_t *t = &tasks[cur];
+	U32 *m = mutex;
+
+	enter();
+	RTX_Count.mut_wait++;
+	m[2]++;
+	if (m[0] == 0 || m[0] == (U32)(cur + 1)) {
+		if (m[1]++ == 0) {
+			m[0] = cur + 1;
+			t->owns++;
+		}
+		return OS_R_OK;
+	}
+	RTX_Count.mut_blocked++;
+	if (timeout == 0)
+		return OS_R_TMO;
+	t->state = WAIT_MUT;
+	t->obj = m;
+	t->wake = timeout == 0xFFFF ? NEVER : tick() + timeout;
+	dispatch();
+	return t->result;
+}
+
+/*----------------------------------------------------------------------------
+  The next owner is the highest priority task waiting, it was counted in
+  os_mut_wait
+ *----------------------------------------------------------------------------*/
+OS_RESULT os_mut_release (OS_ID mutex) {
+	U32 *m = mutex;
+	int i, next = -1;
+
+	enter();
+	RTX_Count.mut_release++;
+	m[2]++;
+	if (m[0] != (U32)(cur + 1))
+		return OS_R_NOK;
+	if (--m[1] != 0)
+		return OS_R_OK;
+	tasks[cur].owns--;
+	m[0] = 0;
+	for (i = 0; i < TASKS; i++)
+		if (tasks[i].state == WAIT_MUT && tasks[i].obj == m &&
+		    (next < 0 || tasks[i].prio > tasks[next].prio))
+			next = i;
+	if (next >= 0) {
+		m[0] = next + 1;
+		m[1] = 1;
+		tasks[next].owns++;
+		ready(&tasks[next], OS_R_MUT);
+	}
+	dispatch();
+	return OS_R_OK;
+}
+
+void os_sem_init (OS_ID semaphore, U16 token_count) {
+	U32 *s = semaphore;
+
+	s[0] = token_count;
+}
+
+OS_RESULT os_sem_send (OS_ID semaphore) {
+	U32 *s = semaphore;
+	int i, next = -1;
+
+	enter();
+	RTX_Count.sem_send++;
+	for (i = 0; i < TASKS; i++)
+		if (tasks[i].state == WAIT_SEM && tasks[i].obj == s &&
+		    (next < 0 || tasks[i].prio > tasks[next].prio))
+			next = i;
+	if (next >= 0)
+		ready(&tasks[next], OS_R_SEM);
+	else
+		s[0]++;
+	dispatch();
+	return OS_R_OK;
+}
+
+OS_RESULT os_sem_wait (OS_ID semaphore, U16 timeout) {
+	task_t *t = &tasks[cur];
+	U32 *s = semaphore;
+
+	enter();
+	RTX_Count.sem_wait++;
+	if (s[0] > 0) {
+		s[0]--;
+		return OS_R_OK;
+	}
+	if (timeout == 0)
+		return OS_R_TMO;
+	t->state = WAIT_SEM;
+	t->obj = s;
+	t->wake = timeout == 0xFFFF ? NEVER : tick() + timeout;
+	dispatch();
+	return t->result;
+}
+
+void os_dly_wait (U16 delay_time) {
+	task_t *t = &tasks[cur];
+
+	enter();
+	RTX_Count.dly_wait++;
+	t->state = WAIT_DLY;
+	t->wake = tick() + delay_time;
+	dispatch();
+}
+
+void os_itv_set (U16 interval_time) {
+	tasks[cur].itv = interval_time;
+	tasks[cur].itv_next = tick() + interval_time;
+}
+
+void os_itv_wait (void) {
+	task_t *t = &tasks[cur];
+	U32 wake = t->itv_next;
+
+	enter();
+	RTX_Count.dly_wait++;
+	t->itv_next += t->itv;
+	if ((S32)(tick() - wake) >= 0)
+		return;
+	t->state = WAIT_DLY;
+	t->wake = wake;
+	dispatch();
+}
+
+U32 os_time_get (void) {
+	return tick();
+}
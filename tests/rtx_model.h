@@ -0,0 +1,45 @@
+/*----------------------------------------------------------------------------
+ * Name:    rtx_model.h
+ * Purpose: host model of the RTX kernel calls the game tasks make
+ * Note(s): Every task runs on its own host stack and the highest priority
+ *          ready task runs, as in RTX with round robin off. A task gives
+ *          up the CPU only inside a kernel call, so a higher priority task
+ *          whose delay ran out waits for the next call of the running
+ *          one. Time is the clock of lcd_model.c; when no task is ready
+ *          it jumps to the next wake up. Mutexes have no priority
+ *          inheritance. The calls that signal, wait or manage tasks
+ *          are counted.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __RTX_MODEL_H
+#define __RTX_MODEL_H
+
+#define RTX_TICK_US 10000               /* OS_TICK in RTX_Conf_CM.c           */
+
+typedef struct {
+	U32 evt_set;                          /* os_evt_set and os_evt_clr          */
+	U32 evt_wait;
+	U32 mut_wait;
+	U32 mut_release;
+	U32 mut_blocked;                      /* os_mut_wait that had to wait       */
+	U32 sem_send;
+	U32 sem_wait;
+	U32 dly_wait;                         /* os_dly_wait and os_itv_wait        */
+	U32 tsk;                              /* Create, delete, self, priority     */
+	U32 switches;                         /* Task switches                      */
+	U32 deleted_owner;                    /* Deleted holding a mutex            */
+	U32 deadlock;                         /* No task ready and none to wake     */
+} rtx_count_t;
+
+extern rtx_count_t RTX_Count;
+extern void      (*RTX_Hook)(void);     /* Called at the start of every call  */
+
+extern void RTX_Run   (void (*boot)(void), U32 until_us);
+extern U32  RTX_Calls (const rtx_count_t *count);
+extern U32  RTX_MutOps(OS_ID mutex);
+
+#endif
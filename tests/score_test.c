@@ -0,0 +1,372 @@
+/*----------------------------------------------------------------------------
+ * Name:    score_test.c
+ * Purpose: host test of the score log against emulated flash
+ * Note(s): The two log sectors are a file mapped at SCORE_FLASH_BASE, and
+ *          the IAP entry of score.c is replaced by host_iap. It erases to
+ *          0xFF, programs by clearing bits and checks the prepare, address
+ *          and clock arguments the way the boot ROM does. Each call adds
+ *          the datasheet time, 100 ms an erase and 1 ms a page, to a flash
+ *          clock. A reset is a longjmp out of an armed call, leaving part
+ *          of the page programmed or part of the sector erased, and a
+ *          reboot maps the file again and runs SCORE_Init.
+ *          Built without PIE, so the RAM score.c hands the IAP fits in
+ *          the U32 command words as on the device.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "RTL.h"
+#include "LPC17xx.H"
+#include "score.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE MAP_FIXED
+#endif
+
+#define FLASH_SIZE   (2 * SCORE_SECTOR_SIZE)
+#define ERASE_US     100000             /* Sector erase, datasheet            */
+#define PROGRAM_US   1000               /* 256 byte page, datasheet           */
+#define GAMES        700                /* Wraps the two sectors twice        */
+
+#define IAP_SUCCESS          0
+#define IAP_INVALID_COMMAND  1
+#define IAP_SRC_ADDR_ERROR   2
+#define IAP_DST_ADDR_ERROR   3
+#define IAP_COUNT_ERROR      6
+#define IAP_INVALID_SECTOR   7
+#define IAP_NOT_PREPARED     9
+
+static FILE *flash_file;
+static U8   *flash;
+static U8    prepared;                  /* Sector bits, cleared by each write */
+static U32   flash_us, call_us, worst_us;
+static U32   erases[2], programs;
+static int   tear_at = -1;              /* Bytes done when the reset hits     */
+static int   tear_erase;                /* Tear the next erase, not a program */
+static int   stuck_page = -1;           /* Page with a bit that stays 1       */
+static jmp_buf reset;
+static int   failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*----------------------------------------------------------------------------
+  Map the flash file at the address score.c reads
+ *----------------------------------------------------------------------------*/
+static void flash_map (void) {
+	void *p = mmap((void *)(uintptr_t)SCORE_FLASH_BASE, FLASH_SIZE, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_FIXED_NOREPLACE, fileno(flash_file), 0);
+
+	if (p != (void *)(uintptr_t)SCORE_FLASH_BASE) {
+		perror("score_test: mmap at SCORE_FLASH_BASE");
+		exit(2);
+	}
+	flash = p;
+}
+
+/* Power cycle: the RAM of score.c is gone, the file keeps the flash         */
+static void reboot (void) {
+	munmap(flash, FLASH_SIZE);
+	flash_map();
+	prepared = 0;
+	SCORE_Init();
+}
+
+/*----------------------------------------------------------------------------
+  The boot ROM as score.c uses it: prepare, copy RAM to flash, erase
+ *----------------------------------------------------------------------------*/
+void host_iap (U32 *cmd, U32 *result) {
+	U8 *dst;
+	const U8 *src;
+	int sector, i, n;
+
+	switch (cmd[0]) {
+		case 50:
+			if (cmd[1] < SCORE_SECTOR || cmd[2] > SCORE_SECTOR + 1 || cmd[2] < cmd[1]) {
+				result[0] = IAP_INVALID_SECTOR;
+				return;
+			}
+			for (i = cmd[1]; i <= (int)cmd[2]; i++)
+				prepared |= 1 << (i - SCORE_SECTOR);
+			break;
+
+		case 51:
+			dst = (U8 *)(uintptr_t)cmd[1];
+			src = (const U8 *)(uintptr_t)cmd[2];
+			if (dst < flash || dst >= flash + FLASH_SIZE || (cmd[1] % SCORE_PAGE) != 0) {
+				result[0] = IAP_DST_ADDR_ERROR;
+				return;
+			}
+			if ((cmd[2] & 3) != 0) {
+				result[0] = IAP_SRC_ADDR_ERROR;
+				return;
+			}
+			if (cmd[3] != SCORE_PAGE || cmd[4] != SystemCoreClock / 1000) {
+				result[0] = IAP_COUNT_ERROR;
+				return;
+			}
+			if (!(prepared & (1 << ((dst - flash) / SCORE_SECTOR_SIZE)))) {
+				result[0] = IAP_NOT_PREPARED;
+				return;
+			}
+			n = (tear_at >= 0 && !tear_erase) ? tear_at : SCORE_PAGE;
+			for (i = 0; i < n; i++)
+				dst[i] &= src[i];
+			//A stuck bit in the magic, one that should have been cleared
+			if ((dst - flash) / SCORE_PAGE == stuck_page)
+				dst[0] |= (U8)(~src[0] & (src[0] + 1));
+			flash_us += PROGRAM_US;
+			call_us += PROGRAM_US;
+			programs++;
+			if (n < SCORE_PAGE) {
+				tear_at = -1;
+				longjmp(reset, 1);
+			}
+			break;
+
+		case 52:
+			sector = cmd[1] - SCORE_SECTOR;
+			if (cmd[1] != cmd[2] || sector < 0 || sector > 1 || cmd[3] != SystemCoreClock / 1000) {
+				result[0] = IAP_INVALID_SECTOR;
+				return;
+			}
+			if (!(prepared & (1 << sector))) {
+				result[0] = IAP_NOT_PREPARED;
+				return;
+			}
+			n = (tear_at >= 0 && tear_erase) ? tear_at : SCORE_SECTOR_SIZE;
+			memset(flash + sector * SCORE_SECTOR_SIZE, 0xFF, n);
+			flash_us += ERASE_US;
+			call_us += ERASE_US;
+			erases[sector]++;
+			if (n < SCORE_SECTOR_SIZE) {
+				tear_at = -1;
+				tear_erase = 0;
+				longjmp(reset, 1);
+			}
+			break;
+
+		default:
+			result[0] = IAP_INVALID_COMMAND;
+			return;
+	}
+	//Programming and erasing need a prepare of their own
+	if (cmd[0] != 50)
+		prepared = 0;
+	result[0] = IAP_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------
+  One finished game: add it and save, the flash time it blocked for kept
+ *----------------------------------------------------------------------------*/
+static int play (int kills) {
+	int ok;
+
+	SCORE_Add(kills);
+	call_us = 0;
+	ok = SCORE_Save();
+	if (call_us > worst_us)
+		worst_us = call_us;
+	return ok;
+}
+
+static int same_table (const score_table_t *a, const score_table_t *b) {
+	return memcmp(a, b, sizeof(*a)) == 0;
+}
+
+/*----------------------------------------------------------------------------
+  Blank flash gives an empty table, and the first save needs an erase
+ *----------------------------------------------------------------------------*/
+static void test_blank (void) {
+	score_table_t zero;
+
+	memset(&zero, 0, sizeof(zero));
+	memset(flash, 0xFF, FLASH_SIZE);
+	reboot();
+	CHECK(same_table(SCORE_Table(), &zero));
+	CHECK(SCORE_Save() == 1);               /* Nothing to save                   */
+	CHECK(programs == 0);
+	CHECK(play(5) == 1);
+	CHECK(erases[0] == 1 && programs == 1);
+}
+
+/*----------------------------------------------------------------------------
+  GAMES saves around both sectors, rebooting between some of them
+ *----------------------------------------------------------------------------*/
+static void test_wrap (void) {
+	score_table_t saved;
+	int g, bad = 0;
+
+	memset(flash, 0xFF, FLASH_SIZE);
+	memset(erases, 0, sizeof(erases));
+	programs = flash_us = worst_us = 0;
+	reboot();
+
+	srand(1);
+	for (g = 0; g < GAMES; g++) {
+		if (!play(rand() % 300))
+			bad++;
+		saved = *SCORE_Table();
+		if (g % 37 == 0 || g % SCORE_PAGES_PER_SECTOR == SCORE_PAGES_PER_SECTOR - 1) {
+			reboot();
+			if (!same_table(SCORE_Table(), &saved))
+				bad++;
+		}
+	}
+	CHECK(bad == 0);
+	CHECK(SCORE_Table()->games == GAMES);
+	CHECK(programs == GAMES);
+	//A sector is erased each time the log enters it
+	CHECK(erases[0] + erases[1] == (GAMES + SCORE_PAGES_PER_SECTOR - 1) / SCORE_PAGES_PER_SECTOR);
+	printf("wrap: %d games, %u + %u erases, flash busy %u ms, worst save %u ms\n", GAMES,
+		erases[0], erases[1], flash_us / 1000, worst_us / 1000);
+}
+
+/*----------------------------------------------------------------------------
+  A reset in the middle of a save loses that game only, wherever it hits
+ *----------------------------------------------------------------------------*/
+static void test_torn (void) {
+	static const int cuts[] = { 0, 2, 4, 8, 40, SCORE_PAGE - 4, SCORE_PAGE - 1 };
+	score_table_t saved;
+	int g, cut;
+	volatile int tears = 0, bad = 0;       /* Kept across the reset            */
+
+	memset(flash, 0xFF, FLASH_SIZE);
+	reboot();
+
+	srand(2);
+	for (g = 0; g < GAMES; g++) {
+		saved = *SCORE_Table();
+		cut = -1;
+		//Every few games, and on the first page of each sector
+		if (g % 11 == 3 || g % SCORE_PAGES_PER_SECTOR == 0)
+			cut = cuts[g % (sizeof(cuts) / sizeof(cuts[0]))];
+		if (cut < 0) {
+			if (!play(rand() % 300))
+				bad++;
+			continue;
+		}
+
+		tear_at = cut;
+		if (setjmp(reset) == 0) {
+			play(rand() % 300);
+			bad++;                             /* The reset never came              */
+			tear_at = -1;
+			continue;
+		}
+		tears++;
+		reboot();
+		if (!same_table(SCORE_Table(), &saved))
+			bad++;
+		//The log carries on after the torn page
+		if (!play(7))
+			bad++;
+		reboot();
+		if (SCORE_Table()->games != saved.games + 1)
+			bad++;
+	}
+	CHECK(bad == 0);
+	printf("torn: %d resets mid program\n", tears);
+}
+
+/*----------------------------------------------------------------------------
+  A reset while the log enters a sector leaves it partly erased
+ *----------------------------------------------------------------------------*/
+static void test_torn_erase (void) {
+	static const int cuts[] = { 0, SCORE_PAGE / 2, SCORE_SECTOR_SIZE / 2, SCORE_SECTOR_SIZE - SCORE_PAGE };
+	score_table_t saved;
+	int c, g;
+	volatile int bad = 0;
+
+	for (c = 0; c < (int)(sizeof(cuts) / sizeof(cuts[0])); c++) {
+		//Fill both sectors, so the next save erases sector 0 over old records
+		memset(flash, 0xFF, FLASH_SIZE);
+		reboot();
+		for (g = 0; g < 2 * SCORE_PAGES_PER_SECTOR; g++)
+			play(g);
+		saved = *SCORE_Table();
+
+		tear_at = cuts[c];
+		tear_erase = 1;
+		if (setjmp(reset) == 0) {
+			play(1000);
+			bad++;
+			tear_at = -1;
+			tear_erase = 0;
+			continue;
+		}
+		reboot();
+		if (!same_table(SCORE_Table(), &saved))
+			bad++;
+		if (!play(1001))
+			bad++;
+		reboot();
+		if (SCORE_Table()->games != saved.games + 1 || SCORE_Table()->kills[0] != 1001)
+			bad++;
+	}
+	CHECK(bad == 0);
+}
+
+/*----------------------------------------------------------------------------
+  A page that does not verify fails the save, the retry uses the next one.
+  Also as the first page of either sector, the log then goes on behind it.
+ *----------------------------------------------------------------------------*/
+static void test_bad_page (void) {
+	static const int pages[] = { 1, SCORE_PAGES_PER_SECTOR, 0 };
+	int i, g, games, bad = 0;
+
+	for (i = 0; i < (int)(sizeof(pages) / sizeof(pages[0])); i++) {
+		memset(flash, 0xFF, FLASH_SIZE);
+		reboot();
+		//The log wraps before it reaches page 0 again
+		games = pages[i] ? pages[i] : 2 * SCORE_PAGES_PER_SECTOR;
+		for (g = 0; g < games; g++)
+			play(10);
+		stuck_page = pages[i];
+		if (play(20) != 0)
+			bad++;
+		stuck_page = -1;
+		if (SCORE_Save() != 1 || !play(30))
+			bad++;
+		reboot();
+		if (SCORE_Table()->games != (U32)games + 2 || SCORE_Table()->kills[0] != 30 || SCORE_Table()->kills[1] != 20)
+			bad++;
+		//And the next save does not erase it
+		play(40);
+		reboot();
+		if (SCORE_Table()->games != (U32)games + 3)
+			bad++;
+	}
+	CHECK(bad == 0);
+}
+
+int main (void) {
+	static U32 ram;
+
+	//The IAP command words hold RAM addresses as U32, as on the device
+	if ((uintptr_t)&ram > 0xFFFFFFFFu) {
+		printf("score_test: RAM above 4 GB, build without PIE\n");
+		return 2;
+	}
+	flash_file = tmpfile();
+	if (flash_file == NULL || ftruncate(fileno(flash_file), FLASH_SIZE) != 0) {
+		perror("score_test: flash file");
+		return 2;
+	}
+	flash_map();
+
+	test_blank();
+	test_wrap();
+	test_torn();
+	test_torn_erase();
+	test_bad_page();
+
+	printf("score_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
@@ -0,0 +1,145 @@
+/*----------------------------------------------------------------------------
+ * Name:    screen_test.c
+ * Purpose: host test and benchmark of the compressed screens in screen.c
+ * Note(s): Both screens of screen_img.c are drawn with SCR_Draw on the real
+ *          driver and lcd_model.c, and compared with the stream decoded
+ *          here in one piece. Reported are the compression ratio, the SPI
+ *          time of a screen on the model, and the decode speed on the
+ *          host: SCR_Draw into a link that drops the bytes, next to
+ *          streaming the same pixels from RAM the same way.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "RTL.h"
+#include "GLCD.h"
+#include "screen.h"
+#include "lcd_model.h"
+
+#define CHUNK       32                  /* SCR_CHUNK                          */
+#define REPEAT      20
+#define TRIALS      5
+
+static unsigned short image[LCD_H * LCD_W];
+static U8 used[256];                    /* Palette entries the stream uses    */
+static int to_model = 1;                /* 0: SSP bytes go nowhere            */
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*----------------------------------------------------------------------------
+  Decode the whole stream into image[], returns the stream bytes used or 0
+  if it does not end on the last pixel
+ *----------------------------------------------------------------------------*/
+static U32 decode (const scr_image_t *img) {
+	const U8 *p = img->data;
+	U32 n = 0, size = (U32)img->w * img->h;
+	int k, count;
+
+	memset(used, 0, sizeof(used));
+	while (n < size) {
+		if (*p < 0x80) {
+			count = *p + 1;
+			for (k = 0; k < count && n < size; k++)
+				image[n++] = img->palette[p[1]];
+			used[p[1]] = 1;
+			p += 2;
+		}
+		else {
+			count = *p - 0x7F;
+			for (k = 0; k < count && n < size; k++) {
+				image[n++] = img->palette[p[1 + k]];
+				used[p[1 + k]] = 1;
+			}
+			p += 1 + count;
+		}
+		if (k < count)
+			return 0;
+	}
+	return (U32)(p - img->data);
+}
+
+/* The driver's SSP, built with -DGLCD_SSP=test_ssp                          */
+unsigned char test_ssp (unsigned char byte) {
+	return to_model ? LCD_Ssp(byte) : 0;
+}
+
+static double seconds (void) {
+	return (double)clock() / CLOCKS_PER_SEC;
+}
+
+/*----------------------------------------------------------------------------
+  Best of TRIALS runs of REPEAT full screens, seconds per pixel: decoded by
+  SCR_Draw, or streamed from image[] in chunks of the same size
+ *----------------------------------------------------------------------------*/
+static double per_pixel (const scr_image_t *img, int raw) {
+	U32 size = (U32)img->w * img->h, k;
+	double t, best = 1e9;
+	int i, j;
+
+	to_model = 0;
+	for (j = 0; j < TRIALS; j++) {
+		t = seconds();
+		for (i = 0; i < REPEAT; i++) {
+			if (!raw) {
+				SCR_Draw(img, 0, 0);
+				continue;
+			}
+			GLCD_WindowStart(0, 0, img->w, img->h);
+			for (k = 0; k < size; k += CHUNK)
+				GLCD_WindowWrite(image + k, CHUNK);
+			GLCD_WindowStop();
+		}
+		t = seconds() - t;
+		if (t < best)
+			best = t;
+	}
+	to_model = 1;
+	return best / ((double)REPEAT * size);
+}
+
+static void test_image (const char *name, const scr_image_t *img) {
+	U32 size = (U32)img->w * img->h, stream, bytes, us;
+	int i, n_colors;
+	double t, t_raw;
+
+	stream = decode(img);
+	CHECK(stream != 0);
+	for (i = 0, n_colors = 0; i < 256; i++)
+		n_colors += used[i];
+
+	//One window, every pixel as decoded
+	memset(LCD_Gram, 0, sizeof(LCD_Gram));
+	bytes = LCD_Count.bytes;
+	us = LCD_Now();
+	SCR_Draw(img, 0, 0);
+	bytes = LCD_Count.bytes - bytes;
+	us = LCD_Now() - us;
+	CHECK(memcmp(LCD_Gram, image, sizeof(LCD_Gram)) == 0);
+	CHECK(bytes <= 6 * 6 + 3 + 1 + 2 * size);
+
+	//Decode cost on the host, the link dropping the bytes
+	t = per_pixel(img, 0);
+	t_raw = per_pixel(img, 1);
+
+	printf("screen: %-8s %u+%u bytes for %u (%u.%u:1), %d colors\n", name, stream, n_colors * 2, 2 * size,
+		2 * size / (stream + n_colors * 2), 2 * size * 10 / (stream + n_colors * 2) % 10, n_colors);
+	printf("screen: %-8s %u SPI bytes, %u.%03u s on the model\n", name, bytes, us / 1000000, us / 1000 % 1000);
+	printf("screen: %-8s host %.1f Mpixel/s decoded, %.1f from RAM\n", name, 1e-6 / t, 1e-6 / t_raw);
+}
+
+int main (void) {
+	LCD_Reset(LCD_ILI, 0x9325);
+	GLCD_Init();
+	GLCD_ClipMax();
+
+	test_image("title", &SCR_Title);
+	test_image("gameover", &SCR_GameOver);
+	CHECK(LCD_Count.errors == 0);
+
+	printf("screen_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
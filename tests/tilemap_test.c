@@ -0,0 +1,134 @@
+/*----------------------------------------------------------------------------
+ * Name:    tilemap_test.c
+ * Purpose: host test of tilemap.c on the real driver and the LCD model
+ * Note(s): The level is drawn into the GRAM of lcd_model.c and compared
+ *          with TM_Row. Sprite erases must put back exactly the tiles
+ *          under the sprite, also where the camera splits them at the end
+ *          of GRAM, and a changed tile is redrawn by TM_Flush alone. The
+ *          bytes are those the model saw, next to the flat color fill the
+ *          layer replaced.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#include "RTL.h"
+#include "GLCD.h"
+#include "camera.h"
+#include "tilemap.h"
+#include "lcd_model.h"
+
+#define MARK        0x5555              /* Stands in for a sprite             */
+
+static unsigned short row[LCD_W];
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/*----------------------------------------------------------------------------
+  Mark world rectangle x, y, w, h in GRAM as a sprite would cover it
+ *----------------------------------------------------------------------------*/
+static void cover (int x, int y, int w, int h) {
+	int r, c;
+
+	for (r = y; r < y + h; r++)
+		for (c = x; c < x + w; c++)
+			if (r >= 0 && r < LCD_H && c >= CAM_Get() && c < CAM_Get() + LCD_W)
+				LCD_Gram[r][CAM_Gram(c)] = MARK;
+}
+
+/*----------------------------------------------------------------------------
+  Number of view pixels that are not the background; 'skip' (x, y, w, h
+  in world coordinates, or NULL) may hold MARK instead
+ *----------------------------------------------------------------------------*/
+static int wrong (const int *skip) {
+	int cam = CAM_Get();
+	int x, y, n = 0, in;
+
+	for (y = 0; y < LCD_H; y++) {
+		TM_Row(cam, y, LCD_W, row);
+		for (x = 0; x < LCD_W; x++) {
+			in = skip && cam + x >= skip[0] && cam + x < skip[0] + skip[2] && y >= skip[1] && y < skip[1] + skip[3];
+			if (LCD_Gram[y][CAM_Gram(cam + x)] != (in ? MARK : row[x]))
+				n++;
+		}
+	}
+	return n;
+}
+
+int main (void) {
+	static const int rects[][4] = {
+		{ 100,  50, 20, 20 },                 /* Zombie, across a tile corner     */
+		{  16,  32, 16, 16 },                 /* Exactly one tile                 */
+		{  -5, 230, 12, 20 },                 /* Across the left and bottom edges */
+		{ 315, 100, 10, 10 },                 /* Across the right edge of view    */
+		{ 140, 150, 20, 20 },                 /* Across the GRAM end at camera 170 */
+	};
+	const int skip[4] = { 192, 64, 16, 16 };
+	int i, cam, strip_x, strip_w, bad;
+	U32 bytes, tm_bytes, restore, fill;
+
+	LCD_Reset(LCD_ILI, 0x9325);
+	GLCD_Init();
+	GLCD_ClipMax();
+	CAM_Init(1);
+	TM_Init();
+
+	//The whole view, as the menu leaves the playfield
+	bytes = LCD_Count.bytes;
+	TM_DrawAll();
+	bytes = LCD_Count.bytes - bytes;
+	CHECK(wrong(NULL) == 0);
+	CHECK(TM_Stats()->bytes == bytes);
+	printf("tilemap: whole view %u bytes\n", bytes);
+
+	//Sprite erases with the camera at 0 and panned so GRAM wraps mid view
+	for (cam = 0; cam < 2; cam++) {
+		if (cam == 1) {
+			while (CAM_Get() != 170)
+				if (CAM_Move(CAM_Target(170 + CAM_VIEW_W / 2), &strip_x, &strip_w) != 0)
+					TM_Restore(strip_x, 0, strip_w, CAM_VIEW_H);
+			CHECK(wrong(NULL) == 0);
+		}
+		for (i = 0, bad = 0; i < (int)(sizeof(rects) / sizeof(rects[0])); i++) {
+			cover(rects[i][0] + CAM_Get(), rects[i][1], rects[i][2], rects[i][3]);
+			TM_Restore(rects[i][0] + CAM_Get(), rects[i][1], rects[i][2], rects[i][3]);
+			bad += wrong(NULL);
+		}
+		CHECK(bad == 0);
+	}
+
+	//A changed tile is drawn by the flush, not before; one out of view is
+	//dropped and drawn when it scrolls in
+	cover(192, 64, 16, 16);
+	TM_SetTile(192 / TM_TILE, 64 / TM_TILE, TM_SCORCH);
+	CHECK(wrong(skip) == 0);
+	TM_SetTile(5, 3, TM_SCORCH);
+	bytes = LCD_Count.bytes;
+	CHECK(TM_Flush() == 2);
+	bytes = LCD_Count.bytes - bytes;
+	CHECK(wrong(NULL) == 0);
+	CHECK(bytes <= 6 * 6 + 3 + 1 + 2 * TM_TILE * TM_TILE);
+	printf("tilemap: one dirty tile %u bytes\n", bytes);
+	while (CAM_Get() != 0)
+		if (CAM_Move(CAM_Target(0), &strip_x, &strip_w) != 0)
+			TM_Restore(strip_x, 0, strip_w, CAM_VIEW_H);
+	CHECK(wrong(NULL) == 0 && TM_GetTile(5, 3) == TM_SCORCH);
+
+	//A 20x20 zombie erase: restored tiles against the flat fill it replaced
+	tm_bytes = TM_Stats()->bytes;
+	bytes = LCD_Count.bytes;
+	TM_Restore(CAM_Get() + 100, 50, 20, 20);
+	restore = LCD_Count.bytes - bytes;
+	CHECK(TM_Stats()->bytes - tm_bytes == restore);
+	bytes = LCD_Count.bytes;
+	GLCD_Fill(100, 50, 20, 20, 0x8C71);
+	fill = LCD_Count.bytes - bytes;
+	printf("tilemap: 20x20 erase %u bytes, flat fill %u\n", restore, fill);
+	printf("tilemap: %u restores, %u bytes in all\n", TM_Stats()->restores, TM_Stats()->bytes);
+	CHECK(LCD_Count.errors == 0);
+
+	printf("tilemap_test: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
@@ -0,0 +1,245 @@
+/*----------------------------------------------------------------------------
+ * Name:    tilemap.c
+ * Purpose: tile map background layer
+ * Note(s): The level map lives in flash and is copied to RAM by TM_Init so
+ *          the game can change tiles while playing. Drawing functions talk
+ *          to the GLCD directly. The caller holds the GLCD mutex around
+ *          drawing and map changes.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include <stdio.h>
+#include "GLCD.h"
+#include "camera.h"
+#include "tilemap.h"
+
+#define TM_CHUNK         32               /* Pixels composed per write        */
+
+const tm_tile_t TM_Tiles[TM_NUM_TILES] = {
+	/* TM_FLOOR */
+	{ 0x8C71, 0x8C71, { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	                    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 } },
+	/* TM_CRACKS */
+	{ 0x6B4D, 0x8C71, { 0x0000, 0x0000, 0x0004, 0x0008, 0x0008, 0x0030, 0x0040, 0x0040,
+	                    0x0180, 0x0200, 0x1200, 0x0C00, 0x0400, 0x0800, 0x0000, 0x0000 } },
+	/* TM_GRAVEL */
+	{ 0x9CF3, 0x8C71, { 0x0000, 0x0808, 0x0000, 0x0200, 0x0002, 0x2080, 0x0000, 0x0008,
+	                    0x0400, 0x0002, 0x0020, 0x2000, 0x0408, 0x0000, 0x0100, 0x0000 } },
+	/* TM_WEEDS */
+	{ 0x53C9, 0x8C71, { 0x0000, 0x0000, 0x0000, 0x0010, 0x0054, 0x0038, 0x0010, 0x0000,
+	                    0x0000, 0x2400, 0x2800, 0x1900, 0x0A00, 0x0C00, 0x0800, 0x0000 } },
+	/* TM_SLAB */
+	{ 0x7BEF, 0x8C71, { 0xFFFF, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+	                    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001 } },
+	/* TM_SCORCH */
+	{ 0x39E7, 0x8C71, { 0x0000, 0x0120, 0x27E8, 0x0FF0, 0x1FFC, 0x3FFE, 0x7FFC, 0x7FFE,
+	                    0x7FFC, 0x3FFE, 0x3FFC, 0x5FF8, 0x0FE4, 0x0640, 0x0400, 0x0000 } },
+};
+
+static const U8 tm_level[TM_ROWS][TM_COLS] = {
+	{0,2,0,0,0,0,3,0,0,0,0,0,1,0,0,0,0,2,0,0,0,0,0,3,0,0,0,0,0,0,2,0,0,0,0,0,1,0,0,0},
+	{0,0,0,0,1,0,0,0,0,0,0,0,2,0,0,0,0,0,3,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,3,0,0,0,0,0},
+	{0,3,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,2,0,0,0,0,0,0,0,4,4,4,4,0,0,0,0,0,0},
+	{0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,4,4,4,4,0,0,2,0,0,0},
+	{0,0,0,0,0,0,0,4,4,4,4,4,4,0,0,3,0,0,0,0,0,0,0,0,0,0,3,0,0,0,4,4,4,4,0,0,0,0,0,0},
+	{0,0,1,0,0,0,0,4,4,4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,4,4,4,4,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,4,4,4,4,4,4,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0},
+	{2,0,0,0,3,0,0,4,4,4,4,4,4,0,0,0,0,0,0,0,2,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,1,0},
+	{0,0,0,0,0,0,0,4,4,4,4,4,4,0,0,0,0,1,0,0,0,0,0,0,0,0,0,4,4,4,4,0,0,0,0,0,0,0,0,0},
+	{0,0,0,2,0,0,0,4,4,4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,4,4,0,0,0,2,0,0,0,0,0},
+	{0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,1,0,0,0,0,4,4,4,4,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,2,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0},
+	{0,0,3,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,0,0,3,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,1,0,0,0,3,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,2,0,0,0},
+	{0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,3,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0},
+};
+
+static U8 tm_map[TM_ROWS][TM_COLS];
+static U8 tm_dirty[TM_ROWS][(TM_COLS + 7) / 8];  /* Bit col set when the tile changed */
+static tm_stats_t tm_stats;
+
+/*----------------------------------------------------------------------------
+  Load the level map, nothing is drawn until TM_DrawAll
+ *----------------------------------------------------------------------------*/
+void TM_Init (void) {
+	int col, row;
+
+	for (row = 0; row < TM_ROWS; row++) {
+		for (col = 0; col < TM_COLS; col++) {
+			tm_map[row][col] = tm_level[row][col];
+		}
+		for (col = 0; col < (TM_COLS + 7) / 8; col++) {
+			tm_dirty[row][col] = 0;
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Tile at map position col, row (TM_FLOOR outside the map)
+ *----------------------------------------------------------------------------*/
+U8 TM_GetTile (int col, int row) {
+	if (col < 0 || col >= TM_COLS || row < 0 || row >= TM_ROWS)
+		return TM_FLOOR;
+	return tm_map[row][col];
+}
+
+/*----------------------------------------------------------------------------
+  Change a tile, it is redrawn by the next TM_Flush
+ *----------------------------------------------------------------------------*/
+void TM_SetTile (int col, int row, U8 tile) {
+	if (col < 0 || col >= TM_COLS || row < 0 || row >= TM_ROWS || tile >= TM_NUM_TILES)
+		return;
+	if (tm_map[row][col] != tile) {
+		tm_map[row][col] = tile;
+		tm_dirty[row][col / 8] |= 1 << (col % 8);
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Background pixels of world columns x..x+n-1 in row y, all inside the world
+ *----------------------------------------------------------------------------*/
+void TM_Row (int x, int y, int n, unsigned short *pix) {
+	const tm_tile_t *tile;
+	U16 bits;
+	int col, i;
+
+	while (n > 0) {
+		col = x / TM_TILE;
+		tile = &TM_Tiles[tm_map[y / TM_TILE][col]];
+		bits = tile->rows[y % TM_TILE] >> (x % TM_TILE);
+
+		//Rest of this tile's row, or what is left of the span
+		i = TM_TILE - x % TM_TILE;
+		if (i > n) i = n;
+		x += i;
+		n -= i;
+		while (i-- > 0) {
+			*pix++ = (bits & 1) ? tile->fg : tile->bg;
+			bits >>= 1;
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Stream world columns [x, x+w) of rows [y, y+h) into GRAM column gx
+ *----------------------------------------------------------------------------*/
+static void tm_upload (int gx, int x, int y, int w, int h) {
+	unsigned short pix[TM_CHUNK];
+	U32 start_bytes = GLCD_Stats()->bytes;
+	int row, done, n;
+
+	GLCD_WindowStart(gx, y, w, h);
+	for (row = y; row < y + h; row++) {
+		for (done = 0; done < w; done += n) {
+			n = (w - done < TM_CHUNK) ? w - done : TM_CHUNK;
+			TM_Row(x + done, row, n, pix);
+			GLCD_WindowWrite(pix, n);
+		}
+	}
+	GLCD_WindowStop();
+
+	tm_stats.bytes += GLCD_Stats()->bytes - start_bytes;
+}
+
+/*----------------------------------------------------------------------------
+  Redraw the background under a world rectangle, clipped to the view
+  The part past the end of GRAM wraps around to column 0
+ *----------------------------------------------------------------------------*/
+void TM_Restore (int x, int y, int w, int h) {
+	int gx, first;
+
+	if (y < 0) { h += y; y = 0; }
+	if (y + h > TM_ROWS * TM_TILE) h = TM_ROWS * TM_TILE - y;
+	if (h <= 0 || !CAM_Clip(&x, &w))
+		return;
+
+	gx = CAM_Gram(x);
+	first = (gx + w > CAM_VIEW_W) ? CAM_VIEW_W - gx : w;
+	tm_upload(gx, x, y, first, h);
+	if (first < w)
+		tm_upload(0, x + first, y, w - first, h);
+
+	tm_stats.restores++;
+}
+
+/*----------------------------------------------------------------------------
+  Draw the map under the view, replaces GLCD_Clear when the playfield is shown
+ *----------------------------------------------------------------------------*/
+void TM_DrawAll (void) {
+	int col, row;
+
+	TM_Restore(CAM_Get(), 0, CAM_VIEW_W, TM_ROWS * TM_TILE);
+	for (row = 0; row < TM_ROWS; row++) {
+		for (col = 0; col < (TM_COLS + 7) / 8; col++) {
+			tm_dirty[row][col] = 0;
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+  Take the next dirty tile, for layers that redraw tiles themselves
+  Returns 0 once no tile is left
+ *----------------------------------------------------------------------------*/
+int TM_NextDirty (int *col, int *row) {
+	int r, c;
+
+	for (r = 0; r < TM_ROWS; r++) {
+		for (c = 0; c < TM_COLS; c++) {
+			if (tm_dirty[r][c / 8] == 0) {
+				c += 7;
+				continue;
+			}
+			if (tm_dirty[r][c / 8] & (1 << (c % 8))) {
+				tm_dirty[r][c / 8] &= ~(1 << (c % 8));
+				*col = c;
+				*row = r;
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+/*----------------------------------------------------------------------------
+  Redraw the tiles changed since the last flush, tiles out of view are
+  dropped as the camera draws them when they scroll in
+  Returns the number of tiles drawn
+ *----------------------------------------------------------------------------*/
+int TM_Flush (void) {
+	int col, row;
+	int n = 0;
+
+	while (TM_NextDirty(&col, &row)) {
+		TM_Restore(col * TM_TILE, row * TM_TILE, TM_TILE, TM_TILE);
+		n++;
+	}
+	tm_stats.tiles += n;
+	return n;
+}
+
+/*----------------------------------------------------------------------------
+  Running totals since reset
+ *----------------------------------------------------------------------------*/
+const tm_stats_t *TM_Stats (void) {
+	return &tm_stats;
+}
+
+/*----------------------------------------------------------------------------
+  Bytes of RAM the map and its dirty bits take
+ *----------------------------------------------------------------------------*/
+U32 TM_RamSize (void) {
+	return sizeof(tm_map) + sizeof(tm_dirty);
+}
+
+/*----------------------------------------------------------------------------
+  Print the background bytes pushed per frame
+ *----------------------------------------------------------------------------*/
+void TM_Report (U32 frames) {
+	if (frames == 0) frames = 1;
+
+	printf("--- Background (%u frames) ---\n", frames);
+	printf("restores/frame %u, dirty tiles %u\n", tm_stats.restores / frames, tm_stats.tiles);
+	printf("bytes/frame    %u\n", tm_stats.bytes / frames);
+}
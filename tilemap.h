@@ -0,0 +1,59 @@
+/*----------------------------------------------------------------------------
+ * Name:    tilemap.h
+ * Purpose: tile map background layer
+ * Note(s): The playfield background is a map of TM_TILE x TM_TILE tiles.
+ *          Each tile is a two color pattern of one bit per pixel kept in
+ *          flash (32 bytes a tile), so the whole layer costs 600 bytes of
+ *          RAM for the map of the two screen wide world. Erasing a sprite
+ *          redraws only the background under it; map edits mark tiles
+ *          dirty and TM_Flush redraws them.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include "camera.h"
+
+#ifndef __TILEMAP_H
+#define __TILEMAP_H
+
+#define TM_TILE     16                  /* Tile size in pixels                */
+#define TM_COLS     (CAM_WORLD_W / TM_TILE)
+#define TM_ROWS     (CAM_WORLD_H / TM_TILE)
+
+/* Tile set                                                                   */
+#define TM_FLOOR    0
+#define TM_CRACKS   1
+#define TM_GRAVEL   2
+#define TM_WEEDS    3
+#define TM_SLAB     4
+#define TM_SCORCH   5                   /* Left behind by an explosion        */
+#define TM_NUM_TILES 6
+
+typedef struct {
+	U16 fg;                               /* Color of the set bits              */
+	U16 bg;
+	U16 rows[TM_TILE];                    /* Top row first, bit 0 is the left   */
+} tm_tile_t;
+
+typedef struct {
+	U32 restores;                         /* TM_Restore calls                   */
+	U32 tiles;                            /* Dirty tiles redrawn by TM_Flush    */
+	U32 bytes;                            /* SPI bytes sent by both             */
+} tm_stats_t;
+
+extern const tm_tile_t TM_Tiles[TM_NUM_TILES];
+
+extern void TM_Init      (void);
+extern U8   TM_GetTile   (int col, int row);
+extern void TM_SetTile   (int col, int row, U8 tile);
+extern void TM_Row       (int x, int y, int n, unsigned short *pix);
+extern void TM_Restore   (int x, int y, int w, int h);
+extern void TM_DrawAll   (void);
+extern int  TM_NextDirty (int *col, int *row);
+extern int  TM_Flush     (void);
+extern const tm_stats_t *TM_Stats (void);
+extern U32  TM_RamSize   (void);
+extern void TM_Report    (U32 frames);
+
+#endif
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""
+Name:    rle_screen.py
+Purpose: convert full-screen images to the palette RLE format drawn by
+         SCR_Draw (screen.c)
+Note(s): Reads 8 bit RGB/RGBA PNG or binary PPM (P6) without extra
+         packages. Colors are reduced to RGB565, at most 256 of them.
+
+         Stream format, pixels top row first, runs may cross rows:
+           0x00..0x7F  n+1 pixels of the palette color in the next byte
+           0x80..0xFF  n-0x7F literal pixels, one palette byte each
+
+Usage:   rle_screen.py out.c NAME=image.png [NAME=image.png ...]
+"""
+
+import struct
+import sys
+import zlib
+
+
+def read_png(data):
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('not a PNG file')
+    pos = 8
+    idat = b''
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            w, h, depth, ctype, _, _, interlace = struct.unpack('>IIBBBBB', body)
+            if depth != 8 or ctype not in (2, 6) or interlace:
+                raise ValueError('only 8 bit RGB/RGBA, non-interlaced PNG')
+            bpp = 3 if ctype == 2 else 4
+        elif kind == b'IDAT':
+            idat += body
+        elif kind == b'IEND':
+            break
+
+    raw = zlib.decompress(idat)
+    stride = w * bpp
+    rows = []
+    prev = bytearray(stride)
+    for y in range(h):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append([tuple(line[x * bpp:x * bpp + 3]) for x in range(w)])
+        prev = line
+    return w, h, rows
+
+
+def read_ppm(data):
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b'P6' or fields[3] != b'255':
+        raise ValueError('only binary PPM with maxval 255')
+    w, h = int(fields[1]), int(fields[2])
+    pix = data[pos + 1:]
+    return w, h, [[tuple(pix[(y * w + x) * 3:(y * w + x) * 3 + 3]) for x in range(w)] for y in range(h)]
+
+
+def rgb565(rgb):
+    r, g, b = rgb
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def encode(pixels):
+    """Palette indices -> RLE stream"""
+    out = bytearray()
+    i = 0
+    n = len(pixels)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            out += bytes((run - 1, pixels[i]))
+            i += run
+            continue
+        # Literal up to the next pair of equal pixels
+        lit = 1
+        while i + lit < n and lit < 128 and not (i + lit + 1 < n and pixels[i + lit] == pixels[i + lit + 1]):
+            lit += 1
+        out.append(0x7F + lit)
+        out += bytes(pixels[i:i + lit])
+        i += lit
+    return out
+
+
+def decode(data, count):
+    """Reference decoder, same logic as SCR_Draw"""
+    out = []
+    i = 0
+    while len(out) < count:
+        op = data[i]
+        if op < 0x80:
+            out += [data[i + 1]] * (op + 1)
+            i += 2
+        else:
+            out += list(data[i + 1:i + op - 0x7F + 1])
+            i += op - 0x7F + 1
+    return out
+
+
+def convert(name, path):
+    data = open(path, 'rb').read()
+    w, h, rows = read_png(data) if data[:4] == b'\x89PNG' else read_ppm(data)
+
+    palette = []
+    index = {}
+    pixels = []
+    for row in rows:
+        for rgb in row:
+            c = rgb565(rgb)
+            if c not in index:
+                index[c] = len(palette)
+                palette.append(c)
+            pixels.append(index[c])
+    if len(palette) > 256:
+        raise ValueError('%s: %d colors, at most 256' % (path, len(palette)))
+
+    stream = encode(pixels)
+    assert decode(stream, len(pixels)) == pixels
+
+    size = len(stream) + 2 * len(palette)
+    sys.stderr.write('%-10s %dx%d, %d colors, %d bytes (raw %d, %.1f:1)\n' %
+                     (name, w, h, len(palette), size, 2 * w * h, 2.0 * w * h / size))
+
+    lines = ['/* %s: %dx%d from %s */' % (name, w, h, path.replace('\\', '/')),
+             'static const U16 %s_palette[%d] = {' % (name, len(palette))]
+    for k in range(0, len(palette), 8):
+        lines.append('\t' + ', '.join('0x%04X' % c for c in palette[k:k + 8]) + ',')
+    lines.append('};')
+    lines.append('static const U8 %s_data[%d] = {' % (name, len(stream)))
+    for k in range(0, len(stream), 16):
+        lines.append('\t' + ','.join('0x%02X' % b for b in stream[k:k + 16]) + ',')
+    lines.append('};')
+    lines.append('const scr_image_t SCR_%s = { %d, %d, %s_palette, %s_data };' % (name, w, h, name, name))
+    return '\n'.join(lines) + '\n'
+
+
+def main(argv):
+    if len(argv) < 3:
+        sys.stderr.write(__doc__)
+        return 1
+
+    out = ['/*----------------------------------------------------------------------------',
+           ' * Name:    %s' % argv[1].replace('\\', '/').split('/')[-1],
+           ' * Purpose: compressed full-screen images',
+           ' * Note(s): Generated by tools/rle_screen.py, do not edit.',
+           ' *----------------------------------------------------------------------------',
+           '',
+           ' *----------------------------------------------------------------------------*/',
+           '',
+           '#include <RTL.h>',
+           '#include "screen.h"',
+           '']
+    for arg in argv[2:]:
+        name, path = arg.split('=', 1)
+        out.append(convert(name, path))
+    open(argv[1], 'w').write('\n'.join(out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -406,6 +406,30 @@ uint8_t UARTReceiveChar( uint32_t portNum)
 	#endif
 }
 
+/*****************************************************************************
+** Function name:		UARTCheckChar
+**
+** Descriptions:		Non-blocking read of one character
+**
+** parameters:			portNum
+** Returned value:		received character, or -1 if none is waiting
+** 
+*****************************************************************************/
+int32_t UARTCheckChar( uint32_t portNum)
+{
+	#ifdef __RTGT_UART
+		LPC_UART_TypeDef *LPC_UART;
+		LPC_UART = (portNum == 0 ? (LPC_UART_TypeDef *)LPC_UART0 : (LPC_UART_TypeDef *)LPC_UART1 );
+		if (!(LPC_UART->LSR & LSR_RDR))
+			return -1;
+		return (LPC_UART->RBR);
+	#else
+		if (ITM_CheckChar() != 1)
+			return -1;
+		return (ITM_ReceiveChar());
+	#endif
+}
+
 /******************************************************************************
 **                            End Of File
 ******************************************************************************/
@@ -62,6 +62,7 @@ uint32_t UARTRecieve( uint32_t portNum, uint8_t *BufferPtr, uint32_t Length );
 
 void     UARTSendChar(    uint32_t portNum, uint8_t character );
 uint8_t  UARTReceiveChar( uint32_t portNum );
+int32_t  UARTCheckChar(   uint32_t portNum );
 
 #endif /* end __UART_H */
 /*****************************************************************************
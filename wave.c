@@ -0,0 +1,127 @@
+/*----------------------------------------------------------------------------
+ * Name:    wave.c
+ * Purpose: wave director, precomputed zombie spawn schedules
+ * Note(s): The difficulty curve follows the old inline spawner: the spawn
+ *          interval starts at 75 frames and shrinks by 10 down to 25, speeds
+ *          start between 2 and 3 and ramp towards 3 and 6.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+#include <stdio.h>
+#include "wave.h"
+
+static wave_spawn_t wave_table[WAVE_MAX_SPAWNS];
+static wave_stats_t wave_stats;
+static U8 wave_next = 0;
+
+/*----------------------------------------------------------------------------
+  Small deterministic generator so a wave number always gives the same table
+ *----------------------------------------------------------------------------*/
+static U32 wave_rand (U32 *state) {
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+/*----------------------------------------------------------------------------
+  Fill 'table' with the schedule of 'wave' and summarise it in 'stats'
+ *----------------------------------------------------------------------------*/
+static void wave_generate (U16 wave, wave_spawn_t *table, wave_stats_t *stats) {
+	U32 seed = 0x9E3779B9UL ^ (wave * 2654435761UL);
+	int count = 4 + 2 * wave;
+	int interval = 75 - 10 * wave;
+	int min_speed = 2 * WAVE_SPEED_ONE + wave * WAVE_SPEED_ONE / 5;
+	int max_speed = 3 * WAVE_SPEED_ONE + wave * WAVE_SPEED_ONE * 3 / 5;
+	int frame = 0;
+	U32 speed_sum = 0;
+	int i;
+
+	if (seed == 0) seed = 1;
+	if (count > WAVE_MAX_SPAWNS) count = WAVE_MAX_SPAWNS;
+	if (interval < 25) interval = 25;
+	if (min_speed > 3 * WAVE_SPEED_ONE) min_speed = 3 * WAVE_SPEED_ONE;
+	if (max_speed > 6 * WAVE_SPEED_ONE) max_speed = 6 * WAVE_SPEED_ONE;
+
+	stats->wave = wave;
+	stats->count = count;
+	stats->min_speed = 0xFF;
+	stats->max_speed = 0;
+
+	for (i = 0; i < count; i++) {
+		table[i].frame = frame;
+		//Mostly from the far corner, sometimes from a side
+		table[i].corner = (wave_rand(&seed) % 4 == 0) ? WAVE_ADJACENT_X + wave_rand(&seed) % 2 : WAVE_OPPOSITE;
+		table[i].speed = min_speed + wave_rand(&seed) % (max_speed - min_speed + 1);
+
+		if (table[i].speed < stats->min_speed) stats->min_speed = table[i].speed;
+		if (table[i].speed > stats->max_speed) stats->max_speed = table[i].speed;
+		speed_sum += table[i].speed;
+
+		//Jitter the interval by up to a fifth either way
+		frame += interval - interval / 5 + wave_rand(&seed) % (2 * interval / 5 + 1);
+	}
+
+	stats->duration = count ? table[count - 1].frame : 0;
+	stats->avg_speed = count ? speed_sum / count : 0;
+}
+
+/*----------------------------------------------------------------------------
+  Precompute the schedule of 'wave' and make it current
+ *----------------------------------------------------------------------------*/
+void WAVE_Build (U16 wave) {
+	wave_generate(wave, wave_table, &wave_stats);
+	wave_next = 0;
+}
+
+/*----------------------------------------------------------------------------
+  Next spawn of the current wave if it is due at 'frame'.
+  Returns 1 and fills 'spawn' if so, the entry stays queued until WAVE_Pop.
+ *----------------------------------------------------------------------------*/
+int WAVE_Peek (U16 frame, wave_spawn_t *spawn) {
+	if (wave_next >= wave_stats.count || wave_table[wave_next].frame > frame)
+		return 0;
+	*spawn = wave_table[wave_next];
+	return 1;
+}
+
+/*----------------------------------------------------------------------------
+  Consume the entry returned by WAVE_Peek
+ *----------------------------------------------------------------------------*/
+void WAVE_Pop (void) {
+	if (wave_next < wave_stats.count)
+		wave_next++;
+}
+
+/*----------------------------------------------------------------------------
+  All spawns of the current wave have been issued
+ *----------------------------------------------------------------------------*/
+int WAVE_Finished (void) {
+	return wave_next >= wave_stats.count;
+}
+
+/*----------------------------------------------------------------------------
+  Difficulty summary of the current wave
+ *----------------------------------------------------------------------------*/
+const wave_stats_t *WAVE_Stats (void) {
+	return &wave_stats;
+}
+
+/*----------------------------------------------------------------------------
+  Print the difficulty of waves first..last (speeds in 1/16 px per frame)
+ *----------------------------------------------------------------------------*/
+void WAVE_Report (U16 first, U16 last) {
+	static wave_spawn_t table[WAVE_MAX_SPAWNS];
+	wave_stats_t stats;
+	U16 wave;
+
+	printf("wave count frames speed min/avg/max  (now %u, %u left)\n",
+		wave_stats.wave, wave_stats.count - wave_next);
+	for (wave = first; wave <= last; wave++) {
+		wave_generate(wave, table, &stats);
+		printf("%4u %5u %6u %5u/%u/%u\n", stats.wave, stats.count, stats.duration,
+			stats.min_speed, stats.avg_speed, stats.max_speed);
+	}
+}
@@ -0,0 +1,49 @@
+/*----------------------------------------------------------------------------
+ * Name:    wave.h
+ * Purpose: wave director, precomputed zombie spawn schedules
+ * Note(s): Each wave is generated once into a compact table of spawn
+ *          entries (frame, corner, speed). The game loop only walks the
+ *          table. Schedules are deterministic per wave number, so the
+ *          difficulty of any wave can be inspected ahead of time.
+ *----------------------------------------------------------------------------
+
+ *----------------------------------------------------------------------------*/
+
+#include <RTL.h>
+
+#ifndef __WAVE_H
+#define __WAVE_H
+
+#define WAVE_MAX_SPAWNS   24
+#define WAVE_OVERTIME     150           /* Frames after the last spawn before */
+                                        /* the next wave starts anyway        */
+#define WAVE_SPEED_ONE    16            /* Speeds are in 1/16 px per frame    */
+
+/* Spawn corner, relative to the quadrant the human is in when it spawns      */
+#define WAVE_OPPOSITE     0
+#define WAVE_ADJACENT_X   1             /* Same side vertically               */
+#define WAVE_ADJACENT_Y   2             /* Same side horizontally             */
+
+typedef struct {
+	U16 frame;                            /* Frames after the wave start        */
+	U8  corner;
+	U8  speed;
+} wave_spawn_t;
+
+typedef struct {
+	U16 wave;
+	U8  count;                            /* Zombies in the wave                */
+	U16 duration;                         /* Frame of the last spawn            */
+	U8  min_speed;
+	U8  max_speed;
+	U8  avg_speed;
+} wave_stats_t;
+
+extern void WAVE_Build   (U16 wave);
+extern int  WAVE_Peek    (U16 frame, wave_spawn_t *spawn);
+extern void WAVE_Pop     (void);
+extern int  WAVE_Finished(void);
+extern const wave_stats_t *WAVE_Stats(void);
+extern void WAVE_Report  (U16 first, U16 last);
+
+#endif